@@ -63,6 +63,23 @@ static int	(*IRQAck)(int nIRQ) = NULL;
 static int s_lastCycles;
 #endif
 
+// Idle loop detection (see M68KSetIdleDetect())
+static bool		s_idleDetect = false;
+static bool		s_idle = false;		// current timeslice was ended by the detector
+static UINT64	s_idleCycles = 0;	// cycles skipped so far
+static UINT32	s_writes = 0;		// data writes, bumped by every write handler
+static UINT32	s_readHash = 0;		// reads since the anchor was last visited
+
+static struct
+{
+	bool	valid;
+	bool	iterationValid;	// regs and hash describe a complete iteration
+	UINT32	pc, addr;		// read that anchors the loop
+	UINT32	writes;			// s_writes when anchored
+	UINT32	hash;			// reads made by the last iteration
+	UINT32	regs[17];		// D0-D7, A0-A7, SR at the last visit
+} s_anchor;
+
 
 /******************************************************************************
  68K Interface
@@ -224,6 +241,71 @@ void M68KLoadState(CBlockFile *StateFile, const char *name)
 	m68k_set_reg(M68K_REG_IR, data[33]);
 }
 
+// Idle loop detection
+
+/*
+ * A polling loop reads the same locations every iteration and writes nothing.
+ * The first data read after a write becomes the anchor. Each time execution
+ * returns to it, the registers and a hash of everything read since the last
+ * visit are compared with those of the previous visit. Two identical
+ * iterations in a row mean the loop can only repeat itself until something
+ * outside the CPU changes, which doesn't happen within a timeslice, so the
+ * rest of the slice is skipped.
+ */
+static void IdleRead(UINT32 a, UINT32 d)
+{
+	UINT32 pc = m68k_get_reg(NULL, M68K_REG_PPC);
+
+	if (!s_anchor.valid || s_anchor.writes != s_writes)
+	{
+		s_anchor.valid = true;
+		s_anchor.iterationValid = false;
+		s_anchor.pc = pc;
+		s_anchor.addr = a;
+		s_anchor.writes = s_writes;
+		s_readHash = 0;
+	}
+	else if (pc == s_anchor.pc && a == s_anchor.addr)
+	{
+		static const m68k_register_t regNames[17] =
+		{
+			M68K_REG_D0, M68K_REG_D1, M68K_REG_D2, M68K_REG_D3, M68K_REG_D4, M68K_REG_D5, M68K_REG_D6, M68K_REG_D7,
+			M68K_REG_A0, M68K_REG_A1, M68K_REG_A2, M68K_REG_A3, M68K_REG_A4, M68K_REG_A5, M68K_REG_A6, M68K_REG_A7,
+			M68K_REG_SR
+		};
+		UINT32 regs[17];
+		for (int i = 0; i < 17; i++)
+			regs[i] = m68k_get_reg(NULL, regNames[i]);
+
+		if (s_anchor.iterationValid && s_anchor.hash == s_readHash && 0 == memcmp(regs, s_anchor.regs, sizeof(regs)))
+		{
+			s_idle = true;
+			m68k_end_timeslice();
+		}
+		else
+		{
+			s_anchor.iterationValid = true;
+			s_anchor.hash = s_readHash;
+			memcpy(s_anchor.regs, regs, sizeof(regs));
+		}
+		s_readHash = 0;
+	}
+
+	s_readHash = (s_readHash ^ a) * 0x01000193;
+	s_readHash = (s_readHash ^ d) * 0x01000193;
+}
+
+void M68KSetIdleDetect(bool enable)
+{
+	s_idleDetect = enable;
+	s_anchor.valid = false;
+}
+
+UINT64 M68KGetIdleCycles(void)
+{
+	return s_idleCycles;
+}
+
 // Emulation functions
 
 void M68KSetIRQ(int irqLevel)
@@ -240,7 +322,14 @@ int M68KRun(int numCycles)
 		s_lastCycles += numCycles;
 	}
 #endif // SUPERMODEL_DEBUGGER
+	s_idle = false;
 	int doneCycles = m68k_execute(numCycles);
+	if (s_idle && doneCycles < numCycles)
+	{
+		// Idle loop ended the timeslice, account for the remaining cycles as if they were run
+		s_idleCycles += numCycles - doneCycles;
+		doneCycles = numCycles;
+	}
 #ifdef SUPERMODEL_DEBUGGER
 	if (s_Debug != NULL)
 	{
@@ -279,6 +368,8 @@ void M68KGetContext(M68KCtx *Dest)
 {
 	Dest->IRQAck = IRQAck;
 	Dest->Bus = s_Bus;
+	Dest->IdleDetect = s_idleDetect;
+	Dest->IdleCycles = s_idleCycles;
 #ifdef SUPERMODEL_DEBUGGER
 	Dest->Debug = s_Debug;
 #endif // SUPERMODEL_DEBUGGER
@@ -289,6 +380,9 @@ void M68KSetContext(M68KCtx *Src)
 {
 	IRQAck = Src->IRQAck;
 	s_Bus = Src->Bus;
+	s_idleDetect = Src->IdleDetect;
+	s_idleCycles = Src->IdleCycles;
+	s_anchor.valid = false;
 #ifdef SUPERMODEL_DEBUGGER
 	s_Debug = Src->Debug;
 #endif // SUPERMODEL_DEBUGGER
@@ -423,31 +517,43 @@ unsigned int FASTCALL M68KFetch32(unsigned int a)
 
 unsigned int FASTCALL M68KRead8(unsigned int a)
 {
-	return s_Bus->Read8(a);
+	unsigned int d = s_Bus->Read8(a);
+	if (s_idleDetect)
+		IdleRead(a, d);
+	return d;
 }
 
 unsigned int FASTCALL M68KRead16(unsigned int a)
 {
-	return s_Bus->Read16(a);
+	unsigned int d = s_Bus->Read16(a);
+	if (s_idleDetect)
+		IdleRead(a, d);
+	return d;
 }
 
 unsigned int FASTCALL M68KRead32(unsigned int a)
 {
-	return s_Bus->Read32(a);
+	unsigned int d = s_Bus->Read32(a);
+	if (s_idleDetect)
+		IdleRead(a, d);
+	return d;
 }
 
 void FASTCALL M68KWrite8(unsigned int a, unsigned int d)
 {
+	++s_writes;
 	s_Bus->Write8(a, d);
 }
 
 void FASTCALL M68KWrite16(unsigned int a, unsigned int d)
 {
+	++s_writes;
 	s_Bus->Write16(a, d);
 }
 
 void FASTCALL M68KWrite32(unsigned int a, unsigned int d)
 {
+	++s_writes;
 	s_Bus->Write32(a, d);
 }
 
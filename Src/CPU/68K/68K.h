@@ -77,6 +77,8 @@ public:
 	m68ki_cpu_core	musashiCtx;		// CPU context
 	IBus			*Bus;			// memory handlers
 	int				(*IRQAck)(int);	// IRQ acknowledge callback
+	bool			IdleDetect;		// end timeslices early in polling loops
+	UINT64			IdleCycles;		// cycles skipped by idle loop detection
 #ifdef SUPERMODEL_DEBUGGER
 	Debugger::CMusashi68KDebug *Debug;        // holds debugger (if attached)
 #endif // SUPERMODEL_DEBUGGER
@@ -85,6 +87,8 @@ public:
 	{
 		Bus = NULL;
 		IRQAck = NULL;
+		IdleDetect = false;
+		IdleCycles = 0;
 		memset(&musashiCtx, 0, sizeof(musashiCtx));	// very important! garbage in context at reset can cause very strange bugs
 #ifdef SUPERMODEL_DEBUGGER
 		Debug = NULL;
@@ -176,6 +180,28 @@ extern void M68KSaveState(CBlockFile *StateFile, const char *name);
  */
 extern void M68KLoadState(CBlockFile *StateFile, const char *name);
 
+/*
+ * M68KSetIdleDetect(enable):
+ *
+ * Enables idle loop detection for the active context. When the CPU is found
+ * to be spinning in a loop that only reads memory and cannot leave it until
+ * something outside the CPU changes, the rest of the timeslice is skipped and
+ * M68KRun() reports it as executed. This is only valid when nothing the CPU
+ * reads can change in the middle of a timeslice. Disabled by default.
+ *
+ * Parameters:
+ *		enable	True to enable, false to disable.
+ */
+extern void M68KSetIdleDetect(bool enable);
+
+/*
+ * M68KGetIdleCycles():
+ *
+ * Returns:
+ *		Total number of cycles the active context has skipped in idle loops.
+ */
+extern UINT64 M68KGetIdleCycles(void);
+
 /*
  * M68KSetIRQ(irqLevel):
  *
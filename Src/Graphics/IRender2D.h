@@ -0,0 +1,34 @@
+#ifndef INCLUDED_IRENDER2D_H
+#define INCLUDED_IRENDER2D_H
+
+#include <cstdint>
+#include <memory>
+#include "Supermodel.h"
+#include "../Model3/TileGenBuffer.h"
+
+/*
+ * IRender2D:
+ *
+ * Interface (abstract base class) for tile generator rendering engine. The
+ * tile generator draws its layers into TileGenBuffer surfaces itself, the
+ * renderer only has to present them around the 3D scene.
+ */
+class IRender2D
+{
+public:
+  virtual void BeginFrame(void) = 0;
+  virtual void PreRenderFrame(void) = 0;
+  virtual void RenderFrameBottom(void) = 0;
+  virtual void RenderFrameTop(void) = 0;
+  virtual void EndFrame(void) = 0;
+  virtual void AttachRegisters(const uint32_t *regPtr) = 0;
+  virtual void AttachVRAM(const uint8_t *vramPtr) = 0;
+  virtual void AttachDrawBuffers(std::shared_ptr<TileGenBuffer> bottom, std::shared_ptr<TileGenBuffer> top) = 0;
+  virtual Result Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes, unsigned aaTarget, UpscaleMode upscaleMode) = 0;
+
+  virtual ~IRender2D()
+  {
+  }
+};
+
+#endif  // INCLUDED_IRENDER2D_H
@@ -4,6 +4,22 @@
 #include <cstdint>
 #include "Types.h"
 
+/*
+ * Render3DStats:
+ *
+ * Counters for the last rendered frame, for profiling. Renderers fill in the
+ * ones that apply to them and leave the rest at zero.
+ */
+struct Render3DStats
+{
+  unsigned drawCalls = 0;     // draw calls issued to the GPU
+  unsigned meshes = 0;        // meshes submitted, before they were batched into draw calls
+  unsigned stateChanges = 0;  // model and mesh state (uniform) updates
+  unsigned cacheHits = 0;     // models found in the model cache
+  unsigned cacheMisses = 0;   // models that had to be converted
+  unsigned cacheEvictions = 0;  // cached models evicted to make room for others
+};
+
 /*
  * IRender3D:
  *
@@ -23,6 +39,11 @@ public:
   virtual void SetBlockCulling(bool enable) = 0;
   virtual float GetLosValue(int layer) = 0;
 
+  virtual Render3DStats GetStats(void) const
+  {
+    return Render3DStats();
+  }
+
   virtual ~IRender3D()
   {
   }
@@ -605,8 +605,11 @@ Result CLegacy3D::DrawModel(UINT32 modelAddr)
       Cache = &PolyCache;
   }
     
-  if (NULL == ModelRef)
+  if (NULL != ModelRef)
+    m_frameStats.cacheHits++;
+  else
   {
+    m_frameStats.cacheMisses++;
     // Attempt to cache the model, and perform a final check to determine 
     // whether VROM model is in fact dynamic (this should be fixed -- models
     // should be decoded to a common buffer and the cache determined
@@ -616,15 +619,21 @@ Result CLegacy3D::DrawModel(UINT32 modelAddr)
     ModelRef = CacheModel(Cache, lutIdx, m_textureOffset.state, model);
     if (NULL == ModelRef)
     {
-      // Model could not be cached. Render what we have so far and try again.
-      // This throws away the STATIC VROM cache too, so every VROM model has to be
-      // re-decoded and re-uploaded (textures included) over the following frames.
+      // Model could not be cached. Render what we have so far (display lists
+      // refer to VBO locations, which are about to change) and try again. The
+      // dynamic cache is simply cleared. The static VROM cache only evicts its
+      // least recently used models, so the ones still in use don't have to be
+      // re-decoded and re-uploaded.
       DrawDisplayList(&VROMCache, POLY_STATE_NORMAL);
       DrawDisplayList(&PolyCache, POLY_STATE_NORMAL);
       DrawDisplayList(&VROMCache, POLY_STATE_ALPHA);
       DrawDisplayList(&PolyCache, POLY_STATE_ALPHA);
-      ClearModelCache(&VROMCache);
-      ClearModelCache(&PolyCache);
+      ClearDisplayList(&VROMCache);
+      ClearDisplayList(&PolyCache);
+      if (Cache->dynamic)
+        ClearModelCache(Cache);
+      else
+        EvictModels(Cache);
       
       // Try caching again...
       ModelRef = CacheModel(Cache, lutIdx, m_textureOffset.state, model);
@@ -962,7 +971,7 @@ void CLegacy3D::RenderViewport(UINT32 addr, int pri, bool wideScreen)
 
 void CLegacy3D::RenderFrame(void)
 {
-  bool wideScreen = m_config["WideScreen"].ValueAs<bool>();
+  bool wideScreen = m_wideScreen.Get();
 
   // Begin frame
   ClearErrors();  // must be cleared each frame
@@ -971,7 +980,7 @@ void CLegacy3D::RenderFrame(void)
       glBindFramebuffer(GL_FRAMEBUFFER, m_aaTarget);			// if we have an AA target draw to it instead of the default back buffer
   }
 
-  if (blockCulling && !m_config["NoWhiteFlash"].ValueAs<bool>())    // block culling disables 3D rendering
+  if (blockCulling && !m_noWhiteFlash.Get())    // block culling disables 3D rendering
   {
       // clear screen to white
       glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
@@ -1074,11 +1083,19 @@ void CLegacy3D::RenderFrame(void)
 
 void CLegacy3D::EndFrame(void)
 {
+  m_lastFrameStats = m_frameStats;
+  m_frameStats = Render3DStats();
 }
 
 void CLegacy3D::BeginFrame(void)
 {
   //printf("--- BEGIN FRAME ---\n");
+  VROMCache.frame++;
+}
+
+Render3DStats CLegacy3D::GetStats(void) const
+{
+  return m_lastFrameStats;
 }
 
 
@@ -1130,9 +1147,9 @@ Result CLegacy3D::SetupGLObjects()
     glGetError(); // clear error flag
 
     // Create model caches and VBOs
-    if (CreateModelCache(&VROMCache, NUM_STATIC_VERTS, NUM_LOCAL_VERTS, NUM_STATIC_MODELS, 0x4000000 / 4, NUM_DISPLAY_LIST_ITEMS, false) != Result::OKAY)
+    if (CreateModelCache(&VROMCache, NUM_STATIC_VERTS, NUM_LOCAL_VERTS, NUM_STATIC_MODELS, NUM_DISPLAY_LIST_ITEMS, false) != Result::OKAY)
         return Result::FAIL;
-    if (CreateModelCache(&PolyCache, NUM_DYNAMIC_VERTS, NUM_LOCAL_VERTS, NUM_DYNAMIC_MODELS, 0x4000000 / 4, NUM_DISPLAY_LIST_ITEMS, true) != Result::OKAY)
+    if (CreateModelCache(&PolyCache, NUM_DYNAMIC_VERTS, NUM_LOCAL_VERTS, NUM_DYNAMIC_MODELS, NUM_DISPLAY_LIST_ITEMS, true) != Result::OKAY)
         return Result::FAIL;
 
     // Initialize lighting parameters (updated as viewports are traversed)
@@ -1357,6 +1374,8 @@ float CLegacy3D::GetLosValue(int layer)
 
 CLegacy3D::CLegacy3D(const Util::Config::Node &config)
   : m_config(config),
+    m_wideScreen(config, "WideScreen"),
+    m_noWhiteFlash(config, "NoWhiteFlash"),
     m_aaTarget(0)
 { 
   cullingRAMLo = NULL;
@@ -1391,8 +1410,6 @@ CLegacy3D::CLegacy3D(const Util::Config::Node &config)
     PolyCache.verts[i] = NULL;
     VROMCache.Models = NULL;
     PolyCache.Models = NULL;
-    VROMCache.lut = NULL;
-    PolyCache.lut = NULL;
     VROMCache.List = NULL;
     PolyCache.List = NULL;
     VROMCache.ListHead[i] = NULL;
@@ -1400,6 +1417,9 @@ CLegacy3D::CLegacy3D(const Util::Config::Node &config)
     VROMCache.ListTail[i] = NULL;
     PolyCache.ListTail[i] = NULL;
   }
+  VROMCache.vboID = PolyCache.vboID = 0;
+  VROMCache.copyBufferID = PolyCache.copyBufferID = 0;
+  VROMCache.frame = PolyCache.frame = 0;
 
   SetupGLObjects();
   
@@ -35,6 +35,8 @@
 #include <GL/glew.h>
 #include "Util/NewConfig.h"
 #include "Types.h"
+#include <unordered_map>
+#include <vector>
 
 namespace Legacy3D {
 
@@ -71,7 +73,7 @@ struct Poly
  *
  * Reference to model polygons stored in a VBO. Each reference has two sets of
  * vertices: normal and alpha. Copies of the model with different texture
- * offsets applied are searchable via the linked list of texture offset states.
+ * offsets applied are separate references, indexed by texture offset state.
  *
  * Technically, a model may contain a mix of layered and non-layered polygons
  * but we can't support that level of granularity in the current engine. The 
@@ -85,9 +87,9 @@ struct VBORef
 {
 	unsigned index[2];		// index of model polygons in VBO
 	unsigned numVerts[2]; // number of vertices
-	unsigned lutIdx;      // LUT index associated with this model (for fast LUT clearing)
+	unsigned lutIdx;      // LUT index associated with this model (for removal from the index)
+	unsigned lastUsed;    // frame the model was last drawn in (for LRU eviction)
 	
-	VBORef *nextTextureOffsetState; // linked list of models with different texture offset states
 	uint16_t textureOffsetState;    // texture offset data for this model
 	bool useStencil;                // whether to draw with stencil mask ("layered" polygons)
 	
@@ -103,8 +105,8 @@ struct VBORef
 	{
 		texRefs.Clear();
 		lutIdx = 0;
+		lastUsed = 0;
 		textureOffsetState = 0;
-		nextTextureOffsetState = NULL;
 		useStencil = false;
 		for (int i = 0; i < 2; i++)
 		{
@@ -153,15 +155,12 @@ struct DisplayList
  * ModelCache:
  *
  * A model cache tracks all models in a particular region (ie., VROM or polygon
- * RAM). It contains a look-up table to quickly obtain VBO indices. Be careful
- * when accessing the LUT, there are some special cases.
+ * RAM). It contains a hashed index, keyed by LUT index (model address) and
+ * texture offset state, to quickly obtain VBO indices.
  *
- * If the model cache is marked dynamic, cached models may not necessarily be
- * retained. Clearing the model cache is also much faster. The LUT entry for 
- * the last model cached will be valid, but because the LUT may not be
- * cleared, one cannot assume a model exists because there is a LUT entry
- * pointing to it. Always use NeedToCache() to determine whether caching is
- * necessary before reading the LUT!
+ * If the model cache is marked dynamic, cached models are not retained from
+ * one frame to the next. A static cache that fills up evicts its least
+ * recently used models and compacts the VBO (see EvictModels()).
  */
 struct ModelCache
 {
@@ -180,19 +179,16 @@ struct ModelCache
 	
 	// Array of cached models
 	unsigned	maxModels;	// maximum number of models
-	unsigned	numModels;	// current number stored
+	unsigned	numModels;	// number of Models[] entries used so far, including evicted ones
 	VBORef		*Models;
+	std::vector<unsigned>	freeModels;	// evicted Models[] entries, reused before numModels grows
 	
-	/*
-	 * Look-Up Table:
-	 *
-	 * Can be accessed directly with a LUT index to determine the model index.
-	 * However, it should not be used to determine whether a model needs to be
-	 * cached. Use NeedToCache() instead. A valid index, for example, may still
-	 * have to be re-cached if the model cache is dynamic (polygon RAM).
-	 */
-	unsigned	lutSize;	// number of elements in LUT
-	INT16		*lut;		// stores indices into Models[] or -1 if not yet cached
+	// Index: model key (see ModelKey()) -> Models[] entry
+	std::unordered_map<UINT64, unsigned>	index;
+	
+	// LRU eviction (static caches only)
+	unsigned	frame;			// current frame number, stored in VBORef::lastUsed
+	GLuint		copyBufferID;	// scratch buffer for moving vertices when compacting (0 if unavailable)
 
 	// Display list
 	unsigned	maxListSize;	// maximum number of display list items
@@ -351,6 +347,14 @@ public:
 	*/
 	void SetBlockCulling(bool enable);
 
+	/*
+	 * GetStats(void):
+	 *
+	 * Returns:
+	 *		Model cache hits, misses and evictions of the last frame.
+	 */
+	Render3DStats GetStats(void) const;
+
 	/*
 	* GetLosValue(int layer);
 	*
@@ -394,8 +398,10 @@ private:
 	void			EndModel(ModelCache *cache, struct VBORef *Model, int lutIdx, UINT16 textureOffsetState, bool useStencil);
 	struct VBORef	*CacheModel(ModelCache *cache, int lutIdx, UINT16 textureOffsetState, const UINT32 *data);
 	struct VBORef	*LookUpModel(ModelCache *cache, int lutIdx, UINT16 textureOffsetState);
+	void 			EvictModels(ModelCache *cache);
+	void 			CompactModelCache(ModelCache *cache, std::vector<unsigned> &live);
 	void 			ClearModelCache(ModelCache *cache);
-	Result 			CreateModelCache(ModelCache *cache, unsigned vboMaxVerts, unsigned localMaxVerts, unsigned maxNumModels, unsigned numLUTEntries, unsigned displayListSize, bool isDynamic);
+	Result 			CreateModelCache(ModelCache *cache, unsigned vboMaxVerts, unsigned localMaxVerts, unsigned maxNumModels, unsigned displayListSize, bool isDynamic);
 	void 			DestroyModelCache(ModelCache *cache);
 	
 	// Texture management
@@ -425,6 +431,8 @@ private:
 	 */
   
   const Util::Config::Node &m_config;
+  Util::Config::Setting<bool> m_wideScreen;
+  Util::Config::Setting<bool> m_noWhiteFlash;
 	
 #ifdef DEBUG
 	// Debug
@@ -545,6 +553,8 @@ private:
 	// Model caching
 	ModelCache	VROMCache;	// VROM (static) models
 	ModelCache	PolyCache;	// polygon RAM (dynamic) models
+	Render3DStats	m_frameStats;		// model cache counters of the frame being rendered
+	Render3DStats	m_lastFrameStats;	// ... and of the last complete one
 	
 	/*
  	 * Texture Decode Buffer
@@ -103,6 +103,7 @@
  *   texture base coordinates are not re-decoded in two different places!
  */
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include "Supermodel.h"
@@ -919,10 +920,22 @@ Result CLegacy3D::InsertPolygon(ModelCache *Cache, const Poly *P)
   return Result::OKAY;
 }
 
+// Key of a model in the model cache index
+static inline UINT64 ModelKey(unsigned lutIdx, UINT16 textureOffsetState)
+{
+  return ((UINT64)lutIdx << 16) | textureOffsetState;
+}
+
 // Begins caching a new model by resetting to the start of the local vertex buffer
 struct VBORef *CLegacy3D::BeginModel(ModelCache *Cache)
 {
-  size_t  m = Cache->numModels;
+  size_t  m;
+  
+  // Reuse an evicted entry if there is one, otherwise take a new one
+  if (!Cache->freeModels.empty())
+    m = Cache->freeModels.back();
+  else
+    m = Cache->numModels;
   
   // Determine whether we've exceeded the model cache limits (caller will have to recache)
   if (m >= Cache->maxModels)
@@ -950,7 +963,11 @@ struct VBORef *CLegacy3D::BeginModel(ModelCache *Cache)
 // Uploads all vertices from the local vertex buffer to the VBO, sets up the VBO reference, updates the LUT
 void CLegacy3D::EndModel(ModelCache *Cache, struct VBORef *Model, int lutIdx, UINT16 textureOffsetState, bool useStencil)
 {
-  int m = Cache->numModels++;
+  unsigned m = unsigned(Model - Cache->Models);
+  if (m == Cache->numModels)
+    Cache->numModels++;
+  else
+    Cache->freeModels.pop_back(); // BeginModel() picked the last evicted entry
 
   // Record the number of vertices, completing the VBORef
   for (size_t i = 0; i < 2; i++)
@@ -975,10 +992,9 @@ void CLegacy3D::EndModel(ModelCache *Cache, struct VBORef *Model, int lutIdx, UI
   // Should we use stencil?
   Model->useStencil = useStencil;
   
-  // Update the LUT and link up to any existing model that already exists here
-  if (Cache->lut[lutIdx] >= 0)  // another texture offset state already cached
-    Model->nextTextureOffsetState = &(Cache->Models[Cache->lut[lutIdx]]);
-  Cache->lut[lutIdx] = m;
+  // Enter the model into the index
+  Model->lastUsed = Cache->frame;
+  Cache->index[ModelKey(lutIdx, textureOffsetState)] = m;
 }
 
 /*
@@ -1161,20 +1177,112 @@ struct VBORef *CLegacy3D::CacheModel(ModelCache *Cache, int lutIdx, UINT16 textu
  */
 struct VBORef *CLegacy3D::LookUpModel(ModelCache *Cache, int lutIdx, UINT16 textureOffsetState)
 {
-  int m = Cache->lut[lutIdx];
+  auto it = Cache->index.find(ModelKey(lutIdx, textureOffsetState));
+  if (it == Cache->index.end())
+    return NULL;  // no match found, we must cache this new model state
   
-  // Has any state associated with this model LUT index been cached at all?
-  if (m < 0)
-    return NULL;
+  struct VBORef *Model = &(Cache->Models[it->second]);
+  Model->lastUsed = Cache->frame;
+  return Model;
+}
+
+/*
+ * EvictModels():
+ *
+ * Makes room in a full static cache. The least recently used models are
+ * evicted until at most half of the VBO and of the model array are in use,
+ * then the remaining models are moved together at the start of the VBO.
+ * Models drawn in the current frame go last. Display lists refer to VBO
+ * locations and must have been drawn and cleared beforehand.
+ */
+void CLegacy3D::EvictModels(ModelCache *Cache)
+{
+  // Without a way to move vertices around, the only option is to start over
+  if (0 == Cache->copyBufferID)
+  {
+    m_frameStats.cacheEvictions += unsigned(Cache->index.size());
+    ClearModelCache(Cache);
+    return;
+  }
+  
+  std::vector<unsigned> live;
+  live.reserve(Cache->index.size());
+  for (auto &entry: Cache->index)
+    live.push_back(entry.second);
+  std::sort(live.begin(), live.end(), [Cache](unsigned a, unsigned b) { return Cache->Models[a].lastUsed < Cache->Models[b].lastUsed; });
+  
+  size_t usedVerts = 0;
+  for (unsigned m: live)
+    usedVerts += Cache->Models[m].numVerts[POLY_STATE_NORMAL] + Cache->Models[m].numVerts[POLY_STATE_ALPHA];
+  
+  const size_t maxVerts = Cache->vboMaxOffset/(VBO_VERTEX_SIZE*sizeof(GLfloat));
+  size_t numEvicted = 0;
+  while (numEvicted < live.size() && (usedVerts > maxVerts/2 || live.size()-numEvicted > Cache->maxModels/2))
+  {
+    unsigned m = live[numEvicted++];
+    struct VBORef *Model = &(Cache->Models[m]);
+    usedVerts -= Model->numVerts[POLY_STATE_NORMAL] + Model->numVerts[POLY_STATE_ALPHA];
+    Cache->index.erase(ModelKey(Model->lutIdx, Model->textureOffsetState));
+    Model->Clear();
+    Cache->freeModels.push_back(m);
+  }
+  m_frameStats.cacheEvictions += unsigned(numEvicted);
+  
+  live.erase(live.begin(), live.begin() + numEvicted);
+  CompactModelCache(Cache, live);
+}
+
+/*
+ * CompactModelCache():
+ *
+ * Moves the vertices of the given models (Models[] entries) down to the start
+ * of the VBO, in their current order, leaving all free space at the end. Runs
+ * of adjacent models are moved together, through the scratch buffer because
+ * source and destination may overlap.
+ */
+void CLegacy3D::CompactModelCache(ModelCache *Cache, std::vector<unsigned> &live)
+{
+  const size_t vertexBytes = VBO_VERTEX_SIZE*sizeof(GLfloat);
+  
+  std::sort(live.begin(), live.end(), [Cache](unsigned a, unsigned b) { return Cache->Models[a].index[POLY_STATE_NORMAL] < Cache->Models[b].index[POLY_STATE_NORMAL]; });
+  
+  glBindBuffer(GL_COPY_READ_BUFFER, Cache->vboID);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, Cache->copyBufferID);
   
-  // Has the specified texture offset been cached?
-  for (struct VBORef *Model = &(Cache->Models[m]); Model != NULL; Model = Model->nextTextureOffsetState)
+  unsigned dest = 0;
+  for (size_t i = 0; i < live.size(); )
   {
-    if (Model->textureOffsetState == textureOffsetState)
-      return Model;
+    // Find the run of models that are adjacent in the VBO and relocate them
+    unsigned src = Cache->Models[live[i]].index[POLY_STATE_NORMAL];
+    unsigned end = src;
+    for (; i < live.size() && Cache->Models[live[i]].index[POLY_STATE_NORMAL] == end; i++)
+    {
+      struct VBORef *Model = &(Cache->Models[live[i]]);
+      end += Model->numVerts[POLY_STATE_NORMAL] + Model->numVerts[POLY_STATE_ALPHA];
+      Model->index[POLY_STATE_NORMAL] -= src - dest;
+      Model->index[POLY_STATE_ALPHA] = Model->index[POLY_STATE_NORMAL] + Model->numVerts[POLY_STATE_NORMAL];
+    }
+    
+    // Move the vertices in chunks the size of the scratch buffer, lowest first,
+    // so nothing is overwritten before it has been read
+    if (src != dest)
+    {
+      for (unsigned done = 0; done < end - src; done += Cache->maxVertIdx)
+      {
+        size_t bytes = std::min(Cache->maxVertIdx, end - src - done)*vertexBytes;
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (src + done)*vertexBytes, 0, bytes);
+        glCopyBufferSubData(GL_COPY_WRITE_BUFFER, GL_COPY_READ_BUFFER, 0, (dest + done)*vertexBytes, bytes);
+      }
+    }
+    dest += end - src;
   }
   
-  return NULL;  // no match found, we must cache this new model state
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  
+  Cache->vboCurOffset = dest*vertexBytes;
+  for (size_t i = 0; i < 2; i++)
+    Cache->curVertIdx[i] = 0;
 }
 
 // Discard all models in the cache and the display list
@@ -1183,18 +1291,19 @@ void CLegacy3D::ClearModelCache(ModelCache *Cache)
   Cache->vboCurOffset = 0;
   for (size_t i = 0; i < 2; i++)
     Cache->curVertIdx[i] = 0;
-  for (size_t i = 0; i < Cache->numModels; i++)
-    Cache->lut[Cache->Models[i].lutIdx] = -1;
+  Cache->index.clear();
+  Cache->freeModels.clear();
 
   Cache->numModels = 0;
   ClearDisplayList(Cache);
 }
 
 Result CLegacy3D::CreateModelCache(ModelCache *Cache, unsigned vboMaxVerts,
-                 unsigned localMaxVerts, unsigned maxNumModels, unsigned numLUTEntries, 
+                 unsigned localMaxVerts, unsigned maxNumModels,
                  unsigned displayListSize, bool isDynamic)
 {
   Cache->dynamic = isDynamic;
+  Cache->frame = 0;
   
   /*
    * VBO allocation:
@@ -1254,9 +1363,11 @@ Result CLegacy3D::CreateModelCache(ModelCache *Cache, unsigned vboMaxVerts,
   Cache->maxModels = maxNumModels;
   Cache->numModels = 0;
   
-  // ... LUT
-  Cache->lut = new(std::nothrow) INT16[numLUTEntries];
-  Cache->lutSize = numLUTEntries;
+  // ... index
+  Cache->index.clear();
+  Cache->index.reserve(maxNumModels);
+  Cache->freeModels.clear();
+  Cache->freeModels.reserve(maxNumModels);
   
   // ... display list
   Cache->List = new(std::nothrow) DisplayList[displayListSize];
@@ -1264,15 +1375,31 @@ Result CLegacy3D::CreateModelCache(ModelCache *Cache, unsigned vboMaxVerts,
   Cache->maxListSize = displayListSize;
   
   // Check if memory allocation succeeded
-  if ((Cache->verts[0]==NULL) || (Cache->verts[1]==NULL) || (Cache->Models==NULL) || (Cache->lut==NULL) || (Cache->List==NULL))
+  if ((Cache->verts[0]==NULL) || (Cache->verts[1]==NULL) || (Cache->Models==NULL) || (Cache->List==NULL))
   {
     DestroyModelCache(Cache);
     return ErrorLog("Insufficient memory for model cache.");
   }
 
-  // Clear LUT (MUST be done here because ClearModelCache() won't do it for dynamic models)
-  for (size_t i = 0; i < numLUTEntries; i++)
-    Cache->lut[i] = -1;
+  // Scratch buffer for compacting static caches. Without it (no buffer copies
+  // before OpenGL 3.1), a full cache is cleared instead.
+  Cache->copyBufferID = 0;
+#if !defined(ANDROID) && !defined(CORE_GLES)
+  if (!isDynamic && glCopyBufferSubData != NULL)
+#else
+  if (!isDynamic)
+#endif
+  {
+    glGenBuffers(1, &(Cache->copyBufferID));
+    glBindBuffer(GL_COPY_WRITE_BUFFER, Cache->copyBufferID);
+    glBufferData(GL_COPY_WRITE_BUFFER, localBytes, nullptr, GL_STREAM_COPY);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    if (glGetError() != GL_NO_ERROR)
+    {
+      glDeleteBuffers(1, &(Cache->copyBufferID));
+      Cache->copyBufferID = 0;
+    }
+  }
 
   // All good!
   return Result::OKAY;
@@ -1281,16 +1408,34 @@ Result CLegacy3D::CreateModelCache(ModelCache *Cache, unsigned vboMaxVerts,
 void CLegacy3D::DestroyModelCache(ModelCache *Cache)
 {
   glDeleteBuffers(1, &(Cache->vboID));
+  if (Cache->copyBufferID != 0)
+    glDeleteBuffers(1, &(Cache->copyBufferID));
 
   for (size_t i = 0; i < 2; i++)
   {
     delete [] Cache->verts[i];
   }
   delete [] Cache->Models;
-  delete [] Cache->lut;
   delete [] Cache->List;
 
-  memset(Cache, 0, sizeof(ModelCache));
+  std::unordered_map<UINT64, unsigned>().swap(Cache->index);
+  std::vector<unsigned>().swap(Cache->freeModels);
+  Cache->dynamic = false;
+  Cache->vboMaxOffset = Cache->vboCurOffset = 0;
+  Cache->vboID = Cache->copyBufferID = 0;
+  Cache->maxVertIdx = 0;
+  Cache->maxModels = Cache->numModels = 0;
+  Cache->maxListSize = Cache->listSize = 0;
+  Cache->frame = 0;
+  for (size_t i = 0; i < 2; i++)
+  {
+    Cache->curVertIdx[i] = 0;
+    Cache->verts[i] = NULL;
+    Cache->ListHead[i] = NULL;
+    Cache->ListTail[i] = NULL;
+  }
+  Cache->Models = NULL;
+  Cache->List = NULL;
 }
 
 } // Legacy3D
@@ -1,6 +1,9 @@
 #include "Mat4.h"
 #include <cmath>
+#include <cstring>
 #include <utility>
+#include "Util/SIMD.h"
+#include "Vec.h"
 
 #ifndef M_PI
 #define M_PI 3.1415926535897932384626433832795
@@ -25,6 +28,43 @@ void Mat4::LoadIdentity()
 
 void Mat4::MultiMatrices(const float a[16], const float b[16], float r[16]) 
 {
+	// r may alias a, so all of a is loaded before anything is stored.
+	// The vector paths accumulate each column in the same order as the scalar code so results match.
+
+#if defined(SUPERMODEL_SIMD_SSE2)
+
+	const __m128 a0 = _mm_loadu_ps(a + 0);
+	const __m128 a1 = _mm_loadu_ps(a + 4);
+	const __m128 a2 = _mm_loadu_ps(a + 8);
+	const __m128 a3 = _mm_loadu_ps(a + 12);
+
+	for (int i = 0; i < 4; i++) {
+		const float* bc = b + (i << 2);
+		__m128 p = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+		p = _mm_add_ps(p, _mm_mul_ps(a1, _mm_set1_ps(bc[1])));
+		p = _mm_add_ps(p, _mm_mul_ps(a2, _mm_set1_ps(bc[2])));
+		p = _mm_add_ps(p, _mm_mul_ps(a3, _mm_set1_ps(bc[3])));
+		_mm_storeu_ps(r + (i << 2), p);
+	}
+
+#elif defined(SUPERMODEL_SIMD_NEON)
+
+	const float32x4_t a0 = vld1q_f32(a + 0);
+	const float32x4_t a1 = vld1q_f32(a + 4);
+	const float32x4_t a2 = vld1q_f32(a + 8);
+	const float32x4_t a3 = vld1q_f32(a + 12);
+
+	for (int i = 0; i < 4; i++) {
+		const float* bc = b + (i << 2);
+		float32x4_t p = vmulq_n_f32(a0, bc[0]);
+		p = vaddq_f32(p, vmulq_n_f32(a1, bc[1]));		// separate mul/add rather than vmla so rounding matches the scalar path
+		p = vaddq_f32(p, vmulq_n_f32(a2, bc[2]));
+		p = vaddq_f32(p, vmulq_n_f32(a3, bc[3]));
+		vst1q_f32(r + (i << 2), p);
+	}
+
+#else
+
 #define A(row,col)  a[(col<<2)+row]
 #define B(row,col)  b[(col<<2)+row]
 #define P(row,col)  r[(col<<2)+row]
@@ -39,14 +79,45 @@ void Mat4::MultiMatrices(const float a[16], const float b[16], float r[16])
 
 #undef A
 #undef B
-#undef p
+#undef P
+
+#endif
 }
 
-void Mat4::Copy(const float in[16], float out[16])
+void Mat4::TransformPoint(const float m[16], const float in[4], float out[4])
 {
-	for (int i = 0; i<16; i++) {
-		out[i] = in[i];
+	// same accumulation order on every path, like MultiMatrices()
+
+#if defined(SUPERMODEL_SIMD_SSE2)
+
+	__m128 p = _mm_mul_ps(_mm_loadu_ps(m + 0), _mm_set1_ps(in[0]));
+	p = _mm_add_ps(p, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(in[1])));
+	p = _mm_add_ps(p, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(in[2])));
+	p = _mm_add_ps(p, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(in[3])));
+	_mm_storeu_ps(out, p);
+
+#elif defined(SUPERMODEL_SIMD_NEON)
+
+	float32x4_t p = vmulq_n_f32(vld1q_f32(m + 0), in[0]);
+	p = vaddq_f32(p, vmulq_n_f32(vld1q_f32(m + 4), in[1]));
+	p = vaddq_f32(p, vmulq_n_f32(vld1q_f32(m + 8), in[2]));
+	p = vaddq_f32(p, vmulq_n_f32(vld1q_f32(m + 12), in[3]));
+	vst1q_f32(out, p);
+
+#else
+
+	const float x = in[0], y = in[1], z = in[2], w = in[3];
+
+	for (int r = 0; r < 4; r++) {
+		out[r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
 	}
+
+#endif
+}
+
+void Mat4::Copy(const float in[16], float out[16])
+{
+	memcpy(out, in, sizeof(float) * 16);
 }
 
 void Mat4::Translate(float x, float y, float z) 
@@ -111,15 +182,13 @@ void Mat4::Rotate(float angle, float x, float y, float z)
 {
 	// normalise vector first
 	{
-		//========
-		float inv_len;
-		//========
-
-		inv_len = 1.f/std::sqrt(x * x + y * y + z * z);
-		
-		x *= inv_len;
-		y *= inv_len;
-		z *= inv_len;
+		V3::Vec3 axis = { x, y, z };
+
+		V3::normalise(axis);
+
+		x = axis[0];
+		y = axis[1];
+		z = axis[2];
 	}
 
 	float c = std::cos(angle*(float)(M_PI / 180.0));
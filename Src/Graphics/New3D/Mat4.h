@@ -27,6 +27,8 @@ public:
 	void PopMatrix				();
 	void Release				();
 
+	static void TransformPoint	(const float m[16], const float in[4], float out[4]);	// out = m * in, out may alias in
+
 	operator float*				()       { return currentMatrix; }
 	operator const float*		() const { return currentMatrix; }
 	
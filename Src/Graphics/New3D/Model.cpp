@@ -1,4 +1,8 @@
 #include "Model.h"
+#include "Vec.h"
+#include "Util/BitCast.h"
+#include <cmath>
+#include <algorithm>
 
 namespace New3D {
 
@@ -72,4 +76,103 @@ void NodeAttributes::Reset()
 	m_vecAttribs.clear();
 }
 
+PackedVertex::PackedVertex(const FVertex& v)
+{
+	for (int i = 0; i < 3; i++) { pos[i] = v.pos[i]; }
+	for (int i = 0; i < 2; i++) { texcoords[i] = v.texcoords[i]; }
+	for (int i = 0; i < 4; i++) { faceColour[i] = v.faceColour[i]; }
+
+	normal = PackNormal(v.normal);
+
+	// the face normal is 2.22 fixed point so can fall outside the snorm range, normalise it rather than let clamping bend it
+	float fn[3] = { v.faceNormal[0], v.faceNormal[1], v.faceNormal[2] };
+
+	if (V3::length(fn) > 0.0f) {
+		V3::normalise(fn);
+	}
+
+	faceNormal	= PackNormal(fn);
+	fixedShade	= FloatToHalf(v.fixedShade);
+	textureNP	= FloatToHalf(v.textureNP);
+}
+
+UINT32 PackedVertex::PackNormal(const float n[3])
+{
+	UINT32 packed = 0;
+
+	for (int i = 0; i < 3; i++) {
+		int c = (int)std::lround(std::clamp(n[i], -1.0f, 1.0f) * 511.0f);
+		packed |= ((UINT32)c & 0x3FF) << (i * 10);
+	}
+
+	return packed;
+}
+
+UINT16 PackedVertex::FloatToHalf(float f)
+{
+	UINT32 x	= (UINT32)Util::FloatAsInt32(f);
+	UINT32 sign	= (x >> 16) & 0x8000;
+	INT32 exp	= (INT32)((x >> 23) & 0xFF) - 127 + 15;
+	UINT32 mant	= x & 0x7FFFFF;
+
+	if (exp >= 31) {
+		return (UINT16)(sign | 0x7C00);				// too big (or inf/nan), saturate to inf
+	}
+
+	if (exp <= 0) {									// denormal or zero
+
+		if (exp < -10) {
+			return (UINT16)sign;
+		}
+
+		mant |= 0x800000;
+
+		UINT32 shift	= (UINT32)(14 - exp);
+		UINT32 half		= mant >> shift;
+		UINT32 rem		= mant & ((1u << shift) - 1);
+		UINT32 halfway	= 1u << (shift - 1);
+
+		if (rem > halfway || (rem == halfway && (half & 1))) {
+			half++;
+		}
+
+		return (UINT16)(sign | half);
+	}
+
+	UINT32 half	= sign | ((UINT32)exp << 10) | (mant >> 13);
+	UINT32 rem	= mant & 0x1FFF;
+
+	if (rem > 0x1000 || (rem == 0x1000 && (half & 1))) {
+		half++;										// a carry into the exponent is still the correctly rounded value
+	}
+
+	return (UINT16)half;
+}
+
+void PackedVertex::UnpackNormal(UINT32 packed, float n[3])
+{
+	for (int i = 0; i < 3; i++) {
+		INT32 c = (INT32)(packed << (22 - i * 10)) >> 22;		// sign extend the 10 bit field
+		n[i] = std::max((float)c / 511.0f, -1.0f);				// same as GL's signed normalised conversion
+	}
+}
+
+float PackedVertex::HalfToFloat(UINT16 h)
+{
+	UINT32 sign	= (UINT32)(h & 0x8000) << 16;
+	UINT32 exp	= (h >> 10) & 0x1F;
+	UINT32 mant	= h & 0x3FF;
+
+	if (exp == 0) {									// denormal or zero
+		float f = (float)mant * (1.0f / 16777216.0f);
+		return sign ? -f : f;
+	}
+
+	if (exp == 31) {
+		return Util::Uint32AsFloat(sign | 0x7F800000 | (mant << 13));
+	}
+
+	return Util::Uint32AsFloat(sign | ((exp + 112) << 23) | (mant << 13));
+}
+
 } // New3D
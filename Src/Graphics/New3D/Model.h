@@ -83,6 +83,27 @@ struct FVertex : Vertex			// full vertex including face attributes
 	}
 };
 
+struct PackedVertex				// the vertex as stored in the vbo, 36 bytes instead of the 60 of FVertex
+{
+	float	pos[3];					// w is always 1, the shader gets it from the attribute default
+	UINT32	normal;					// signed normalised 10:10:10:2, the source normals are only 8 bit anyway
+	float	texcoords[2];			// repeating textures take these well outside the 16 bit / half float range
+	UINT32	faceNormal;				// signed normalised 10:10:10:2, only its direction matters for the culling test
+	UINT8	faceColour[4];
+	UINT16	fixedShade;				// half float
+	UINT16	textureNP;				// half float
+
+	PackedVertex() {}
+	explicit PackedVertex(const FVertex& v);
+
+	static UINT32 PackNormal(const float n[3]);
+	static UINT16 FloatToHalf(float f);
+
+	// the reverse, for renderers that read the vertices back on the cpu
+	static void UnpackNormal(UINT32 packed, float n[3]);
+	static float HalfToFloat(UINT16 h);
+};
+
 enum class Layer { colour, trans1, trans2, trans12 /*both 1&2*/, all, none };
 
 struct Mesh
@@ -160,11 +181,9 @@ struct Mesh
 	// opengl resources
 	int vboOffset		= 0;			// this will be calculated later
 	int vertexCount		= 0;			// /3 for triangles /4 for quads
-};
 
-struct SortingMesh : public Mesh		// This struct temporarily holds the model data, before it gets copied to the main buffer
-{
-	std::vector<FVertex> verts;
+	// meshes with the same key have identical render state so can share a draw call if the model states match
+	UINT64 stateKey		= 0;
 };
 
 struct Model
@@ -187,6 +206,17 @@ struct Model
 
 	//node transparency
 	float alpha = 1.0f;
+
+	// true if drawing this model sets exactly the same model uniforms as the other
+	bool SameState(const Model& other) const
+	{
+		return	textureOffsetX == other.textureOffsetX &&
+				textureOffsetY == other.textureOffsetY &&
+				page == other.page &&
+				scale == other.scale &&
+				alpha == other.alpha &&
+				memcmp(modelMat, other.modelMat, sizeof(modelMat)) == 0;
+	}
 };
 
 struct Viewport
@@ -28,27 +28,19 @@
 #ifndef INCLUDED_NEW3D_H
 #define INCLUDED_NEW3D_H
 
-#include <unordered_map>
-#include <atomic>
 #include <GL/glew.h>
 #include "Types.h"
-#include "Graphics/IRender3D.h"
-#include "Model.h"
-#include "Mat4.h"
+#include "New3DScene.h"
 #include "R3DShader.h"
 #include "VBO.h"
-#include "R3DData.h"
-#include "Plane.h"
 #include "Vec.h"
 #include "R3DScrollFog.h"
-#include "PolyHeader.h"
 #include "R3DFrameBuffers.h"
-#include <mutex>
 #include "TextureBank.h"
 
 namespace New3D {
 
-class CNew3D final : public IRender3D
+class CNew3D final : public CNew3DScene
 {
 public:
 	/*
@@ -93,33 +85,13 @@ public:
 	* AttachMemory(cullingRAMLoPtr, cullingRAMHiPtr, polyRAMPtr, vromPtr,
 	* 				textureRAMPtr):
 	*
-	* Attaches RAM and ROM areas. This must be done prior to any rendering
-	* otherwise the program may crash with an access violation.
-	*
-	* Parameters:
-	*		cullingRAMLoPtr		Pointer to low culling RAM (4 MB).
-	*		cullingRAMHiPtr		Pointer to high culling RAM (1 MB).
-	*		polyRAMPtr			Pointer to polygon RAM (4 MB).
-	*		vromPtr				Pointer to video ROM (64 MB).
-	*		textureRAMPtr		Pointer to texture RAM (8 MB).
+	* Attaches RAM and ROM areas, see CNew3DScene. Texture RAM is also
+	* attached to the texture banks.
 	*/
 	void AttachMemory(const UINT32 *cullingRAMLoPtr,
 		const UINT32 *cullingRAMHiPtr, const UINT32 *polyRAMPtr,
 		const UINT32 *vromPtr, const UINT16 *textureRAMPtr);
 
-	/*
-	* SetStepping(stepping):
-	*
-	* Sets the Model 3 hardware stepping, which also determines the Real3D
-	* functionality. The default is Step 1.0. This should be called prior to
-	* any other emulation functions and after Init().
-	*
-	* Parameters:
-	*   stepping  0x10 for Step 1.0, 0x15 for Step 1.5, 0x20 for Step 2.0, or
-	*             0x21 for Step 2.1. Anything else defaults to 1.0.
-	*/
-	void SetStepping(int stepping);
-
 	/*
 	* Init(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes):
 	*
@@ -146,34 +118,11 @@ public:
 	Result Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes, unsigned aaTarget);
 
 	/*
-	* SetSunClamp(bool enable);
+	* GetStats(void);
 	*
-	* Sets or unsets the clamped light model
-	*
-	* Parameters:
-	*		enable	Set clamp mode
+	* Returns draw call and state change counters for the last rendered frame
 	*/
-	void SetSunClamp(bool enable);
-
-	/*
-	* SetBlockCulling(bool enable);
-	*
-	* When enabled, clears screen to white and disables 3D rendering
-	*
-	* Parameters:
-	*		enable	Set block culling
-	*/
-	void SetBlockCulling(bool enable);
-
-	/*
-	* GetLosValue(int layer);
-	*
-	* Gets the line of sight value for the priority layer
-	*
-	* Parameters:
-	*		layer	Priority layer to read from
-	*/
-	float GetLosValue(int layer);
+	Render3DStats GetStats(void) const;
 
 	/*
 	* CRender3D(config):
@@ -192,127 +141,41 @@ private:
 	* Private Members
 	*/
 
-	// Real3D address translation
-	const UINT32 *TranslateCullingAddress(UINT32 addr);
-	const UINT32 *TranslateModelAddress(UINT32 addr);
-
-	// Matrix stack
-	void MultMatrix(UINT32 matrixOffset, Mat4& mat);
-	void InitMatrixStack(UINT32 matrixBaseAddr, Mat4& mat);
-	void ResetMatrix(Mat4& mat) const;
-
-	// Scene database traversal
-	bool DrawModel(UINT32 modelAddr);
-	void DescendCullingNode(UINT32 addr);
-	void DescendPointerList(UINT32 addr);
-	void DescendNodePtr(UINT32 nodeAddr);
-	void RenderViewport(UINT32 addr);
-
-	// building the scene
-	int	GetTexFormat(int originalFormat, bool contour) const;
-	void SetMeshValues(SortingMesh *currentMesh, PolyHeader &ph);
-	void CacheModel(Model *m, const UINT32 *data);
-	void CopyVertexData(const R3DPoly& r3dPoly, std::vector<FVertex>& vertexArray);
-	void GetCoordinates(int width, int height, UINT16 uIn, UINT16 vIn, float uvScale, float& uOut, float& vOut) const;
-
 	bool RenderScene(int priority, bool renderOverlay, Layer layer);		// returns if has overlay plane
-	bool IsDynamicModel(UINT32 *data) const;				// check if the model has a colour palette
-	bool IsVROMModel(UINT32 modelAddr) const;
+	void AddToDrawBatch(int first, int count);
+	void FlushDrawBatch();
 	void DrawScrollFog();
 	void DrawAmbientFog();
-	bool SkipLayer(int layer);
 	void SetRenderStates();
 	void DisableRenderStates();
-	void TranslateLosPosition(int inX, int inY, int& outX, int& outY) const;
 	bool ProcessLos(int priority);
 	void CollectLosResults();
-	bool HasTransparentMeshes(int priority, bool renderOverlay) const;
-	void CalcViewport(Viewport* vp);
-	void TranslateTexture(unsigned& x, unsigned& y, int width, int height, int& page) const;
+	void WaitForRamSlot(int slot);		// until the GPU has finished with the dynamic polys last drawn from the slot
 
 	/*
 	* Data
 	*/
 
 	// Misc
-	std::string m_gameName;
-	int m_numPolyVerts;
 	GLenum m_primType;
 
-	// GPU configuration
-	std::atomic_bool m_sunClamp;
-	std::atomic_bool m_blockCulling;
-	bool m_noWhiteFlash;
-
-	// Stepping
-	int		m_step;
-	int		m_offset;			// offset to subtract for words 3 and higher of culling nodes
-	float	m_vertexFactor;		// fixed-point conversion factor for vertices
-	float	m_textureNPFactor;	// fixed-point conversion factor for texture NP values
-
-	// Memory (passed from outside)
-	const UINT32	*m_cullingRAMLo;	// 4 MB
-	const UINT32	*m_cullingRAMHi;	// 1 MB
-	const UINT32	*m_polyRAM;			// 4 MB
-	const UINT32	*m_vrom;			// 64 MB
-	const UINT16	*m_textureRAM;		// 8 MB
-
-	// Resolution and scaling factors (to support resolutions higher than 496x384) and offsets
-	float		m_xRatio, m_yRatio;
-	unsigned	m_xOffs, m_yOffs;
-	unsigned	m_xRes, m_yRes;           // resolution of Model 3's 496x384 display area within the window
-	unsigned 	m_totalXRes, m_totalYRes; // total OpenGL window resolution
-	bool		m_wideScreen;
-
-	// Real3D Base Matrix Pointer
-	const float	*m_matrixBasePtr;
-	UINT32 m_colorTableAddr = 0x400;		// address of color table in polygon RAM
-	LODBlendTable* m_LODBlendTable;
-
-	NodeAttributes	m_nodeAttribs;
-	Mat4			m_modelMat;				// current modelview matrix
-
-	struct LOS
-	{
-		float value[4] = { 0,0,0,0 };		// line of sight value for each priority layer
-	} m_los[2];
-
-	LOS* m_losFront = &m_los[0];			// we need to double buffer this because 3d works in separate thread
-	LOS* m_losBack = &m_los[1];
-	std::mutex m_losMutex;
-
-	Vertex			m_prev[4];				// these are class variables because sega bass fishing starts meshes with shared vertices from the previous one
-	UINT16			m_prevTexCoords[4][2];	// basically relying on undefined behavour
-
-	std::vector<Node>	 m_nodes;				// this represents the entire render frame
-	std::vector<FVertex> m_polyBufferRam;		// dynamic polys
-	std::vector<FVertex> m_polyBufferRom;		// rom polys
-	std::unordered_map<UINT32, std::shared_ptr<std::vector<Mesh>>> m_romMap;	// a hash table for all the ROM models. The meshes don't have model matrices or tex offsets yet
 	TextureBank			m_textureBank[2];
 
 	GLuint m_losPBO[4];
 	bool m_losPendingRead[4];
 
+	std::vector<GLint> m_batchFirst;		// vbo ranges waiting to be drawn with the currently loaded state
+	std::vector<GLsizei> m_batchCount;
+	Render3DStats m_frameStats;				// counters for the frame being drawn
+	Render3DStats m_lastFrameStats;
+
 	GLuint m_vao;
-	VBO m_vbo;								// large VBO: [ROM_VERTS][RAM_VERTS_slot0][RAM_VERTS_slot1]
-	int m_ramSlot = 0;						// alternates 0/1 each frame so write slot != GPU read slot → avoids GLES3 sync stall
+	VBO m_vbo;								// large VBO: [ROM_VERTS][RAM_VERTS_slot0][RAM_VERTS_slot1][RAM_VERTS_slot2], persistently mapped where supported
+	GLsync m_ramSlotFence[NUM_RAM_SLOTS];	// signalled when the frame that last drew from the slot is done
 	R3DShader m_r3dShader;
 	R3DScrollFog m_r3dScrollFog;
 	R3DFrameBuffers m_r3dFrameBuffers;
 	GLuint m_aaTarget;						// optional, maybe zero
-
-	struct
-	{
-		float bnlu;
-		float bnlv;
-		float bntu;
-		float bntw;
-		float bnru;
-		float bnrv;
-		float bnbu;
-		float bnbw;
-		float correction;
-	} m_planes;	
 };
 
 } // New3D
@@ -0,0 +1,1795 @@
+#include "New3DScene.h"
+#include "Vec.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <cstring>
+#include <chrono>
+#include "R3DFloat.h"
+#include "Util/BitCast.h"
+#include "Util/SIMD.h"
+
+#define BYTE_TO_FLOAT(B)	((2.0f * (B) + 1.0f) * (float)(1.0/255.0))
+
+namespace New3D {
+
+CNew3DScene::CNew3DScene(const Util::Config::Node &config, const std::string& gameName) :
+	m_gameName(gameName),
+	m_cullingRAMLo(nullptr),
+	m_cullingRAMHi(nullptr),
+	m_polyRAM(nullptr),
+	m_vrom(nullptr),
+	m_textureRAM(nullptr),
+	m_xRatio(0),
+	m_yRatio(0),
+	m_xOffs(0),
+	m_yOffs(0),
+	m_xRes(0),
+	m_yRes(0),
+	m_totalXRes(0),
+	m_totalYRes(0),
+	m_wideScreen(false),
+	m_matrixBasePtr(nullptr),
+	m_LODBlendTable(nullptr),
+	m_prev{ 0 },
+	m_prevTexCoords{ 0 }
+{
+	m_sunClamp		= true;
+	m_blockCulling	= false;
+	m_numPolyVerts	= config["QuadRendering"].ValueAs<bool>() ? 4 : 3;
+
+	m_wideScreen	= config["WideScreen"].ValueAs<bool>();
+	m_noWhiteFlash	= config["NoWhiteFlash"].ValueAs<bool>();
+}
+
+void CNew3DScene::AttachMemory(const UINT32 *cullingRAMLoPtr, const UINT32 *cullingRAMHiPtr, const UINT32 *polyRAMPtr, const UINT32 *vromPtr, const UINT16 *textureRAMPtr)
+{
+	m_cullingRAMLo	= cullingRAMLoPtr;
+	m_cullingRAMHi	= cullingRAMHiPtr;
+	m_polyRAM		= polyRAMPtr;
+	m_vrom			= vromPtr;
+	m_textureRAM	= textureRAMPtr;
+}
+
+void CNew3DScene::SetStepping(int stepping)
+{
+	m_step = stepping;
+
+	if ((m_step != 0x10) && (m_step != 0x15) && (m_step != 0x20) && (m_step != 0x21)) {
+		m_step = 0x10;
+	}
+
+	if (m_step > 0x10) {
+		m_offset = 0;							// culling nodes are 10 words
+		m_vertexFactor = (1.0f / 2048.0f);		// vertices are in 13.11 format
+		m_textureNPFactor = (1.0f / 16384.0f);	// texture NP values are in 10.14 format
+	}
+	else {
+		m_offset = 2;							// 8 words
+		m_vertexFactor = (1.0f / 128.0f);		// 17.7
+		m_textureNPFactor = (1.0f / 4096.0f);	// 12.12
+	}
+}
+
+void CNew3DScene::SetResolution(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes)
+{
+	// Resolution and offset within physical display area
+	m_xRatio	= xRes * (float)(1.0 / 496.0);
+	m_yRatio	= yRes * (float)(1.0 / 384.0);
+	m_xOffs		= xOffset;
+	m_yOffs		= yOffset;
+	m_xRes		= xRes;
+	m_yRes		= yRes;
+	m_totalXRes	= totalXRes;
+	m_totalYRes = totalYRes;
+}
+
+void CNew3DScene::ReleaseScene()
+{
+	// release any resources from last frame
+	m_polyBufferRam.clear();		// clear dynamic model memory buffer
+	m_ramSlot = (m_ramSlot + 1) % NUM_RAM_SLOTS;
+	m_ramCacheFrame++;
+	m_ramCachePinned = 0;
+	m_ramCacheFull = false;
+	std::swap(m_ramHashesLastFrame, m_ramHashesThisFrame);
+	m_ramHashesThisFrame.clear();
+	m_nodes.clear();				// memory will grow during the object life time, that's fine, no need to shrink to fit
+	m_modelMat.Release();			// would hope we wouldn't need this but no harm in checking
+	m_nodeAttribs.Reset();
+}
+
+void CNew3DScene::BuildScene()
+{
+	m_sceneTimes = SceneTimes();
+
+	auto start = std::chrono::steady_clock::now();
+
+	RenderViewport(0x800000);		// build model structure (vboOffset computed with current m_ramSlot)
+
+	if (m_profiling) {
+		std::chrono::duration<double, std::milli> total = std::chrono::steady_clock::now() - start;
+		m_sceneTimes.traversalMs = total.count() - m_sceneTimes.conversionMs;
+	}
+}
+
+void CNew3DScene::FlushRomModels()
+{
+	// everything gets converted again the next time it's drawn
+	m_polyBufferRom.clear();
+	m_romMap.clear();
+}
+
+bool CNew3DScene::GetScrollFog(FogLayer& layer)
+{
+	// this is my best guess at the logic based upon what games are doing
+	//
+	// ocean hunter		- every viewport has scroll fog values set. Must start with lowest priority layers as the higher ones sometimes are garbage
+	// scud race		- first viewports in priority layer missing scroll values. The latter ones all contain valid scroll values.
+	// daytona			- doesn't seem to use scroll fog at all. Will set scroll values for the first viewports, the end ones contain no scroll values. End credits have scroll fog, but constrained to the viewport
+	// vf3				- first viewport only has it set. But set with highest select value ?? Rest of the viewports in priority layer contain a lower select value
+	// sega bassfishing	- first viewport in priority 1 sets scroll value. The rest all contain the wrong value + a higher select value ..
+	// spikeout final	- 2nd viewport in the priority layer has scroll values set, none of the others do. It also uses the highest select value
+
+	// I think the basic logic is this: the real3d picks the highest scroll fog value, starting from the lowest priority layer. 
+	// If it finds a value for priority layer 0 for example, it then bails out looking for any more.
+	// Fogging seems to be constrained to whatever the viewport is that is set.
+	// Scroll fog needs a density or start value to work, but these can come from another viewport if the fog colour is the same
+
+	// For fullscreen viewports I am fairly certain the fogging aspect is drawn at the mixer level, not directly to the frame buffer, otherwise alpha can't work correctly.
+	// For spotlight on fog, I think it must be drawn with the 3d h/w. Think only ECA uses this, maybe ocean hunter
+
+	Node* nodePtr = nullptr;
+
+	for (int i = 0; i < 4 && !nodePtr; i++) {
+		for (auto &n : m_nodes) {
+			if (n.viewport.priority == i) {
+				if (n.viewport.scrollFog > 0.f) {
+
+					// check to see if we have a higher scroll fog value
+					if (nodePtr) {
+						if (nodePtr->viewport.scrollFog < n.viewport.scrollFog) {
+							nodePtr = &n;
+						}
+
+						continue;
+					}
+
+					nodePtr = &n;
+				}
+			}
+		}
+	}
+
+	if (nodePtr) {
+
+		// iterate nodes to see if any viewports with that fog colour actually set a fog density, start or spotlight on fog
+		// if all of these are zero fogging is effectively disabled
+
+		for (auto& n : m_nodes) {
+
+			if (nodePtr->viewport.fogColour[0] == n.viewport.fogColour[0] &&
+				nodePtr->viewport.fogColour[1] == n.viewport.fogColour[1] &&
+				nodePtr->viewport.fogColour[2] == n.viewport.fogColour[2])
+			{
+
+				// spotlight on fog is disabled if colour = black
+				bool spotOnFogEnabled = false;
+				for (auto c : n.viewport.spotFogColor) {
+					if (c > 0.0f) {
+						spotOnFogEnabled = true;
+						break;
+					}
+				}
+
+				bool fog			= n.viewport.fogDensity > 0.0f || n.viewport.fogStart > 0.0f || n.viewport.scrollAtt > 0.0f;
+				bool spotlightFog	= n.viewport.fogAttenuation > 0.0f && spotOnFogEnabled;
+
+				if (fog || spotlightFog) {
+
+					auto& vp = nodePtr->viewport;
+
+					layer.viewport		= &vp;
+					layer.rgba[0]		= vp.fogColour[0];
+					layer.rgba[1]		= vp.fogColour[1];
+					layer.rgba[2]		= vp.fogColour[2];
+					layer.rgba[3]		= vp.scrollFog;
+
+					layer.attenuation	= (fog && spotlightFog) ? 0.0f : n.viewport.fogAttenuation;	// if regular fog is enabled h/w seems to only apply this and skip the spotlight on fog (ECA)
+					layer.ambient		= n.viewport.fogAmbient;
+
+					memcpy(layer.spotFogColor, n.viewport.spotFogColor, sizeof(layer.spotFogColor));
+					memcpy(layer.spotEllipse, n.viewport.spotEllipse, sizeof(layer.spotEllipse));
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+bool CNew3DScene::GetAmbientFog(FogLayer& layer)
+{
+	// logic here is still not totally understood
+	// some games are setting fog ambient which seems to darken the 2d background layer too when scroll fogging is not set
+	// The logic is something like tileGenColour * fogAmbient
+	// If fogAmbient = 1.0 it's a no-op. Lower values darken the image
+	// Does this work with scroll fog? Well technically scroll fog already takes into account the fog ambient as it darkens the fog colour
+	// Like scroll fog I am sure this works at the mixer level, rather than drawing into the frame buffer.
+
+	// lemans24 every viewport will set ambient fog, scroll attentuation is sometimes set (for every viewport) for explosion effects from car exhaust. So has no effect on ambient fog
+	// otherwise we'll make the ambient fog flash 
+	// sega rally will set ambient fog to zero for every viewport in priority layers 1-3 with a fog density set. Disabled viewports with priority zero have ambient fog disabled (1.0). Don't think srally uses ambient fog
+	// vf3 almost all viewports in all priority layers have ambient fog set (<1.0)
+	// lost world is setting an ambient fog value every every viewport but has no density or fog start value set. Don't think lost world is using ambient fog
+
+	// Let's pick the lowest fog ambient value from only the first priority layer
+	// Check for fog density or a fog start value, otherwise the effect seems to be disabled (lost world)
+
+	float fogAmbient = 1.0f;
+	Node* nodePtr = nullptr;
+
+	for (int i = 0; i < 4; i++) {
+
+		bool hasPriority = false;
+
+		for (auto& n : m_nodes) {
+
+			auto& vp = n.viewport;
+
+			if (vp.priority == i) {
+
+				hasPriority = true;
+				
+				if (vp.scrollFog > 0.0f) {
+					continue;
+				}
+
+				// if we don't have a fog density or fog start skip this viewport
+				if (vp.fogDensity <= 0.0f && vp.fogStart <= 0.0f) {
+					continue;
+				}
+
+				if (vp.fogAmbient < fogAmbient) {
+					nodePtr = &n;
+					fogAmbient = vp.fogAmbient;
+				}
+			}
+		}
+
+		if (nodePtr || hasPriority) {
+			break;
+		}
+
+	}
+
+	if (nodePtr) {
+		auto& vp = nodePtr->viewport;
+
+		layer.viewport		= &vp;
+		layer.rgba[0]		= 0.0f;
+		layer.rgba[1]		= 0.0f;
+		layer.rgba[2]		= 0.0f;
+		layer.rgba[3]		= 1.0f - fogAmbient;
+		layer.attenuation	= 0.0f;		// we assume spot light is not used
+		layer.ambient		= 1.0f;
+
+		memcpy(layer.spotFogColor, vp.spotFogColor, sizeof(layer.spotFogColor));
+		memcpy(layer.spotEllipse, vp.spotEllipse, sizeof(layer.spotEllipse));
+		return true;
+	}
+
+	return false;
+}
+
+bool CNew3DScene::SkipLayer(int layer)
+{
+	for (const auto &n : m_nodes) {
+		if (n.viewport.priority == layer) {
+			if (!n.models.empty()) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/******************************************************************************
+Real3D Address Translation
+
+Functions that interpret word-granular Real3D addresses and return pointers.
+******************************************************************************/
+
+// Translates 24-bit culling RAM addresses
+const UINT32* CNew3DScene::TranslateCullingAddress(UINT32 addr)
+{
+	addr &= 0x00FFFFFF;	// caller should have done this already
+
+	if ((addr >= 0x800000) && (addr < 0x840000)) {
+		return &m_cullingRAMHi[addr & 0x3FFFF];
+	}
+	else if (addr < 0x100000) {
+		return &m_cullingRAMLo[addr];
+	}
+
+	return nullptr;
+}
+
+// Translates model references
+const UINT32* CNew3DScene::TranslateModelAddress(UINT32 modelAddr)
+{
+	modelAddr &= 0x00FFFFFF;	// caller should have done this already
+
+	if (modelAddr < 0x100000) {
+		return &m_polyRAM[modelAddr];
+	}
+	else {
+		return &m_vrom[modelAddr];
+	}
+}
+
+bool CNew3DScene::DrawModel(UINT32 modelAddr)
+{
+	bool cached = false;
+
+	const UINT32* const modelAddress = TranslateModelAddress(modelAddr);
+
+	// create a new model to push onto the vector
+	m_nodes.back().models.emplace_back();
+
+	// get the last model in the array
+	Model* const m = &m_nodes.back().models.back();
+
+	if (IsVROMModel(modelAddr) && !IsDynamicModel((UINT32*)modelAddress)) {
+
+		// try to find meshes in the rom cache
+
+		m->meshes = m_romMap[modelAddr];	// will create an entry with a null pointer if empty
+
+		if (m->meshes) {
+			cached = true;
+		}
+		else {
+			m->meshes = std::make_shared<std::vector<Mesh>>();
+			m_romMap[modelAddr] = m->meshes;		// store meshes in our rom map here
+		}
+
+		m->dynamic = false;
+	}
+	else {
+
+		// polygon RAM models are rebuilt every frame unless their contents haven't changed.
+		// A model seen with the same hash two frames running is converted once into the part of the VBO set aside
+		// for them and reused from then on, until it's evicted to make room for others.
+
+		UINT64 hash;
+		RamModelEntry* entry = nullptr;
+		bool stable = false;
+
+		if (HashModel(modelAddress, hash)) {
+
+			auto it = m_ramModelCache.find(hash);
+
+			if (it != m_ramModelCache.end()) {
+				entry = &it->second;
+			}
+			else {
+				stable = m_ramHashesLastFrame.count(hash) > 0;
+				m_ramHashesThisFrame.insert(hash);
+			}
+		}
+
+		if (entry) {
+			m->meshes	= entry->meshes;
+			m->dynamic	= false;
+			cached		= true;
+
+			if (entry->lastUsed != m_ramCacheFrame) {
+				entry->lastUsed = m_ramCacheFrame;
+				m_ramCachePinned += entry->numVerts;
+				m_ramCacheLru.splice(m_ramCacheLru.end(), m_ramCacheLru, entry->lruPos);	// now the most recently drawn
+			}
+
+			// the next model may share vertices with the end of this one
+			memcpy(m_prev, entry->prev, sizeof(m_prev));
+			memcpy(m_prevTexCoords, entry->prevTexCoords, sizeof(m_prevTexCoords));
+		}
+		else if (stable && !m_ramCacheFull) {
+			Vertex prev[4];
+			UINT16 prevTexCoords[4][2];
+			memcpy(prev, m_prev, sizeof(m_prev));
+			memcpy(prevTexCoords, m_prevTexCoords, sizeof(m_prevTexCoords));
+
+			m->meshes	= std::make_shared<std::vector<Mesh>>();
+			m->dynamic	= false;
+
+			size_t first = m_ramCacheVerts.size();
+			m_cachingRamModel = true;
+			ConvertModel(m, modelAddress);
+			m_cachingRamModel = false;
+			cached		= true;
+
+			if (FitRamCache(m, first)) {
+				RamModelEntry& newEntry = m_ramModelCache[hash];
+				newEntry.meshes		= m->meshes;
+				newEntry.firstVert	= first;
+				newEntry.numVerts	= m_ramCacheVerts.size() - first;
+				newEntry.lastUsed	= m_ramCacheFrame;
+				newEntry.lruPos		= m_ramCacheLru.insert(m_ramCacheLru.end(), hash);
+				m_ramCacheOrder.push_back(hash);
+				m_ramCachePinned	+= newEntry.numVerts;
+				memcpy(newEntry.prev, m_prev, sizeof(m_prev));
+				memcpy(newEntry.prevTexCoords, m_prevTexCoords, sizeof(m_prevTexCoords));
+			}
+			else {
+				// the models drawn this frame fill the cache by themselves, this one and any others new this frame stay dynamic
+				m_ramCacheFull = true;
+				memcpy(m_prev, prev, sizeof(m_prev));
+				memcpy(m_prevTexCoords, prevTexCoords, sizeof(m_prevTexCoords));
+				m->meshes	= std::make_shared<std::vector<Mesh>>();
+				m->dynamic	= true;
+				ConvertModel(m, modelAddress);
+			}
+		}
+		else {
+			m->meshes = std::make_shared<std::vector<Mesh>>();
+		}
+	}
+
+	// copy current model matrix
+	for (int i = 0; i < 16; i++) {
+		m->modelMat[i] = m_modelMat.currentMatrix[i];
+	}
+
+	// update texture offsets
+	m->textureOffsetX	= m_nodeAttribs.currentTexOffsetX;
+	m->textureOffsetY	= m_nodeAttribs.currentTexOffsetY;
+	m->page				= m_nodeAttribs.currentPage;
+	m->scale			= m_nodeAttribs.currentModelScale;
+	m->alpha			= m_nodeAttribs.currentModelAlpha;
+
+	if (!cached) {
+		ConvertModel(m, modelAddress);
+	}
+
+	m_sceneTimes.models++;
+
+	return true;
+}
+
+/*
+	0x00:   x------- -------- -------- --------	Is UF ref
+			-x------ -------- -------- --------	Is 3D model
+			--x----- -------- -------- --------	Is point
+			---x---- -------- -------- --------	Is point ref
+			----x--- -------- -------- --------	Is animation
+			-----x-- -------- -------- --------	Is billboard
+			------x- -------- -------- --------	Child is billboard
+			-------x -------- -------- --------	Extra child pointer needed
+			-------- xxxxx--- -------- --------	Spare (unknown if used)
+			-------- -----xxx xxxxxx-- --------	Node ID
+			-------- -------- ------x- --------	Discard 1
+			-------- -------- -------x --------	Discard 2
+
+			-------- -------- -------- x-------	Reset matrix
+			-------- -------- -------- -x------	Use child pointer
+			-------- -------- -------- --x-----	Use sibling pointer
+			-------- -------- -------- ---x----	No matrix
+			-------- -------- -------- ----x---	Indirect child
+			-------- -------- -------- -----x--	Valid color table
+			-------- -------- -------- ------xx	Node type(0 = viewport, 1 = root node, 2 = culling node)
+
+	0x01, 0x02 only present on Step 1.5+
+
+	0x01:   xxxxxxxx xxxxxxxx xxxxxxxx xxxxxx--	Model scale (float32) last 2 bits are control words
+			-------- -------- -------- ------x- Disable culling
+			-------- -------- -------- -------x	Valid model scale
+
+	0x02 :	-------- -------- x------- --------	Texture replace
+			-------- -------- -x------ --------	Switch bank
+			-------- -------- --xxxxxx x-------	X offset
+			-------- -------- -------- -xxxxxxx	Y offset
+
+	0x03 :	xxxxxxxx xxxxx--- -------- --------	Color table address 1
+			-------- -----xxx xxxx---- --------	LOD table pointer
+			-------- -------- ----xxxx xxxxxxxx	Node matrix
+
+	0x04:   Translation X coordinate
+	0x05:   Translation Y coordinate
+	0x06:   Translation Z coordinate
+
+	0x07:   xxxx---- -------- -------- -------- Color table address 2
+			-----x-- -------- -------- -------- Sibling table
+			------x- -------- -------- -------- Point
+			-------x -------- -------- -------- Leaf node
+			-------- xxxxxxxx xxxxxxxx xxxxxxxx Child pointer
+
+	0x08:   xxxxxxx- -------- -------- -------- Color table address 3
+			-------x -------- -------- -------- Null sibling
+			-------- xxxxxxxx xxxxxxxx xxxxxxxx Sibling pointer
+
+	0x09:   xxxxxxxx xxxxxxxx -------- -------- Blend radius
+			-------- -------- xxxxxxxx xxxxxxxx Culling radius
+*/
+
+void CNew3DScene::DescendCullingNode(UINT32 addr)
+{
+	enum class NodeType { undefined = -1, viewport = 0, rootNode = 1, cullingNode = 2 };
+
+	const UINT32	*node, *lodPtr;
+	UINT32			matrixOffset, child1Ptr, sibling2Ptr;
+	UINT16			uCullRadius;
+	float			fCullRadius;
+	UINT16			uBlendRadius;
+	float			fBlendRadius;
+	UINT8			lodTablePointer;
+	NodeType		nodeType;
+	bool			resetMatrix;
+
+	if (m_nodeAttribs.StackLimit()) {
+		return;
+	}
+
+	node = TranslateCullingAddress(addr);
+
+	if (NULL == node) {
+		return;
+	}
+
+	// Extract known fields
+	nodeType		= (NodeType)(node[0x00] & 3);
+	child1Ptr		= node[0x07 - m_offset] & 0x7FFFFFF;	// mask colour table bits
+	sibling2Ptr		= node[0x08 - m_offset] & 0x1FFFFFF;	// mask colour table bits
+	matrixOffset	= node[0x03 - m_offset] & 0xFFF;
+	resetMatrix		= (node[0x0] & 0x80) > 0;
+	lodTablePointer = (node[0x03 - m_offset] >> 12) & 0x7F;
+
+	// check our node type
+	if (nodeType == NodeType::viewport) {
+		return;												// viewport nodes aren't rendered
+	}
+
+	// node discard
+	if ((0x300 & node[0]) == 0x300) {						// This allows to set node transparency. If both bits are set object is completely invisible.
+		return;
+	}
+
+	// parse siblings 
+	if ((node[0x00] & 0x07) != 0x06) {						// colour table seems to indicate no siblings
+		if (!(sibling2Ptr & 0x1000000) && sibling2Ptr) {
+			DescendCullingNode(sibling2Ptr);				// no need to mask bit, would already be zero
+		}
+	}
+
+	if ((node[0x00] & 0x04)) {
+		m_colorTableAddr = ((node[0x03 - m_offset] >> 19) << 0) | ((node[0x07 - m_offset] >> 28) << 13) | ((node[0x08 - m_offset] >> 25) << 17);
+		m_colorTableAddr &= 0x000FFFFF; // clamp to 4MB (in words) range
+	}
+
+	m_nodeAttribs.Push();	// save current attribs
+
+	if (!m_offset) {		// Step 1.5+
+
+		if (node[0x01] & 1)
+			m_nodeAttribs.currentModelScale = Util::Uint32AsFloat(node[0x01] & ~3);	// mask out control bits
+
+		if (node[0x01] & 2)
+			m_nodeAttribs.currentDisableCulling = true;
+
+		// apply texture offsets, else retain current ones
+		if ((node[0x02] & 0x8000))	{
+			int tx = 32 * ((node[0x02] >> 7) & 0x3F);
+			int ty = 32 * (node[0x02] & 0x1F);
+			m_nodeAttribs.currentTexOffsetX	= tx;
+			m_nodeAttribs.currentTexOffsetY = ty;
+			m_nodeAttribs.currentPage = (node[0x02] & 0x4000) >> 14;
+		}
+	}
+
+	// Apply matrix and translation
+	m_modelMat.PushMatrix();
+
+	// apply translation vector
+	if (node[0x00] & 0x10) {
+		float centroid_x = Util::Uint32AsFloat(node[0x04 - m_offset]);
+		float centroid_y = Util::Uint32AsFloat(node[0x05 - m_offset]);
+		float centroid_z = Util::Uint32AsFloat(node[0x06 - m_offset]);
+		m_modelMat.Translate(centroid_x, centroid_y, centroid_z);
+	}
+	// multiply matrix, if specified
+	else if (matrixOffset) {
+		MultMatrix(matrixOffset,m_modelMat);
+	}
+
+	if (resetMatrix) {
+		ResetMatrix(m_modelMat);
+	}
+
+	float& x = m_modelMat.currentMatrix[12];
+	float& y = m_modelMat.currentMatrix[13];
+	float& z = m_modelMat.currentMatrix[14];
+
+	uCullRadius = node[9 - m_offset] & 0xFFFF;
+	fCullRadius = R3DFloat::GetFloat16(uCullRadius) * m_nodeAttribs.currentModelScale;;
+
+	uBlendRadius = node[9 - m_offset] >> 16;
+	fBlendRadius = R3DFloat::GetFloat16(uBlendRadius) * m_nodeAttribs.currentModelScale;;
+
+	bool outsideFrustum = OutsideFrustum(x, y, z, fCullRadius);
+
+	// std::hypot guards against overflow we can't get here and is many times slower than a plain sqrt
+	const V3::Vec3 modelPos = { x, y, z };
+	float LODscale = m_nodeAttribs.currentDisableCulling ? std::numeric_limits<float>::max() : (fBlendRadius / V3::length(modelPos));
+	const LOD * const lod = m_LODBlendTable->table[lodTablePointer].lod;
+
+	LODscale = std::clamp(LODscale, 0.0f, std::numeric_limits<float>::max());
+
+	if (m_nodeAttribs.currentDisableCulling || (!outsideFrustum && LODscale >= lod[3].deleteSize)) {
+
+		// Descend down first link
+		if ((node[0x00] & 0x08))	// 4-element LOD table
+		{
+			lodPtr = TranslateCullingAddress(child1Ptr);
+
+			if (nullptr != lodPtr)
+			{
+				int modelLOD;
+				for (modelLOD = 0; modelLOD < 3; modelLOD++)
+				{
+					if (LODscale >= lod[modelLOD].deleteSize && lodPtr[modelLOD] & 0x1000000)
+						break;
+				}
+
+				float tempAlpha = m_nodeAttribs.currentModelAlpha;
+
+				float nodeAlpha = lod[modelLOD].blendFactor * (LODscale - lod[modelLOD].deleteSize);
+				nodeAlpha = std::clamp(nodeAlpha, 0.0f, 1.0f);
+				if (nodeAlpha > (float)(31.0 / 32.0))		// shader discards pixels below 1/32 alpha
+					nodeAlpha = 1.0f;
+				else if (nodeAlpha < (float)(1.0 / 32.0))
+					nodeAlpha = 0.0f;
+				m_nodeAttribs.currentModelAlpha *= nodeAlpha;	// alpha of each node multiples by the alpha of its parent
+				
+				if ((node[0x03 - m_offset] & 0x20000000)) {
+					DescendCullingNode(lodPtr[modelLOD] & 0xFFFFFF);
+
+					if (nodeAlpha < 1.0f && modelLOD != 3)
+					{
+						m_nodeAttribs.currentModelAlpha = (1.0f - nodeAlpha) * tempAlpha;
+						DescendCullingNode(lodPtr[modelLOD+1] & 0xFFFFFF);
+					}
+				}
+				else {
+					DrawModel(lodPtr[modelLOD] & 0xFFFFFF);
+
+					if (nodeAlpha < 1.0f && modelLOD != 3)
+					{
+						m_nodeAttribs.currentModelAlpha = (1.0f - nodeAlpha) * tempAlpha;
+						DrawModel(lodPtr[modelLOD + 1] & 0xFFFFFF);
+					}
+				}
+			}
+		}
+		else {
+
+			float nodeAlpha = lod[3].blendFactor * (LODscale - lod[3].deleteSize);
+			nodeAlpha = std::clamp(nodeAlpha, 0.0f, 1.0f);
+			m_nodeAttribs.currentModelAlpha *= nodeAlpha;	// alpha of each node multiples by the alpha of its parent
+
+			DescendNodePtr(child1Ptr);
+		}
+
+	}
+
+	m_modelMat.PopMatrix();
+
+	// Restore old texture offsets
+	m_nodeAttribs.Pop();
+}
+
+// tests the bounding sphere against the left, top, right and bottom planes of the current viewport
+bool CNew3DScene::OutsideFrustum(float x, float y, float z, float radius) const
+{
+#if defined(SUPERMODEL_SIMD_SSE2)
+
+	__m128 d = _mm_mul_ps(_mm_set1_ps(z), _mm_loadu_ps(m_planes.cullZ));
+	d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(x), _mm_loadu_ps(m_planes.cullX)));
+	d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(y), _mm_loadu_ps(m_planes.cullY)));
+
+	return _mm_movemask_ps(_mm_cmpgt_ps(d, _mm_set1_ps(radius))) != 0;
+
+#elif defined(SUPERMODEL_SIMD_NEON)
+
+	float32x4_t d = vmulq_n_f32(vld1q_f32(m_planes.cullZ), z);
+	d = vaddq_f32(d, vmulq_n_f32(vld1q_f32(m_planes.cullX), x));
+	d = vaddq_f32(d, vmulq_n_f32(vld1q_f32(m_planes.cullY), y));
+
+	uint32x4_t outside = vcgtq_f32(d, vdupq_n_f32(radius));
+	uint32x2_t folded = vorr_u32(vget_low_u32(outside), vget_high_u32(outside));
+
+	return (vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) != 0;
+
+#else
+
+	for (int i = 0; i < 4; i++) {
+		if ((z * m_planes.cullZ[i] + x * m_planes.cullX[i] + y * m_planes.cullY[i]) > radius) {
+			return true;
+		}
+	}
+
+	return false;
+
+#endif
+}
+
+void CNew3DScene::DescendNodePtr(UINT32 nodeAddr)
+{
+	// Ignore null links
+	if ((nodeAddr & 0x00FFFFFF) == 0) {
+		return;
+	}
+
+	switch ((nodeAddr >> 24) & 0x5)		// pointer type encoded in upper 8 bits
+	{
+	case 0x00:
+		DescendCullingNode(nodeAddr & 0xFFFFFF);
+		break;
+	case 0x01:
+		DrawModel(nodeAddr & 0xFFFFFF);
+		break;
+	case 0x04:
+		DescendPointerList(nodeAddr & 0xFFFFFF);
+		break;
+	default:
+		break;
+	}
+}
+
+void CNew3DScene::DescendPointerList(UINT32 addr)
+{
+	const UINT32* const list = TranslateCullingAddress(addr);
+
+	if (nullptr == list) {
+		return;
+	}
+
+	int index = 0;
+
+	while (true) {
+
+		if (list[index] & 0x01000000) {
+			break;	// empty list
+		}
+
+		UINT32 nodeAddr = list[index] & 0x00FFFFFF;	// clear upper 8 bits to ensure this is processed as a culling node
+
+		DescendCullingNode(nodeAddr);
+
+		if (list[index] & 0x02000000) {
+			break;	// list end
+		}
+
+		index++;
+	}
+}
+
+
+/******************************************************************************
+Matrix Stack
+******************************************************************************/
+
+// Macro to generate column-major (OpenGL) index from y,x subscripts
+#define CMINDEX(y,x)	(x*4+y)
+
+/*
+* MultMatrix():
+*
+* Multiplies the matrix stack by the specified Real3D matrix. The matrix
+* index is a 12-bit number specifying a matrix number relative to the base.
+* The base matrix MUST be set up before calling this function.
+*/
+void CNew3DScene::MultMatrix(UINT32 matrixOffset, Mat4& mat)
+{
+	float		m[4*4];
+	const float	*src = &m_matrixBasePtr[matrixOffset * 12];
+
+	if (m_matrixBasePtr == NULL)	// LA Machineguns
+		return;
+
+	m[CMINDEX(0, 0)] = src[3];
+	m[CMINDEX(0, 1)] = src[4];
+	m[CMINDEX(0, 2)] = src[5];
+	m[CMINDEX(0, 3)] = src[0];
+	m[CMINDEX(1, 0)] = src[6];
+	m[CMINDEX(1, 1)] = src[7];
+	m[CMINDEX(1, 2)] = src[8];
+	m[CMINDEX(1, 3)] = src[1];
+	m[CMINDEX(2, 0)] = src[9];
+	m[CMINDEX(2, 1)] = src[10];
+	m[CMINDEX(2, 2)] = src[11];
+	m[CMINDEX(2, 3)] = src[2];
+	m[CMINDEX(3, 0)] = 0.0;
+	m[CMINDEX(3, 1)] = 0.0;
+	m[CMINDEX(3, 2)] = 0.0;
+	m[CMINDEX(3, 3)] = 1.0;
+
+	mat.MultMatrix(m);
+}
+
+/*
+* InitMatrixStack():
+*
+* Initializes the modelview (model space -> view space) matrix stack and
+* Real3D coordinate system. These are the last transforms to be applied (and
+* the first to be defined on the stack) before projection.
+*
+* Model 3 games tend to define the following unusual base matrix:
+*
+*		0	0	-1	0
+*		1	0	0	0
+*		0	-1	0	0
+*		0	0	0	1
+*
+* When this is multiplied by a column vector, the output is:
+*
+*		-Z
+*		X
+*		-Y
+*		1
+*
+* My theory is that the Real3D GPU accepts vectors in Z,X,Y order. The games
+* store everything as X,Y,Z and perform the translation at the end. The Real3D
+* also has Y and Z coordinates opposite of the OpenGL convention. This
+* function inserts a compensating matrix to undo these things.
+*
+* NOTE: This function assumes we are in GL_MODELVIEW matrix mode.
+*/
+
+void CNew3DScene::InitMatrixStack(UINT32 matrixBaseAddr, Mat4& mat)
+{
+	float m[4 * 4];
+
+	// This matrix converts vectors back from the weird Model 3 Z,X,Y ordering
+	// and also into OpenGL viewspace (-Y,-Z)
+	m[CMINDEX(0, 0)] = 0.0;	m[CMINDEX(0, 1)] = 1.0;	m[CMINDEX(0, 2)] = 0.0;	m[CMINDEX(0, 3)] = 0.0;
+	m[CMINDEX(1, 0)] = 0.0;	m[CMINDEX(1, 1)] = 0.0;	m[CMINDEX(1, 2)] =-1.0; m[CMINDEX(1, 3)] = 0.0;
+	m[CMINDEX(2, 0)] =-1.0; m[CMINDEX(2, 1)] = 0.0;	m[CMINDEX(2, 2)] = 0.0;	m[CMINDEX(2, 3)] = 0.0;
+	m[CMINDEX(3, 0)] = 0.0;	m[CMINDEX(3, 1)] = 0.0;	m[CMINDEX(3, 2)] = 0.0;	m[CMINDEX(3, 3)] = 1.0;
+
+	mat.LoadMatrix(m);
+
+	// Set matrix base address and apply matrix #0 (coordinate system matrix)
+	m_matrixBasePtr = (float *)TranslateCullingAddress(matrixBaseAddr);
+	MultMatrix(0, mat);
+}
+
+// what this does is to set the rotation back to zero, whilst keeping the position and scale of the current matrix
+void CNew3DScene::ResetMatrix(Mat4& mat) const
+{
+	float m[16];
+	memcpy(m, mat.currentMatrix, 16 * 4);
+
+	// transpose the top 3x3 of the matrix (this effectively inverts the rotation). When we multiply our new matrix it'll effectively cancel out the rotations.
+	std::swap(m[1], m[4]);
+	std::swap(m[2], m[8]);
+	std::swap(m[6], m[9]);
+
+	// set position to zero
+	m[12] = 0;
+	m[13] = 0;
+	m[14] = 0;
+	m[15] = 1;
+
+	// normalise columns, this removes the scaling, otherwise we'll apply it twice
+#if defined(SUPERMODEL_SIMD_SSE2)
+
+	// work on rows so each lane holds one column. The position is zero, so lane 3 of the sum is 0 and the +1 makes its scale exactly 1
+	__m128 r0 = _mm_loadu_ps(m + 0);
+	__m128 r1 = _mm_loadu_ps(m + 4);
+	__m128 r2 = _mm_loadu_ps(m + 8);
+	__m128 r3 = _mm_loadu_ps(m + 12);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+	__m128 sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, r0), _mm_mul_ps(r1, r1)), _mm_mul_ps(r2, r2));
+	__m128 s = _mm_sqrt_ps(_mm_add_ps(sq, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)));
+
+	r0 = _mm_div_ps(r0, s);
+	r1 = _mm_div_ps(r1, s);
+	r2 = _mm_div_ps(r2, s);
+
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_storeu_ps(m + 0, r0);
+	_mm_storeu_ps(m + 4, r1);
+	_mm_storeu_ps(m + 8, r2);
+	_mm_storeu_ps(m + 12, r3);
+
+#elif defined(SUPERMODEL_SIMD_NEON) && defined(__aarch64__)
+
+	// vld4 hands us the rows directly, same lane layout as the SSE2 path. ARMv7 has no vector sqrt or divide and stays scalar
+	float32x4x4_t r = vld4q_f32(m);
+
+	float32x4_t sq = vaddq_f32(vaddq_f32(vmulq_f32(r.val[0], r.val[0]), vmulq_f32(r.val[1], r.val[1])), vmulq_f32(r.val[2], r.val[2]));
+	float32x4_t s = vsqrtq_f32(vaddq_f32(sq, vsetq_lane_f32(1.0f, vdupq_n_f32(0.0f), 3)));
+
+	r.val[0] = vdivq_f32(r.val[0], s);
+	r.val[1] = vdivq_f32(r.val[1], s);
+	r.val[2] = vdivq_f32(r.val[2], s);
+
+	vst4q_f32(m, r);
+
+#else
+
+	float s1 = std::sqrt((m[0] * m[0]) + (m[1] * m[1]) + (m[2] * m[2]));
+	float s2 = std::sqrt((m[4] * m[4]) + (m[5] * m[5]) + (m[6] * m[6]));
+	float s3 = std::sqrt((m[8] * m[8]) + (m[9] * m[9]) + (m[10] * m[10]));
+
+	m[0] /= s1;		m[4] /= s2;		m[8] /= s3;
+	m[1] /= s1;		m[5] /= s2;		m[9] /= s3;
+	m[2] /= s1;		m[6] /= s2;		m[10] /= s3;
+
+#endif
+
+	mat.MultMatrix(m);
+}
+
+// Draws viewports of the given priority
+void CNew3DScene::RenderViewport(UINT32 addr)
+{
+	static const float	color[8][3] =
+	{											// RGB1 color translation
+		{ 0.0f, 0.0f, 0.0f },	// off
+		{ 0.0f, 0.0f, 1.0f },	// blue
+		{ 0.0f, 1.0f, 0.0f },	// green
+		{ 0.0f, 1.0f, 1.0f },	// cyan
+		{ 1.0f, 0.0f, 0.0f }, 	// red
+		{ 1.0f, 0.0f, 1.0f },	// purple
+		{ 1.0f, 1.0f, 0.0f },	// yellow
+		{ 1.0f, 1.0f, 1.0f }	// white
+	};
+
+	if ((addr & 0x00FFFFFF) == 0) {
+		return;
+	}
+
+	// Translate address and obtain pointer
+	const uint32_t * const vpnode = TranslateCullingAddress(addr);
+
+	if (nullptr == vpnode) {
+		return;
+	}
+
+	bool vpDisabled = vpnode[0] & 0x20;						// only if viewport enabled
+
+	{
+		// create node object 
+		m_nodes.emplace_back(Node());
+		m_nodes.back().models.reserve(2048);				// create space for models
+
+		// get pointer to its viewport
+		Viewport* vp = &m_nodes.back().viewport;
+
+		vp->priority	= (vpnode[0] >> 3) & 0x3;
+		vp->select		= (vpnode[0] >> 8) & 0x3;
+		vp->number		= (vpnode[0] >> 10);
+
+		// Fetch viewport parameters
+		vp->vpX			= ((vpnode[0x1A] & 0xFFFF) * (float)(1.0 / 16.0)) ;		// viewport X (12.4 fixed point)
+		vp->vpY			= ((vpnode[0x1A] >> 16) * (float)(1.0 / 16.0));			// viewport Y (12.4)
+		vp->vpWidth		= ((vpnode[0x14] & 0xFFFF) * (float)(1.0 / 4.0));		// width (14.2)
+		vp->vpHeight	= ((vpnode[0x14] >> 16) * (float)(1.0 / 4.0));			// height (14.2)
+
+		uint32_t matrixBase = vpnode[0x16] & 0xFFFFFF;							// matrix base address
+
+		m_LODBlendTable = (LODBlendTable*)TranslateCullingAddress(vpnode[0x17] & 0xFFFFFF);
+
+		float cv = Util::Uint32AsFloat(vpnode[0x8]);	// 1/(left-right)
+		float cw = Util::Uint32AsFloat(vpnode[0x9]);	// 1/(top-bottom)
+		float io = Util::Uint32AsFloat(vpnode[0xa]);	// top / bottom (ratio) - ish
+		float jo = Util::Uint32AsFloat(vpnode[0xb]);	// left / right (ratio)
+
+		// clipping plane normals
+		m_planes.bnlu = Util::Uint32AsFloat(vpnode[0xc]);
+		m_planes.bnlv = Util::Uint32AsFloat(vpnode[0xd]);
+		m_planes.bntu = Util::Uint32AsFloat(vpnode[0xe]);
+		m_planes.bntw = Util::Uint32AsFloat(vpnode[0xf]);
+		m_planes.bnru = Util::Uint32AsFloat(vpnode[0x10]);
+		m_planes.bnrv = Util::Uint32AsFloat(vpnode[0x11]);
+		m_planes.bnbu = Util::Uint32AsFloat(vpnode[0x12]);
+		m_planes.bnbw = Util::Uint32AsFloat(vpnode[0x13]);
+		m_planes.correction = 1.0f;		// might get changed by the calc viewport method
+
+		vp->angle_left		= (0.0f - jo) / cv;
+		vp->angle_right		= (1.0f - jo) / cv;
+		vp->angle_bottom	= -(1.0f - io) / cw;
+		vp->angle_top		= -(0.0f - io) / cw;
+
+		vp->cota = Util::Uint32AsFloat(vpnode[0x3]);
+
+		CalcViewport(vp);
+
+		// pack the plane normals so all four planes can be tested at once during culling
+		m_planes.cullZ[0] = m_planes.bnlu;		m_planes.cullX[0] = -m_planes.bnlv * m_planes.correction;		m_planes.cullY[0] = 0.0f;
+		m_planes.cullZ[1] = m_planes.bntu;		m_planes.cullX[1] = 0.0f;										m_planes.cullY[1] = m_planes.bntw;
+		m_planes.cullZ[2] = m_planes.bnru;		m_planes.cullX[2] = -m_planes.bnrv * m_planes.correction;		m_planes.cullY[2] = 0.0f;
+		m_planes.cullZ[3] = m_planes.bnbu;		m_planes.cullX[3] = 0.0f;										m_planes.cullY[3] = m_planes.bnbw;
+
+		// Lighting (note that sun vector points toward sun -- away from vertex)
+		vp->lightingParams[0] = Util::Uint32AsFloat(vpnode[0x05]);							// sun X
+		vp->lightingParams[1] = -Util::Uint32AsFloat(vpnode[0x06]);							// sun Y (- to convert to ogl cordinate system)
+		vp->lightingParams[2] = -Util::Uint32AsFloat(vpnode[0x04]);							// sun Z (- to convert to ogl cordinate system)
+		vp->lightingParams[3] = std::max(0.f, std::min(Util::Uint32AsFloat(vpnode[0x07]), 1.0f));	// sun intensity (clamp to 0-1)
+		vp->lightingParams[4] = (float)((vpnode[0x24] >> 8) & 0xFF) * (float)(1.0 / 255.0);	// ambient intensity
+		vp->lightingParams[5] = 0.0f;	// reserved
+
+		vp->sunClamp = m_sunClamp;
+		vp->intensityClamp = (m_step == 0x10);		// just step 1.0 ?
+		vp->hardwareStep = m_step;
+
+		// Spotlight
+		int spotColorIdx = (vpnode[0x20] >> 11) & 7;									// spotlight color index
+		int spotFogColorIdx = (vpnode[0x20] >> 8) & 7;									// spotlight on fog color index
+		vp->spotEllipse[0] = (float)(INT16)(vpnode[0x1E] & 0xFFFF) * (float)(1.0 / 8.0);// spotlight X position (13.3 fixed point)
+		vp->spotEllipse[1] = (float)(INT16)(vpnode[0x1D] & 0xFFFF) * (float)(1.0 / 8.0);// spotlight Y
+		vp->spotEllipse[2] = (float)((vpnode[0x1E] >> 16) & 0xFFFF);					// spotlight X size (16-bit)
+		vp->spotEllipse[3] = (float)((vpnode[0x1D] >> 16) & 0xFFFF);					// spotlight Y size
+
+		vp->spotRange[0] = 1.0f / Util::Uint32AsFloat(vpnode[0x21]);					// spotlight start
+		vp->spotRange[1] = Util::Uint32AsFloat(vpnode[0x1F]);							// spotlight extent
+
+		vp->spotColor[0] = color[spotColorIdx][0];										// spotlight color
+		vp->spotColor[1] = color[spotColorIdx][1];
+		vp->spotColor[2] = color[spotColorIdx][2];
+
+		vp->spotFogColor[0] = color[spotFogColorIdx][0];								// spotlight color on fog
+		vp->spotFogColor[1] = color[spotFogColorIdx][1];
+		vp->spotFogColor[2] = color[spotFogColorIdx][2];
+
+		// spotlight is specified in terms of physical resolution
+		vp->spotEllipse[1] = 384.0f - vp->spotEllipse[1];								// flip Y position
+
+		// Avoid division by zero
+		vp->spotEllipse[2] = std::max(1.0f, vp->spotEllipse[2]);
+		vp->spotEllipse[3] = std::max(1.0f, vp->spotEllipse[3]);
+
+		vp->spotEllipse[2] = std::roundf(2047.0f / vp->spotEllipse[2]);
+		vp->spotEllipse[3] = std::roundf(2047.0f / vp->spotEllipse[3]);
+
+		// Scale the spotlight to the OpenGL viewport
+		vp->spotEllipse[0] = vp->spotEllipse[0] * m_xRatio + (float)m_xOffs;
+		vp->spotEllipse[1] = vp->spotEllipse[1] * m_yRatio + (float)m_yOffs;
+		vp->spotEllipse[2] *= m_xRatio;
+		vp->spotEllipse[3] *= m_yRatio;
+
+		// Line of sight position
+		vp->losPosX = (int)(((vpnode[0x1c] & 0xFFFF) / 16.0f) + 0.5f);					// x position
+		vp->losPosY = (int)(((vpnode[0x1c] >> 16) / 16.0f) + 0.5f);						// y position 0 starts from the top
+
+		// Fog
+		vp->fogColour[0]	= (float)((vpnode[0x22] >> 16) & 0xFF) * (float)(1.0 / 255.0);	// fog color R
+		vp->fogColour[1]	= (float)((vpnode[0x22] >> 8) & 0xFF) * (float)(1.0 / 255.0);	// fog color G
+		vp->fogColour[2]	= (float)((vpnode[0x22] >> 0) & 0xFF) * (float)(1.0 / 255.0);	// fog color B
+		vp->fogDensity		= std::abs(Util::Uint32AsFloat(vpnode[0x23]));					// fog density	- ocean hunter uses negative values, but looks the same
+		vp->fogStart		= (float)(INT16)(vpnode[0x25] & 0xFFFF) * (float)(1.0 / 255.0);	// fog start
+		vp->fogAttenuation	= (float)((vpnode[0x24] >> 16) & 0xFF) * (float)(1.0 / 255.0);	// fog attenuation
+		vp->fogAmbient		= (float)((vpnode[0x25] >> 16) & 0xFF) * (float)(1.0 / 255.0);	// fog ambient
+
+		// Avoid Infinite and NaN values for Star Wars Trilogy
+		if (std::isinf(vp->fogDensity) || std::isnan(vp->fogDensity)) {
+			vp->fogDensity = 0;
+		}
+
+		vp->scrollFog = (float)(vpnode[0x20] & 0xFF) * (float)(1.0 / 255.0);				// scroll fog
+		vp->scrollAtt = (float)(vpnode[0x24] & 0xFF) * (float)(1.0 / 255.0);				// scroll attenuation
+
+		// Clear texture offsets before proceeding
+		m_nodeAttribs.Reset();
+
+		// Set up coordinate system and base matrix
+		InitMatrixStack(matrixBase, m_modelMat);
+
+		// Descend down the node link. Need to start with a culling node because that defines our culling radius.
+		if (!vpDisabled) {
+			auto childptr = vpnode[0x02];
+			if (((childptr >> 24) & 0x5) == 0) {
+				DescendNodePtr(vpnode[0x02]);
+			}
+		}
+	}
+	
+	// render next viewport
+	if (vpnode[0x01] != 0x01000000) {
+		RenderViewport(vpnode[0x01]);
+	}
+}
+
+void CNew3DScene::CopyVertexData(const R3DPoly& r3dPoly, std::vector<FVertex>& vertexArray)
+{
+	// both lemans 24 and dirt devils are rendering some totally transparent polys as the first object in each viewport
+	// in dirt devils it's parallel to the camera so is completely invisible, but breaks our depth calculation
+	// in lemans 24 its a sort of diamond shape, but never leaves a hole in the transparent geometry so must be being skipped by the h/w
+	if (r3dPoly.faceColour[3] == 0) {
+		return;
+	}
+
+	if (m_numPolyVerts==4) {
+		if (r3dPoly.number == 4) {
+			vertexArray.emplace_back(r3dPoly, 0);		// construct directly inside container without copy
+			vertexArray.emplace_back(r3dPoly, 1);
+			vertexArray.emplace_back(r3dPoly, 2);
+			vertexArray.emplace_back(r3dPoly, 3);
+
+			// check for identical points (ie forced triangle) and replace with average point
+			// if we don't do this our quad code falls apart
+			FVertex* v = (&vertexArray.back()) - 3;
+
+			for (int i = 0; i < 4; i++) {
+
+				int next1 = (i + 1) % 4;
+				int next2 = (i + 2) % 4;
+
+				if (FVertex::Equal(v[i], v[next1])) {
+					FVertex::Average(v[next1], v[next2], v[next1]);
+					break;
+				}
+			}
+		}
+		else {
+			vertexArray.emplace_back(r3dPoly, 0);	
+			vertexArray.emplace_back(r3dPoly, 1);
+			vertexArray.emplace_back(r3dPoly, 2);
+			vertexArray.emplace_back(r3dPoly, 0, 2);	// last point is an average of 0 and 2
+		}
+	}
+	else {
+		vertexArray.emplace_back(r3dPoly, 0);
+		vertexArray.emplace_back(r3dPoly, 1);
+		vertexArray.emplace_back(r3dPoly, 2);
+
+		if (r3dPoly.number == 4) {
+			vertexArray.emplace_back(r3dPoly, 0);
+			vertexArray.emplace_back(r3dPoly, 2);
+			vertexArray.emplace_back(r3dPoly, 3);
+		}
+	}
+}
+
+void CNew3DScene::GetCoordinates(int width, int height, UINT16 uIn, UINT16 vIn, float uvScale, float& uOut, float& vOut) const
+{
+	uOut = (uIn * uvScale) / width;
+	vOut = (vIn * uvScale) / height;
+}
+
+int CNew3DScene::GetTexFormat(int originalFormat, bool contour) const
+{
+	if (!contour) {
+		return originalFormat;	// the same
+	}
+
+	switch (originalFormat)
+	{
+	case 1:
+	case 2:
+	case 3:
+	case 4:
+		return originalFormat + 7;		// these formats are identical to 1-4, except they lose the 4 bit alpha part when contour is enabled
+	default:
+		return originalFormat;
+	}
+}
+
+void CNew3DScene::SetMeshValues(Mesh *currentMesh, PolyHeader &ph)
+{
+	//copy attributes
+	currentMesh->textured		= ph.TexEnabled();
+	currentMesh->alphaTest		= ph.AlphaTest();
+	currentMesh->textureAlpha	= ph.TextureAlpha();
+	currentMesh->polyAlpha		= ph.PolyAlpha();
+	currentMesh->lighting		= ph.LightEnabled();
+	currentMesh->fixedShading	= ph.FixedShading() && !ph.SmoothShading();
+	currentMesh->highPriority	= ph.HighPriority();
+	currentMesh->transLSelect	= ph.TranslucencyPatternSelect();
+	currentMesh->layered		= ph.Layered();
+	currentMesh->specular		= ph.SpecularEnabled();
+	currentMesh->shininess		= ph.Shininess();
+	currentMesh->specularValue	= ph.SpecularValue();
+	currentMesh->fogIntensity	= ph.LightModifier();
+	currentMesh->translatorMap	= ph.TranslatorMap();
+	currentMesh->noLosReturn	= ph.NoLosReturn();
+	currentMesh->smoothShading	= ph.SmoothShading();
+
+	if (currentMesh->textured) {
+
+		currentMesh->format = GetTexFormat(ph.TexFormat(), ph.AlphaTest());
+
+		if (currentMesh->format == 7) {
+			currentMesh->alphaTest = false;	// alpha test is a 1 bit test, this format needs a lower threshold, since it has 16 levels of transparency
+		}
+
+		currentMesh->x				= ph.X();
+		currentMesh->y				= ph.Y();
+		currentMesh->width			= ph.TexWidth();
+		currentMesh->height			= ph.TexHeight();
+		currentMesh->microTexture	= ph.MicroTexture();
+		currentMesh->inverted		= ph.TranslatorMapOffset() == 2;
+		currentMesh->page			= ph.Page();
+
+		{
+			bool smoothU = ph.TexSmoothU();
+			bool smoothV = ph.TexSmoothV();
+
+			if (ph.AlphaTest()) {
+				smoothU = false;	// smooth wrap makes no sense for alpha tested polys with pixel dilate
+				smoothV = false;
+			}
+
+			if (ph.TexUMirror()) {
+				if (smoothU)	currentMesh->wrapModeU = Mesh::TexWrapMode::mirror;
+				else			currentMesh->wrapModeU = Mesh::TexWrapMode::mirrorClamp;
+			}
+			else {
+				if (smoothU)	currentMesh->wrapModeU = Mesh::TexWrapMode::repeat;
+				else			currentMesh->wrapModeU = Mesh::TexWrapMode::repeatClamp;
+			}
+
+			if (ph.TexVMirror()) {
+				if (smoothV)	currentMesh->wrapModeV = Mesh::TexWrapMode::mirror;
+				else			currentMesh->wrapModeV = Mesh::TexWrapMode::mirrorClamp;
+			}
+			else {
+				if (smoothV)	currentMesh->wrapModeV = Mesh::TexWrapMode::repeat;
+				else			currentMesh->wrapModeV = Mesh::TexWrapMode::repeatClamp;
+			}
+		}
+
+		if (currentMesh->microTexture) {
+
+			currentMesh->microTextureID = ph.MicroTextureID();
+			currentMesh->microTextureMinLOD = (float)ph.MicroTextureMinLOD();
+		}
+	}
+}
+
+void CNew3DScene::CacheModel(Model *m, const UINT32 *data)
+{
+	if (data == nullptr)
+		return;
+
+	UINT16			texCoords[4][2];
+	PolyHeader		ph;
+	UINT64			lastHash	= -1;
+
+	auto& verts = m_cacheVerts;
+	auto& polys = m_cachePolys[0];
+
+	verts.clear();
+	polys.clear();
+
+	ph = data; 
+
+	// Cache all polygons
+	do {
+
+		R3DPoly		p;					// current polygon
+		float		uvScale;
+
+		if (ph.header[6] == 0) {
+			break;
+		}
+
+		// create a hash value based on poly attributes -todo add more attributes
+		auto hash = ph.Hash();
+
+		// tex size and enable are part of the hash, so these match the values of the mesh the poly ends up in
+		bool textured	= ph.TexEnabled();
+		int texWidth	= ph.TexWidth();
+		int texHeight	= ph.TexHeight();
+
+		// Obtain basic polygon parameters
+		p.number	= ph.NumVerts();
+		uvScale		= ph.UVScale();
+
+		ph.FaceNormal(p.faceNormal);
+
+		// Fetch reused vertices according to bitfield, then new verts
+		int j = 0;
+		for (int i = 0; i < 4; i++)		// up to 4 reused vertices
+		{
+			if (ph.SharedVertex(i))
+			{
+				p.v[j] = m_prev[i];
+
+				texCoords[j][0] = m_prevTexCoords[i][0];
+				texCoords[j][1] = m_prevTexCoords[i][1];
+
+				//check if we need to recalc tex coords - will only happen if tex tiles are different + sharing vertices
+				if (hash != lastHash) {
+					if (textured) {
+						GetCoordinates(texWidth, texHeight, texCoords[j][0], texCoords[j][1], uvScale, p.v[j].texcoords[0], p.v[j].texcoords[1]);
+					}
+				}
+
+				j++;
+			}
+		}
+
+		lastHash = hash;
+
+		// copy face attributes
+
+		if (!ph.PolyColor()) {
+			int colorIdx = ph.ColorIndex();
+			p.faceColour[2] = (m_polyRAM[m_colorTableAddr + colorIdx] & 0xFF);
+			p.faceColour[1] = ((m_polyRAM[m_colorTableAddr + colorIdx] >> 8) & 0xFF);
+			p.faceColour[0] = ((m_polyRAM[m_colorTableAddr + colorIdx] >> 16) & 0xFF);
+		}
+		else {
+			p.faceColour[0] = ((ph.header[4] >> 24));
+			p.faceColour[1] = ((ph.header[4] >> 16) & 0xFF);
+			p.faceColour[2] = ((ph.header[4] >> 8) & 0xFF);
+		}
+
+		p.faceColour[3] = ph.Transparency();
+
+		if (ph.Discard1() && !ph.Discard2()) {
+			p.faceColour[3] /= 2;
+		}
+
+		// if we have flat shading, we can't re-use normals from shared vertices
+		for (int i = 0; i < p.number && !ph.SmoothShading(); i++) {
+			p.v[i].normal[0] = p.faceNormal[0];
+			p.v[i].normal[1] = p.faceNormal[1];
+			p.v[i].normal[2] = p.faceNormal[2];
+		}
+
+		p.textureNP = ph.TextureNP() * m_textureNPFactor;
+
+		UINT32* vData = ph.StartOfData();	// vertex data starts here
+
+		// remaining vertices are new and defined here
+		for (; j < p.number; j++)	
+		{
+			// Fetch vertices
+			UINT32 ix = vData[0];
+			UINT32 iy = vData[1];
+			UINT32 iz = vData[2];
+			UINT32 it = vData[3];
+
+			// Decode vertices
+			p.v[j].pos[0] = (((INT32)ix) >> 8) * m_vertexFactor;
+			p.v[j].pos[1] = (((INT32)iy) >> 8) * m_vertexFactor;
+			p.v[j].pos[2] = (((INT32)iz) >> 8) * m_vertexFactor;
+			p.v[j].pos[3] = 1.0f;
+
+			// Per vertex normals
+			if (ph.SmoothShading()) {
+				p.v[j].normal[0] = BYTE_TO_FLOAT((INT8)(ix & 0xFF));
+				p.v[j].normal[1] = BYTE_TO_FLOAT((INT8)(iy & 0xFF));
+				p.v[j].normal[2] = BYTE_TO_FLOAT((INT8)(iz & 0xFF));
+			}
+
+			if (ph.FixedShading() && !ph.SmoothShading()) {			// fixed shading seems to be disabled if actual normals are set
+
+				//==========
+				float shade;
+				//==========
+
+				// If specular is enabled fixed shading values are treated as unsigned
+				if (ph.SpecularEnabled()) {
+					shade = (ix & 0xFF) * (float)(1.0 / 255.0);
+				}
+				else {
+					shade = BYTE_TO_FLOAT((INT8)(ix & 0xFF));
+				}
+				
+				p.v[j].fixedShade = shade;
+			}
+
+			float texU = 0;
+			float texV = 0;
+
+			// tex coords
+			if (textured) {
+				GetCoordinates(texWidth, texHeight, (UINT16)(it >> 16), (UINT16)(it & 0xFFFF), uvScale, texU, texV);
+			}
+
+			p.v[j].texcoords[0] = texU;
+			p.v[j].texcoords[1] = texV;
+
+			//cache un-normalised tex coordinates
+			texCoords[j][0] = (UINT16)(it >> 16);
+			texCoords[j][1] = (UINT16)(it & 0xFFFF);
+
+			vData += 4;
+		}
+
+		CachedPoly cp;
+		cp.key			= hash | ((UINT64)(textured && ph.TranslatorMapOffset() == 2) << 60);	// inverted isn't part of the poly hash
+		cp.firstVert	= (UINT32)verts.size();
+		cp.header		= ph.header;
+
+		// check if we need to double up vertices for two sided lighting
+		if (ph.DoubleSided() && !ph.Discard()) {
+
+			R3DPoly tempP = p;
+
+			// flip normals
+			V3::inverse(tempP.faceNormal);
+
+			for (int i2 = 0; i2 < tempP.number; i2++) {
+				V3::inverse(tempP.v[i2].normal);
+			}
+
+			CopyVertexData(tempP, verts);
+		}
+
+		// Copy this polygon into the model buffer
+		if (!ph.Discard()) {
+			CopyVertexData(p, verts);
+		}
+
+		cp.numVerts = (UINT32)verts.size() - cp.firstVert;
+		polys.push_back(cp);
+		
+		// Copy current vertices into previous vertex array
+		for (int i = 0; i < 4; i++) {
+			m_prev[i] = p.v[i];
+			m_prevTexCoords[i][0] = texCoords[i][0];
+			m_prevTexCoords[i][1] = texCoords[i][1];
+		}
+
+	} while (ph.NextPoly());
+
+	// group the polys by state, the sort is stable so polys keep their model order within a mesh
+	SortCachedPolys();
+
+	if (m->dynamic) {
+		CopyMeshes(m, m_polyBufferRam, RAM_SLOT_BASE + m_ramSlot * MAX_RAM_VERTS);
+	}
+	else if (m_cachingRamModel) {
+		CopyMeshes(m, m_ramCacheVerts, MAX_ROM_VERTS);
+	}
+	else {
+		CopyMeshes(m, m_polyBufferRom, 0);
+	}
+}
+
+bool CNew3DScene::FitRamCache(Model *m, size_t& first)
+{
+	size_t numVerts = m_ramCacheVerts.size() - first;
+
+	if (m_ramCacheVerts.size() <= MAX_RAM_CACHE_VERTS) {
+		return true;
+	}
+
+	// only the models not drawn this frame can make room, if they can't leave the cache as it is
+	if (m_ramCachePinned + numVerts > MAX_RAM_CACHE_VERTS) {
+		m_ramCacheVerts.resize(first);
+		return false;
+	}
+
+	// evict the least recently used models until it fits, this stops before any drawn this frame
+	size_t live = first;
+	while (live + numVerts > MAX_RAM_CACHE_VERTS) {
+		auto it = m_ramModelCache.find(m_ramCacheLru.front());
+		live -= it->second.numVerts;
+		m_ramCacheLru.pop_front();
+		m_ramModelCache.erase(it);
+	}
+
+	// close the gaps, keeping the order so that everything before the first gap stays where it is
+	size_t end = 0;
+	size_t kept = 0;
+
+	for (UINT64 hash : m_ramCacheOrder) {
+
+		auto it = m_ramModelCache.find(hash);
+
+		if (it == m_ramModelCache.end()) {
+			continue;		// evicted
+		}
+
+		RamModelEntry& e = it->second;
+
+		if (e.firstVert != end) {
+			std::copy(m_ramCacheVerts.begin() + e.firstVert, m_ramCacheVerts.begin() + e.firstVert + e.numVerts, m_ramCacheVerts.begin() + end);
+			for (auto& mesh : *e.meshes) {
+				mesh.vboOffset -= (int)(e.firstVert - end);
+			}
+			m_ramCacheSynced = std::min(m_ramCacheSynced, end);
+			e.firstVert = end;
+		}
+
+		end += e.numVerts;
+		m_ramCacheOrder[kept++] = hash;
+	}
+
+	m_ramCacheOrder.resize(kept);
+
+	// the new model follows them
+	std::copy(m_ramCacheVerts.begin() + first, m_ramCacheVerts.end(), m_ramCacheVerts.begin() + end);
+	m_ramCacheVerts.resize(end + numVerts);
+	m_ramCacheSynced = std::min(m_ramCacheSynced, end);
+
+	for (auto& mesh : *m->meshes) {
+		mesh.vboOffset -= (int)(first - end);
+	}
+
+	first = end;
+	return true;
+}
+
+template <typename Buffer>
+void CNew3DScene::CopyMeshes(Model *m, Buffer& buffer, int vboBase)
+{
+	const auto& sorted	= m_cachePolys[0];
+	const auto& verts	= m_cacheVerts;
+
+	// one mesh per run of equal keys, copied straight into the main buffer
+	for (size_t i = 0; i < sorted.size();) {
+
+		Mesh mesh;
+		PolyHeader first(sorted[i].header);
+
+		SetMeshValues(&mesh, first);
+		mesh.stateKey	= sorted[i].key;
+		mesh.vboOffset	= (int)buffer.size() + vboBase;
+
+		for (UINT64 key = sorted[i].key; i < sorted.size() && sorted[i].key == key; i++) {
+			const FVertex* v = verts.data() + sorted[i].firstVert;
+			for (UINT32 k = 0; k < sorted[i].numVerts; k++) {
+				buffer.emplace_back(v[k]);
+			}
+		}
+
+		mesh.vertexCount = (int)buffer.size() + vboBase - mesh.vboOffset;
+
+		m->meshes->push_back(mesh);
+	}
+}
+
+void CNew3DScene::ConvertModel(Model *m, const UINT32 *data)
+{
+	m_sceneTimes.conversions++;
+
+	if (!m_profiling) {
+		CacheModel(m, data);
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	CacheModel(m, data);
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	m_sceneTimes.conversionMs += elapsed.count();
+}
+
+void CNew3DScene::SortCachedPolys()
+{
+	auto& in	= m_cachePolys[0];
+	auto& out	= m_cachePolys[1];
+
+	if (in.size() < 2) {
+		return;
+	}
+
+	// only sort on the bytes that actually differ, most models use a handful of states so this is usually one or two passes
+	UINT64 diff = 0;
+	for (const auto& cp : in) {
+		diff |= cp.key ^ in[0].key;
+	}
+
+	out.resize(in.size());
+
+	// LSD radix sort, 8 bits per pass
+	for (int shift = 0; shift < 64; shift += 8) {
+
+		if (((diff >> shift) & 0xFF) == 0) {
+			continue;
+		}
+
+		UINT32 offset[257] = {};
+
+		for (const auto& cp : in) {
+			offset[((cp.key >> shift) & 0xFF) + 1]++;
+		}
+
+		for (int i = 0; i < 256; i++) {
+			offset[i + 1] += offset[i];
+		}
+
+		for (const auto& cp : in) {
+			out[offset[(cp.key >> shift) & 0xFF]++] = cp;
+		}
+
+		in.swap(out);		// result always ends up back in m_cachePolys[0]
+	}
+}
+
+bool CNew3DScene::HashModel(const UINT32 *data, UINT64& hash) const
+{
+	if (data == nullptr) {
+		return false;
+	}
+
+	PolyHeader ph((UINT32*)data);
+
+	// empty models don't touch the shared vertex state, and models starting with shared vertices depend on whatever was drawn before them
+	if (ph.header[6] == 0 || ph.NumSharedVerts()) {
+		return false;
+	}
+
+	UINT64 h = 0xcbf29ce484222325ULL;
+
+	auto mix = [&h](UINT32 word) {
+		h ^= word;
+		h *= 0x9e3779b97f4a7c15ULL;
+		h ^= h >> 32;
+	};
+
+	// hash everything CacheModel reads: the polygon headers, the vertex words and any colour table entries
+	do {
+
+		if (ph.header[6] == 0) {
+			break;
+		}
+
+		int numWords = 7 + (ph.NumVerts() - ph.NumSharedVerts()) * 4;
+
+		for (int i = 0; i < numWords; i++) {
+			mix(ph.header[i]);
+		}
+
+		if (!ph.PolyColor()) {
+			mix(m_polyRAM[m_colorTableAddr + ph.ColorIndex()]);
+		}
+
+	} while (ph.NextPoly());
+
+	hash = h;
+
+	return true;
+}
+
+bool CNew3DScene::IsDynamicModel(UINT32 *data) const
+{
+	if (data == nullptr) {
+		return false;
+	}
+
+	PolyHeader p(data);
+
+	do {
+
+		if ((p.header[1] & 2) == 0) {		// model has rgb colour palette 
+			return true;
+		}
+
+	} while (p.NextPoly());
+
+	return false;
+}
+
+bool CNew3DScene::IsVROMModel(UINT32 modelAddr) const
+{
+	return modelAddr >= 0x100000;
+}
+
+void CNew3DScene::CalcViewport(Viewport* vp)
+{
+	float l = vp->angle_left;	// we need to calc the shape of the projection frustum for culling
+	float r = vp->angle_right;
+	float t = vp->angle_top;
+	float b = vp->angle_bottom;
+
+	vp->projectionMatrix.LoadIdentity();	// reset matrix
+
+	if (m_wideScreen && (vp->vpX == 0) && (vp->vpWidth >= 495) && (vp->vpY == 0) && (vp->vpHeight >= 383)) {
+
+		/*
+		 * Compute aspect ratio correction factor. "Window" refers to the full GL
+		 * viewport (i.e., totalXRes x totalYRes). "Viewable area" is the effective
+		 * Model 3 screen (xRes x yRes). In non-wide-screen, non-stretch mode, this
+		 * is intended to replicate the 496x384 display and may in general be 
+		 * smaller than the window. The rest of the window appears to have a
+		 * border, which is created by a scissor box.
+		 *
+		 * In wide-screen mode, we want to expand the frustum horizontally to fill
+		 * the window. We want the aspect ratio to be correct. To accomplish this,
+		 * the viewable area is set *the same* as in non-wide-screen mode (e.g.,
+		 * often smaller than the window) but glScissor() is set by the OSD layer's
+		 * screen setup code to reveal the entire window.
+		 *
+		 * In stretch mode, the window and viewable area are both set the same,
+		 * which means there will be no aspect ratio correction and the display
+		 * will stretch to fill the entire window while keeping the view frustum
+		 * the same as a 496x384 Model 3 display. The display will be distorted.
+		 *
+		 * In Libretro, the window and viewable area are always the same size, so we
+		 * manually apply the widescreen frustum expansion factor (16:9 / 4:3 = 4:3).
+		 */
+		float correction = (16.0f / 9.0f) / (4.0f / 3.0f);
+		m_planes.correction = 1.0f / correction;
+
+		vp->x		= 0;
+		vp->y		= m_yOffs + (int)((384.0f - (vp->vpY + vp->vpHeight))*m_yRatio);
+		vp->width	= m_totalXRes;
+		vp->height = (int)(vp->vpHeight*m_yRatio);
+
+		vp->projectionMatrix.FrustumRZ(l*correction, r*correction, b, t, NEAR_PLANE);
+	}
+	else {
+
+		vp->x		= m_xOffs + (int)(vp->vpX*m_xRatio);
+		vp->y		= m_yOffs + (int)((384.0f - (vp->vpY + vp->vpHeight))*m_yRatio);
+		vp->width	= (int)(vp->vpWidth*m_xRatio);
+		vp->height	= (int)(vp->vpHeight*m_yRatio);
+
+		vp->projectionMatrix.FrustumRZ(l, r, b, t, NEAR_PLANE);
+	}
+}
+
+void CNew3DScene::TranslateTexture(unsigned& x, unsigned& y, int width, int height, int& page) const
+{
+	page = y / 1024;
+
+	// remove page from y coordinate
+	y -= (page * 1024);
+}
+
+void CNew3DScene::SetSunClamp(bool enable)
+{
+	m_sunClamp = enable;
+}
+
+void CNew3DScene::SetBlockCulling(bool enable)
+{
+	m_blockCulling = enable;
+}
+
+void CNew3DScene::SetProfiling(bool enable)
+{
+	m_profiling = enable;
+}
+
+const CNew3DScene::SceneTimes& CNew3DScene::GetSceneTimes() const
+{
+	return m_sceneTimes;
+}
+
+float CNew3DScene::GetLosValue(int layer)
+{
+	// we always write to the 'back' buffer, and the software reads from the front
+	// then they get swapped
+	std::lock_guard<std::mutex> guard(m_losMutex);
+	return m_losFront->value[layer];
+}
+
+void CNew3DScene::TranslateLosPosition(int inX, int inY, int& outX, int& outY) const
+{
+	// remap real3d 496x384 to our new viewport
+	inY = 384 - inY;
+
+	outX = m_xOffs + int(inX * m_xRatio);
+	outY = m_yOffs + int(inY * m_yRatio);
+}
+
+bool CNew3DScene::HasTransparentMeshes(int priority, bool renderOverlay) const
+{
+	for (const auto& n : m_nodes) {
+		if (n.viewport.priority != priority || n.models.empty()) continue;
+		for (const auto& m : n.models) {
+			if (!m.meshes) continue;
+			for (const auto& mesh : *m.meshes) {
+				if (mesh.highPriority != renderOverlay) continue;
+				if (mesh.textureAlpha || mesh.polyAlpha || m.alpha < 1.0f)
+					return true;
+			}
+		}
+	}
+	return false;
+}
+
+} // New3D
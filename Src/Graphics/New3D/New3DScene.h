@@ -0,0 +1,373 @@
+/**
+** Supermodel
+** A Sega Model 3 Arcade Emulator.
+** Copyright 2011 Bart Trzynadlowski, Nik Henson
+**
+** This file is part of Supermodel.
+**
+** Supermodel is free software: you can redistribute it and/or modify it under
+** the terms of the GNU General Public License as published by the Free
+** Software Foundation, either version 3 of the License, or (at your option)
+** any later version.
+**
+** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+** more details.
+**
+** You should have received a copy of the GNU General Public License along
+** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+**/
+
+/*
+* New3DScene.h
+*
+* Header file defining the CNew3DScene class: the graphics API independent half
+* of the New3D engine. It walks the Real3D scene database and converts the
+* models it finds into meshes and vertex buffers. Drawing them is left to the
+* renderer built on top of it.
+*/
+
+#ifndef INCLUDED_NEW3DSCENE_H
+#define INCLUDED_NEW3DSCENE_H
+
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include "Types.h"
+#include "Graphics/IRender3D.h"
+#include "Util/NewConfig.h"
+#include "Model.h"
+#include "Mat4.h"
+#include "R3DData.h"
+#include "PolyHeader.h"
+
+#define MAX_RAM_VERTS 300000
+#define MAX_ROM_VERTS 1500000
+#define MAX_RAM_CACHE_VERTS 300000		// unchanged polygon RAM models, kept after the rom models
+#define NUM_RAM_SLOTS 3					// frames of dynamic vertices that can be in flight at once
+#define RAM_SLOT_BASE (MAX_ROM_VERTS + MAX_RAM_CACHE_VERTS)	// first vertex of the dynamic slots
+
+#define NEAR_PLANE 1e-3f
+
+namespace New3D {
+
+/*
+* DynamicVertexBuffer:
+*
+* The vertices of the models converted from polygon RAM every frame. It owns
+* its memory and grows as needed, unless the renderer points it at memory of
+* its own, such as a mapped vertex buffer, to have the traversal write straight
+* into that. Vertices that don't fit are dropped then.
+*/
+class DynamicVertexBuffer
+{
+public:
+	void Attach(PackedVertex* memory, size_t capacity)	{ m_memory = memory; m_capacity = capacity; m_size = 0; }
+	void Detach()										{ m_memory = nullptr; m_capacity = 0; m_size = 0; }
+	bool IsAttached() const								{ return m_memory != nullptr; }
+
+	void clear()
+	{
+		m_storage.clear();
+		m_size = 0;
+	}
+
+	void emplace_back(const FVertex& v)
+	{
+		if (!m_memory) {
+			m_storage.emplace_back(v);
+		}
+		else if (m_size < m_capacity) {
+			m_memory[m_size++] = PackedVertex(v);
+		}
+	}
+
+	size_t				size() const	{ return m_memory ? m_size : m_storage.size(); }
+	bool				empty() const	{ return size() == 0; }
+	const PackedVertex*	data() const	{ return m_memory ? m_memory : m_storage.data(); }
+
+private:
+	std::vector<PackedVertex>	m_storage;
+	PackedVertex*				m_memory	= nullptr;
+	size_t						m_capacity	= 0;
+	size_t						m_size		= 0;
+};
+
+class CNew3DScene : public IRender3D
+{
+public:
+	/*
+	* AttachMemory(cullingRAMLoPtr, cullingRAMHiPtr, polyRAMPtr, vromPtr,
+	* 				textureRAMPtr):
+	*
+	* Attaches RAM and ROM areas. This must be done prior to any rendering
+	* otherwise the program may crash with an access violation.
+	*
+	* Parameters:
+	*		cullingRAMLoPtr		Pointer to low culling RAM (4 MB).
+	*		cullingRAMHiPtr		Pointer to high culling RAM (1 MB).
+	*		polyRAMPtr			Pointer to polygon RAM (4 MB).
+	*		vromPtr				Pointer to video ROM (64 MB).
+	*		textureRAMPtr		Pointer to texture RAM (8 MB).
+	*/
+	void AttachMemory(const UINT32 *cullingRAMLoPtr,
+		const UINT32 *cullingRAMHiPtr, const UINT32 *polyRAMPtr,
+		const UINT32 *vromPtr, const UINT16 *textureRAMPtr);
+
+	/*
+	* SetStepping(stepping):
+	*
+	* Sets the Model 3 hardware stepping, which also determines the Real3D
+	* functionality. The default is Step 1.0. This should be called prior to
+	* any other emulation functions and after Init().
+	*
+	* Parameters:
+	*   stepping  0x10 for Step 1.0, 0x15 for Step 1.5, 0x20 for Step 2.0, or
+	*             0x21 for Step 2.1. Anything else defaults to 1.0.
+	*/
+	void SetStepping(int stepping);
+
+	/*
+	* SetSunClamp(bool enable);
+	*
+	* Sets or unsets the clamped light model
+	*
+	* Parameters:
+	*		enable	Set clamp mode
+	*/
+	void SetSunClamp(bool enable);
+
+	/*
+	* SetBlockCulling(bool enable);
+	*
+	* When enabled, clears screen to white and disables 3D rendering
+	*
+	* Parameters:
+	*		enable	Set block culling
+	*/
+	void SetBlockCulling(bool enable);
+
+	/*
+	* GetLosValue(int layer);
+	*
+	* Gets the line of sight value for the priority layer
+	*
+	* Parameters:
+	*		layer	Priority layer to read from
+	*/
+	float GetLosValue(int layer);
+
+	// scene construction times of the last frame
+	struct SceneTimes
+	{
+		double		traversalMs		= 0;	// walking the scene database, conversion not included
+		double		conversionMs	= 0;	// converting models into meshes and vertices
+		unsigned	models			= 0;	// models drawn
+		unsigned	conversions		= 0;	// of which had to be converted
+	};
+
+	/*
+	* SetProfiling(bool enable);
+	*
+	* Times scene traversal and model conversion separately, for benchmarking.
+	* Off by default as it reads the clock around every converted model.
+	*
+	* Parameters:
+	*		enable	Enable the timers
+	*/
+	void SetProfiling(bool enable);
+
+	/*
+	* GetSceneTimes();
+	*
+	* Returns the times of the last frame. Only the counts are kept up to
+	* date while profiling is disabled.
+	*/
+	const SceneTimes& GetSceneTimes() const;
+
+protected:
+	CNew3DScene(const Util::Config::Node &config, const std::string& gameName);
+
+	/*
+	* Frame construction, called by the renderer from RenderFrame()
+	*/
+
+	void SetResolution(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes);
+	void ReleaseScene();			// drops the nodes and dynamic models of the last frame and moves on to the next m_ramSlot
+	void BuildScene();				// traverses the scene database into m_nodes
+	void FlushRomModels();			// forgets every converted static model, for when the static vertex buffer is full
+
+	// a full screen fog layer, drawn before the scene
+	struct FogLayer
+	{
+		const Viewport* viewport;	// fog is constrained to this viewport
+		float rgba[4];
+		float attenuation;
+		float ambient;
+		float spotFogColor[3];
+		float spotEllipse[4];
+	};
+
+	bool GetScrollFog(FogLayer& fog);
+	bool GetAmbientFog(FogLayer& fog);
+
+	// Real3D address translation
+	const UINT32 *TranslateCullingAddress(UINT32 addr);
+	const UINT32 *TranslateModelAddress(UINT32 addr);
+
+	// Matrix stack
+	void MultMatrix(UINT32 matrixOffset, Mat4& mat);
+	void InitMatrixStack(UINT32 matrixBaseAddr, Mat4& mat);
+	void ResetMatrix(Mat4& mat) const;
+
+	// Scene database traversal
+	bool DrawModel(UINT32 modelAddr);
+	void DescendCullingNode(UINT32 addr);
+	bool OutsideFrustum(float x, float y, float z, float radius) const;
+	void DescendPointerList(UINT32 addr);
+	void DescendNodePtr(UINT32 nodeAddr);
+	void RenderViewport(UINT32 addr);
+
+	// building the scene
+	int	GetTexFormat(int originalFormat, bool contour) const;
+	void SetMeshValues(Mesh *currentMesh, PolyHeader &ph);
+	void CacheModel(Model *m, const UINT32 *data);
+	template <typename Buffer>
+	void CopyMeshes(Model *m, Buffer& buffer, int vboBase);	// the sorted polys of CacheModel() into meshes
+	void ConvertModel(Model *m, const UINT32 *data);		// CacheModel() with profiling
+	bool FitRamCache(Model *m, size_t& first);				// makes room for the polygon RAM model just cached, false if it doesn't fit
+	void SortCachedPolys();
+	void CopyVertexData(const R3DPoly& r3dPoly, std::vector<FVertex>& vertexArray);
+	void GetCoordinates(int width, int height, UINT16 uIn, UINT16 vIn, float uvScale, float& uOut, float& vOut) const;
+
+	bool IsDynamicModel(UINT32 *data) const;				// check if the model has a colour palette
+	bool HashModel(const UINT32 *data, UINT64& hash) const;	// content hash of a polygon RAM model, false if it can't be reused
+	bool IsVROMModel(UINT32 modelAddr) const;
+	bool SkipLayer(int layer);
+	void TranslateLosPosition(int inX, int inY, int& outX, int& outY) const;
+	bool HasTransparentMeshes(int priority, bool renderOverlay) const;
+	void CalcViewport(Viewport* vp);
+	void TranslateTexture(unsigned& x, unsigned& y, int width, int height, int& page) const;
+
+	/*
+	* Data
+	*/
+
+	// Misc
+	std::string m_gameName;
+	int m_numPolyVerts;
+
+	// Profiling
+	bool m_profiling = false;
+	SceneTimes m_sceneTimes;
+
+	// GPU configuration
+	std::atomic_bool m_sunClamp;
+	std::atomic_bool m_blockCulling;
+	bool m_noWhiteFlash;
+
+	// Stepping
+	int		m_step;
+	int		m_offset;			// offset to subtract for words 3 and higher of culling nodes
+	float	m_vertexFactor;		// fixed-point conversion factor for vertices
+	float	m_textureNPFactor;	// fixed-point conversion factor for texture NP values
+
+	// Memory (passed from outside)
+	const UINT32	*m_cullingRAMLo;	// 4 MB
+	const UINT32	*m_cullingRAMHi;	// 1 MB
+	const UINT32	*m_polyRAM;			// 4 MB
+	const UINT32	*m_vrom;			// 64 MB
+	const UINT16	*m_textureRAM;		// 8 MB
+
+	// Resolution and scaling factors (to support resolutions higher than 496x384) and offsets
+	float		m_xRatio, m_yRatio;
+	unsigned	m_xOffs, m_yOffs;
+	unsigned	m_xRes, m_yRes;           // resolution of Model 3's 496x384 display area within the window
+	unsigned 	m_totalXRes, m_totalYRes; // total OpenGL window resolution
+	bool		m_wideScreen;
+
+	// Real3D Base Matrix Pointer
+	const float	*m_matrixBasePtr;
+	UINT32 m_colorTableAddr = 0x400;		// address of color table in polygon RAM
+	LODBlendTable* m_LODBlendTable;
+
+	NodeAttributes	m_nodeAttribs;
+	Mat4			m_modelMat;				// current modelview matrix
+
+	struct LOS
+	{
+		float value[4] = { 0,0,0,0 };		// line of sight value for each priority layer
+	} m_los[2];
+
+	LOS* m_losFront = &m_los[0];			// we need to double buffer this because 3d works in separate thread
+	LOS* m_losBack = &m_los[1];
+	std::mutex m_losMutex;
+
+	Vertex			m_prev[4];				// these are class variables because sega bass fishing starts meshes with shared vertices from the previous one
+	UINT16			m_prevTexCoords[4][2];	// basically relying on undefined behavour
+
+	std::vector<Node>	 m_nodes;				// this represents the entire render frame
+	DynamicVertexBuffer m_polyBufferRam;		// dynamic polys
+	std::vector<PackedVertex> m_polyBufferRom;	// rom polys
+	std::unordered_map<UINT32, std::shared_ptr<std::vector<Mesh>>> m_romMap;	// a hash table for all the ROM models. The meshes don't have model matrices or tex offsets yet
+	int m_ramSlot = 0;						// cycles through NUM_RAM_SLOTS, so the dynamic polys being written never share vbo memory with a frame the GPU may still be reading
+
+	struct RamModelEntry
+	{
+		std::shared_ptr<std::vector<Mesh>> meshes;	// converted into m_ramCacheVerts
+		Vertex prev[4];								// shared vertex state left behind by the model
+		UINT16 prevTexCoords[4][2];
+		size_t firstVert;							// range in m_ramCacheVerts
+		size_t numVerts;
+		UINT32 lastUsed;							// m_ramCacheFrame it was last drawn in
+		std::list<UINT64>::iterator lruPos;			// its place in m_ramCacheLru
+	};
+
+	std::unordered_map<UINT64, RamModelEntry> m_ramModelCache;	// polygon RAM models that have stayed unchanged, keyed by content hash
+	std::list<UINT64> m_ramCacheLru;							// their hashes, least recently drawn first
+	std::vector<UINT64> m_ramCacheOrder;						// their hashes in the order of their vertices
+	std::vector<PackedVertex> m_ramCacheVerts;					// their vertices, the vbo part after the rom models. Least recently used ones are evicted when full
+	size_t m_ramCacheSynced = 0;								// leading vertices of m_ramCacheVerts the renderer has uploaded, lowered when models move
+	size_t m_ramCachePinned = 0;								// vertices of the cached models drawn this frame, which can't be evicted
+	UINT32 m_ramCacheFrame = 0;									// counts ReleaseScene() calls
+	bool m_ramCacheFull = false;								// a model didn't fit this frame, the frame's other new models stay dynamic
+	bool m_cachingRamModel = false;								// CacheModel() writes to m_ramCacheVerts
+	std::unordered_set<UINT64> m_ramHashesLastFrame;			// hashes of the uncached polygon RAM models drawn last frame
+	std::unordered_set<UINT64> m_ramHashesThisFrame;
+
+	struct CachedPoly
+	{
+		UINT64 key;			// mesh state key, polys with equal keys end up in the same mesh
+		UINT32 firstVert;	// range in m_cacheVerts
+		UINT32 numVerts;
+		UINT32* header;		// first poly of each key supplies the mesh values
+	};
+
+	std::vector<FVertex> m_cacheVerts;			// scratch space for CacheModel, reused between models so converting doesn't allocate
+	std::vector<CachedPoly> m_cachePolys[2];	// radix sort ping-pongs between these
+
+	struct
+	{
+		float bnlu;
+		float bnlv;
+		float bntu;
+		float bntw;
+		float bnru;
+		float bnrv;
+		float bnbu;
+		float bnbw;
+		float correction;
+
+		float cullZ[4];		// left, top, right, bottom plane coefficients for z, x and y
+		float cullX[4];		// with the widescreen correction already applied
+		float cullY[4];
+	} m_planes;
+};
+
+} // New3D
+
+#endif  // INCLUDED_NEW3DSCENE_H
@@ -7,6 +7,7 @@ VBO::VBO()
 	m_target	= 0;
 	m_capacity	= 0;
 	m_size		= 0;
+	m_mapping	= nullptr;
 }
 
 void VBO::Create(GLenum target, GLenum usage, GLsizeiptr size, const void* data)
@@ -22,6 +23,69 @@ void VBO::Create(GLenum target, GLenum usage, GLsizeiptr size, const void* data)
 	Bind(false);		// unbind
 }
 
+bool VBO::PersistentMappingSupported()
+{
+#if defined(ANDROID) || defined(CORE_GLES)
+	return false;		// GLES only has it as an extension
+#else
+	if (!glBufferStorage) {
+		return false;
+	}
+
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+
+	if (major > 4 || (major == 4 && minor >= 4)) {
+		return true;
+	}
+
+	GLint numExtensions = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+
+	for (GLint i = 0; i < numExtensions; i++) {
+		const char* ext = (const char*)glGetStringi(GL_EXTENSIONS, i);
+		if (ext && strcmp(ext, "GL_ARB_buffer_storage") == 0) {
+			return true;
+		}
+	}
+
+	return false;
+#endif
+}
+
+bool VBO::CreatePersistent(GLenum target, GLsizeiptr size)
+{
+	if (!PersistentMappingSupported()) {
+		return false;
+	}
+
+#if defined(ANDROID) || defined(CORE_GLES)
+	return false;
+#else
+	// coherent, so writes through the mapping need no flushing. Dynamic storage keeps BufferSubData() working
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	glGenBuffers(1, &m_id);
+	glBindBuffer(target, m_id);
+	glBufferStorage(target, size, nullptr, flags | GL_DYNAMIC_STORAGE_BIT);
+	m_mapping = glMapBufferRange(target, 0, size, flags);
+
+	m_target	= target;
+	m_capacity	= (int)size;
+	m_size		= 0;
+
+	if (!m_mapping) {
+		Bind(false);
+		Destroy();
+		return false;
+	}
+
+	Bind(false);
+	return true;
+#endif
+}
+
 void VBO::BufferSubData(GLintptr offset, GLsizeiptr size, const GLvoid* data)
 {
 	glBufferSubData(m_target, offset, size, data);
@@ -30,7 +94,7 @@ void VBO::BufferSubData(GLintptr offset, GLsizeiptr size, const GLvoid* data)
 void VBO::UpdateDynamic(GLintptr offset, GLsizeiptr size, const GLvoid* data)
 {
 	// GL_MAP_UNSYNCHRONIZED_BIT: skip driver GPU sync — safe because the caller
-	// double-buffers the region (writes to slot N while GPU reads slot N-1).
+	// fences the region (only writes slots the GPU has finished reading).
 	// GL_MAP_INVALIDATE_RANGE_BIT: allow driver to return new backing memory.
 	void* ptr = glMapBufferRange(m_target, offset, size,
 	    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
@@ -67,6 +131,12 @@ void VBO::Reset()
 void VBO::Destroy()
 {
 	if (m_id) {
+		if (m_mapping) {
+			glBindBuffer(m_target, m_id);
+			glUnmapBuffer(m_target);
+			glBindBuffer(m_target, 0);
+			m_mapping = nullptr;
+		}
 		glDeleteBuffers(1, &m_id);
 		m_id		= 0;
 		m_target	= 0;
@@ -94,3 +164,8 @@ int VBO::GetCapacity() const
 {
 	return m_capacity;
 }
+
+void* VBO::GetMapping() const
+{
+	return m_mapping;
+}
@@ -9,6 +9,7 @@ public:
 	VBO();
 
 	void Create			(GLenum target, GLenum usage, GLsizeiptr size, const void* data=nullptr);
+	bool CreatePersistent(GLenum target, GLsizeiptr size);	// false if the GL can't keep a buffer mapped, Create() it instead
 	void BufferSubData	(GLintptr offset, GLsizeiptr size, const GLvoid* data);
 	void UpdateDynamic	(GLintptr offset, GLsizeiptr size, const GLvoid* data);
 	bool AppendData		(GLsizeiptr size, const GLvoid* data);
@@ -17,12 +18,16 @@ public:
 	void Bind			(bool enable);
 	int  GetSize		() const;
 	int  GetCapacity	() const;
+	void* GetMapping	() const;	// write only, null unless created persistent
 
 private:
+	static bool PersistentMappingSupported();
+
 	GLuint		m_id;
 	GLenum		m_target;
 	int			m_capacity;
 	int			m_size;
+	void*		m_mapping;
 };
 
 #endif
@@ -1,9 +1,36 @@
 #include "Vec.h"
 #include <cmath>
 #include <algorithm>
+#include "Util/SIMD.h"
 
 namespace New3D {
 
+// x*x + y*y + z*z, added up in that order on every path so the results match the scalar code
+static inline float SumOfSquares(const float* v)
+{
+#if defined(SUPERMODEL_SIMD_SSE2)
+
+	__m128 a = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((const double*)v)), _mm_load_ss(v + 2));	// x, y, z, 0 without reading past z
+	__m128 sq = _mm_mul_ps(a, a);
+	__m128 s = _mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1)));
+	s = _mm_add_ss(s, _mm_movehl_ps(sq, sq));
+
+	return _mm_cvtss_f32(s);
+
+#elif defined(SUPERMODEL_SIMD_NEON)
+
+	float32x4_t a = vcombine_f32(vld1_f32(v), vld1_dup_f32(v + 2));
+	float32x4_t sq = vmulq_f32(a, a);
+
+	return (vgetq_lane_f32(sq, 0) + vgetq_lane_f32(sq, 1)) + vgetq_lane_f32(sq, 2);
+
+#else
+
+	return v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+
+#endif
+}
+
 void V3::subtract(const Vec3 a, const Vec3 b, Vec3 out) {
 
 	out[0] = a[0] - b[0];
@@ -90,7 +117,7 @@ float V3::length(const Vec3 v) {
 	float length;
 	//===========
 	
-	length = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+	length = SumOfSquares(v);
 	length = std::sqrt(length);
 
 	return length;
@@ -102,7 +129,7 @@ void V3::normalise(Vec3 v) {
 	float inv_len;
 	//========
 
-	inv_len = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+	inv_len = SumOfSquares(v);
 	inv_len = 1.f/std::sqrt(inv_len);
 
 	multiply(v,inv_len);
@@ -0,0 +1,139 @@
+/**
+** Supermodel
+** A Sega Model 3 Arcade Emulator.
+** Copyright 2011-2012 Bart Trzynadlowski, Nik Henson
+**
+** This file is part of Supermodel.
+**
+** Supermodel is free software: you can redistribute it and/or modify it under
+** the terms of the GNU General Public License as published by the Free
+** Software Foundation, either version 3 of the License, or (at your option)
+** any later version.
+**
+** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+** more details.
+**
+** You should have received a copy of the GNU General Public License along
+** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+**/
+
+/*
+ * NullRender.cpp
+ *
+ * Renderers that draw nothing. See NullRender.h.
+ */
+
+#include "NullRender.h"
+
+/******************************************************************************
+ CNullRender2D
+******************************************************************************/
+
+void CNullRender2D::BeginFrame(void)
+{
+}
+
+void CNullRender2D::PreRenderFrame(void)
+{
+}
+
+void CNullRender2D::RenderFrameBottom(void)
+{
+}
+
+void CNullRender2D::RenderFrameTop(void)
+{
+}
+
+void CNullRender2D::EndFrame(void)
+{
+}
+
+void CNullRender2D::AttachRegisters(const uint32_t *)
+{
+}
+
+void CNullRender2D::AttachVRAM(const uint8_t *)
+{
+}
+
+void CNullRender2D::AttachDrawBuffers(std::shared_ptr<TileGenBuffer>, std::shared_ptr<TileGenBuffer>)
+{
+}
+
+Result CNullRender2D::Init(unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, UpscaleMode)
+{
+  return Result::OKAY;
+}
+
+/******************************************************************************
+ CNullRender3D
+******************************************************************************/
+
+void CNullRender3D::RenderFrame(void)
+{
+  {
+    std::lock_guard<std::mutex> guard(m_losMutex);
+    std::swap(m_losBack, m_losFront);
+    for (int i = 0; i < 4; i++) {
+      m_losBack->value[i] = 0;
+    }
+  }
+
+  m_lastFrameStats = m_frameStats;
+  m_frameStats = Render3DStats();
+
+  if (!m_traverseScene) {
+    return;
+  }
+
+  ReleaseScene();
+
+  if (m_blockCulling && !m_noWhiteFlash) {   // block culling disables 3D rendering
+    return;
+  }
+
+  // the rom models have no vbo to live in, flush them the way the GL renderer does when its buffer is full
+  if (m_polyBufferRom.size() >= MAX_ROM_VERTS) {
+    FlushRomModels();
+  }
+
+  BuildScene();
+
+  for (const auto &n : m_nodes) {
+    for (const auto &m : n.models) {
+      m_frameStats.meshes += (unsigned)m.meshes->size();
+    }
+  }
+}
+
+void CNullRender3D::BeginFrame(void)
+{
+}
+
+void CNullRender3D::EndFrame(void)
+{
+}
+
+void CNullRender3D::UploadTextures(unsigned, unsigned, unsigned, unsigned, unsigned)
+{
+}
+
+Result CNullRender3D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes, unsigned)
+{
+  SetResolution(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes);
+  return Result::OKAY;
+}
+
+Render3DStats CNullRender3D::GetStats(void) const
+{
+  return m_lastFrameStats;
+}
+
+CNullRender3D::CNullRender3D(const Util::Config::Node &config, const std::string &gameName, bool traverseScene)
+  : CNew3DScene(config, gameName),
+    m_traverseScene(traverseScene)
+{
+}
@@ -0,0 +1,93 @@
+/**
+** Supermodel
+** A Sega Model 3 Arcade Emulator.
+** Copyright 2011-2012 Bart Trzynadlowski, Nik Henson
+**
+** This file is part of Supermodel.
+**
+** Supermodel is free software: you can redistribute it and/or modify it under
+** the terms of the GNU General Public License as published by the Free
+** Software Foundation, either version 3 of the License, or (at your option)
+** any later version.
+**
+** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+** more details.
+**
+** You should have received a copy of the GNU General Public License along
+** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+**/
+
+/*
+ * NullRender.h
+ *
+ * Header file defining the CNullRender2D and CNullRender3D classes: renderers
+ * that accept everything the tile generator and Real3D hand them and draw
+ * nothing. They let the emulator run without a GL context, for batch runs and
+ * for measuring the emulated machine apart from the host GPU. The 3D renderer
+ * can optionally still walk the scene database and convert models every
+ * frame, so that half of the renderer's cost can be profiled on its own.
+ */
+
+#ifndef INCLUDED_NULLRENDER_H
+#define INCLUDED_NULLRENDER_H
+
+#include <memory>
+#include <string>
+#include "IRender2D.h"
+#include "New3D/New3DScene.h"
+#include "Util/NewConfig.h"
+
+class CNullRender2D : public IRender2D
+{
+public:
+  void BeginFrame(void);
+  void PreRenderFrame(void);
+  void RenderFrameBottom(void);
+  void RenderFrameTop(void);
+  void EndFrame(void);
+  void AttachRegisters(const uint32_t *regPtr);
+  void AttachVRAM(const uint8_t *vramPtr);
+  void AttachDrawBuffers(std::shared_ptr<TileGenBuffer> bottom, std::shared_ptr<TileGenBuffer> top);
+  Result Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes, unsigned aaTarget, UpscaleMode upscaleMode);
+};
+
+class CNullRender3D : public New3D::CNew3DScene
+{
+public:
+  /*
+   * RenderFrame(void):
+   *
+   * Swaps the line of sight buffers like a real renderer would, so LOS reads
+   * return 0 rather than stale values. With scene traversal enabled, the
+   * scene database is also built into meshes and then discarded.
+   */
+  void RenderFrame(void);
+  void BeginFrame(void);
+  void EndFrame(void);
+  void UploadTextures(unsigned level, unsigned x, unsigned y, unsigned width, unsigned height);
+  Result Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes, unsigned aaTarget);
+  Render3DStats GetStats(void) const;
+
+  /*
+   * CNullRender3D(config, gameName, traverseScene):
+   *
+   * Constructor.
+   *
+   * Parameters:
+   *    config          Run-time configuration.
+   *    gameName        Name of the game.
+   *    traverseScene   Build the scene every frame even though it is never
+   *                    drawn. Only meshes are counted in the stats.
+   */
+  CNullRender3D(const Util::Config::Node &config, const std::string &gameName, bool traverseScene);
+
+private:
+  bool m_traverseScene;
+
+  Render3DStats m_frameStats;
+  Render3DStats m_lastFrameStats;
+};
+
+#endif  // INCLUDED_NULLRENDER_H
@@ -287,6 +287,7 @@
 
 #include "Render2D.h"
 
+#include <algorithm>
 #include "Supermodel.h"
 #include "Shader.h"
 #include "Shaders2D.h" // fragment and vertex shaders
@@ -323,7 +324,7 @@ void CRender2D::Setup2D(bool isBottom)
 	}
 
 	// Set up the viewport and orthogonal projection
-	bool stretchBottom = m_config["WideBackground"].ValueAs<bool>() && isBottom;
+	bool stretchBottom = m_wideBackground.Get() && isBottom;
 	if (!stretchBottom)
 	{
 		glViewport(m_xOffset - m_correction, m_yOffset + m_correction, m_xPixels, m_yPixels); //Preserve aspect ratio of tile layer by constraining and centering viewport
@@ -363,8 +364,45 @@ void CRender2D::PreRenderFrame(void)
 
 	for (int i = 0; i < 2; i++) {
 		if (!m_drawBuffers[i]) continue;		// we don't have a draw buffer yet
-		glBindTexture(GL_TEXTURE_2D, m_textureIDs[i]);
-		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 496, 384, GL_RGBA, GL_UNSIGNED_BYTE, m_drawBuffers[i]->data);
+
+		const UINT64* lineHash = m_drawBuffers[i]->lineHash;
+
+		if (!m_textureValid[i]) {
+			glBindTexture(GL_TEXTURE_2D, m_textureIDs[i]);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 496, 384, GL_RGBA, GL_UNSIGNED_BYTE, m_drawBuffers[i]->data);
+			std::copy(lineHash, lineHash + 384, m_uploadedHash[i]);
+			m_textureValid[i] = true;
+			continue;
+		}
+
+		// upload runs of changed lines, short gaps of unchanged ones are cheaper to send along than to split the upload over
+		bool bound = false;
+		int line = 0;
+
+		while (line < 384) {
+
+			if (lineHash[line] == m_uploadedHash[i][line]) {
+				line++;
+				continue;
+			}
+
+			int start	= line;
+			int end		= line + 1;
+
+			for (line = end; line < 384 && line - end < MAX_UPLOAD_GAP; line++) {
+				if (lineHash[line] != m_uploadedHash[i][line]) {
+					end = line + 1;
+				}
+			}
+
+			if (!bound) {
+				glBindTexture(GL_TEXTURE_2D, m_textureIDs[i]);
+				bound = true;
+			}
+
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, start, 496, end - start, GL_RGBA, GL_UNSIGNED_BYTE, m_drawBuffers[i]->GetLine(start));
+			std::copy(lineHash + start, lineHash + end, m_uploadedHash[i] + start);
+		}
 	}
 
 	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
@@ -453,11 +491,14 @@ Result CRender2D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsign
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 496, 384, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 	}
 
+	m_textureValid[0] = m_textureValid[1] = false;		// contents undefined until the first full upload
+
 	return Result::OKAY;
 }
 
 CRender2D::CRender2D(const Util::Config::Node& config)
 	: m_config(config),
+	m_wideBackground(config, "WideBackground"),
 	m_vao(0)
 {
 	glGenVertexArrays(1, &m_vao);
@@ -34,6 +34,7 @@
 #include "Util/NewConfig.h"
 #include "New3D/GLSLShader.h"
 #include "FBO.h"
+#include "IRender2D.h"
 #include "../Model3/TileGenBuffer.h"
 
   /*
@@ -44,7 +45,7 @@
    * the constructor, all members assume that a global GL device
    * context is available and that GL functions may be called.
    */
-class CRender2D
+class CRender2D : public IRender2D
 {
 public:
 	/*
@@ -193,6 +194,7 @@ private:
 
 	// Run-time configuration
 	const Util::Config::Node& m_config;
+	Util::Config::Setting<bool> m_wideBackground;
 
 	// OpenGL data
 	unsigned  m_xPixels = 496;  // display surface resolution
@@ -209,6 +211,11 @@ private:
 	GLuint m_textureIDs[2];
 	GLSLShader m_drawShader;
 	std::shared_ptr<TileGenBuffer> m_drawBuffers[2];
+
+	// Line hashes of what the textures hold, only lines whose hash differs from the draw buffer's are uploaded
+	static const int MAX_UPLOAD_GAP = 8;	// unchanged lines between two changed ones that are uploaded rather than split at
+	UINT64 m_uploadedHash[2][384];
+	bool m_textureValid[2] = { false, false };
 };
 
 
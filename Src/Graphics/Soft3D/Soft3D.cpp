@@ -0,0 +1,690 @@
+#include "Soft3D.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace New3D;
+
+namespace Soft3D {
+
+#define GUARD_BAND 4.0f			// triangles are only clipped in x/y once they reach this many viewport widths, the rest is done by the scissor
+
+CSoft3D::CSoft3D(const Util::Config::Node &config, const std::string& gameName, unsigned numThreads) :
+	CNew3DScene(config, gameName),
+	m_pool(numThreads),
+	m_texSheet(2048 * 2048, 0)
+{
+	m_numPolyVerts = 3;			// the rasterizer only does triangles, quads are split when the models are converted
+}
+
+CSoft3D::~CSoft3D()
+{
+}
+
+Result CSoft3D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXResParam, unsigned totalYResParam, unsigned)
+{
+	SetResolution(xOffset, yOffset, xRes, yRes, totalXResParam, totalYResParam);
+
+	m_width		= totalXResParam;
+	m_height	= totalYResParam;
+	m_tilesX	= (m_width + TILE_SIZE - 1) / TILE_SIZE;
+	m_tilesY	= (m_height + TILE_SIZE - 1) / TILE_SIZE;
+
+	size_t pixels = (size_t)m_width * m_height;
+
+	for (auto& layer : m_layers) {
+		layer.assign(pixels, 0);
+	}
+
+	m_depth.depth.assign(pixels, 0.0f);
+	m_depth.stencil.assign(pixels, 0);
+	m_depthCopy = m_depth;
+	m_frameBuffer.assign(pixels, 0);
+
+	for (auto& chunk : m_chunks) {
+		chunk.bins.clear();			// tile count might have changed
+	}
+
+	return Result::OKAY;
+}
+
+void CSoft3D::UploadTextures(unsigned, unsigned x, unsigned y, unsigned width, unsigned height)
+{
+	if (!m_textureRAM) {
+		return;
+	}
+
+	// handle case of entire sheet invalidation
+	if (width == 2048 && height == 2048) {
+		memcpy(m_texSheet.data(), m_textureRAM, m_texSheet.size() * sizeof(UINT16));
+		return;
+	}
+
+	// the mip levels are stored in the sheet next to the base level, so the coordinates are all we need
+	x		= std::min(x, 2048u);
+	y		= std::min(y, 2048u);
+	width	= std::min(width, 2048 - x);
+	height	= std::min(height, 2048 - y);
+
+	for (unsigned i = 0; i < height; i++) {
+		size_t offset = (size_t)(y + i) * 2048 + x;
+		memcpy(&m_texSheet[offset], &m_textureRAM[offset], width * sizeof(UINT16));
+	}
+}
+
+const UINT32 *CSoft3D::GetFrameBuffer() const
+{
+	return m_frameBuffer.data();
+}
+
+unsigned CSoft3D::GetWidth() const
+{
+	return m_width;
+}
+
+unsigned CSoft3D::GetHeight() const
+{
+	return m_height;
+}
+
+Render3DStats CSoft3D::GetStats(void) const
+{
+	return m_lastFrameStats;
+}
+
+void CSoft3D::BeginFrame(void)
+{
+}
+
+void CSoft3D::EndFrame(void)
+{
+}
+
+void CSoft3D::RenderFrame(void)
+{
+	{
+		std::lock_guard<std::mutex> guard(m_losMutex);
+		std::swap(m_losBack, m_losFront);
+		for (int i = 0; i < 4; i++) {
+			m_losBack->value[i] = 0;
+		}
+	}
+
+	m_lastFrameStats = m_frameStats;
+	m_frameStats = Render3DStats();
+
+	ReleaseScene();
+
+	if (m_blockCulling && !m_noWhiteFlash)		// block culling disables 3D rendering
+	{
+		std::fill(m_frameBuffer.begin(), m_frameBuffer.end(), 0xFFFFFFFF);		// clear screen to white
+		return;
+	}
+
+	// there is no vbo to overflow, but don't let the rom models grow without bounds either
+	// this has to happen before the scene is built, meshes of this frame point into the buffer
+	if (m_polyBufferRom.size() >= MAX_ROM_VERTS) {
+		FlushRomModels();
+	}
+
+	BuildScene();
+
+	for (auto& layer : m_layers) {
+		std::fill(layer.begin(), layer.end(), 0);
+	}
+
+	FogLayer fog;
+
+	if (GetAmbientFog(fog)) {
+		DrawFog(fog);
+	}
+
+	if (GetScrollFog(fog)) {
+		DrawFog(fog);							// fog layer if applicable must be drawn here
+	}
+
+	for (int pri = 0; pri <= 3; pri++) {
+
+		if (SkipLayer(pri)) continue;
+
+		for (int i = 0; i < 2; i++) {
+
+			bool renderOverlay = (i == 1);
+
+			ClearDepth(m_depth);
+
+			bool hasOverlay = RenderPass(pri, renderOverlay, Layer::colour, true, false, m_depth);
+
+			if (!renderOverlay) {
+				ProcessLos(pri);
+			}
+
+			if (HasTransparentMeshes(pri, renderOverlay)) {
+				m_depthCopy.depth	= m_depth.depth;
+				m_depthCopy.stencil	= m_depth.stencil;
+
+				RenderPass(pri, renderOverlay, Layer::trans1, false, true, m_depth);
+				RenderPass(pri, renderOverlay, Layer::trans2, false, true, m_depthCopy);
+			}
+
+			if (!hasOverlay) break;				// no high priority polys
+		}
+	}
+
+	Composite();
+}
+
+void CSoft3D::ClearDepth(DepthStencil& ds)
+{
+	std::fill(ds.depth.begin(), ds.depth.end(), 0.0f);
+	std::fill(ds.stencil.begin(), ds.stencil.end(), 0);
+}
+
+bool CSoft3D::RenderPass(int priority, bool renderOverlay, Layer layer, bool discardAlpha, bool greater, DepthStencil& depth)
+{
+	bool hasOverlay = false;		// (high priority polys)
+	size_t totalVerts = 0;
+
+	m_drawStates.clear();
+
+	for (auto &n : m_nodes) {
+
+		if (n.viewport.priority != priority || n.models.empty()) {
+			continue;
+		}
+
+		CalcViewport(&n.viewport);
+
+		for (auto &m : n.models) {
+
+			if (m.meshes->empty()) {
+				continue;
+			}
+
+			for (auto &mesh : *m.meshes) {
+
+				if (mesh.highPriority) {
+					hasOverlay = true;
+				}
+
+				if (!mesh.Render(layer, m.alpha)) continue;
+				if (mesh.highPriority != renderOverlay) continue;
+
+				m_frameStats.meshes++;
+
+				DrawState ds;
+				ds.vp		= &n.viewport;
+				ds.model	= &m;
+				ds.mesh		= &mesh;
+
+				for (int c = 0; c < 3; c++) {
+					for (int r = 0; r < 3; r++) {
+						ds.normalMat[c * 3 + r] = m.modelMat[c * 4 + r] / m.scale;
+					}
+				}
+
+				m_drawStates.push_back(ds);
+				totalVerts += mesh.vertexCount;
+			}
+		}
+	}
+
+	if (m_drawStates.empty() || m_width == 0 || m_height == 0) {
+		return hasOverlay;
+	}
+
+	// split the meshes into chunks with about the same number of vertices
+	// more chunks than threads so a chunk with a lot of clipping doesn't hold everyone up
+	unsigned numChunks	= (unsigned)std::min<size_t>(m_drawStates.size(), m_pool.GetNumThreads() * 4);
+	size_t perChunk		= totalVerts / numChunks + 1;
+
+	if (m_chunks.size() < numChunks) {
+		m_chunks.resize(numChunks);
+	}
+
+	m_numChunks = 0;
+	size_t verts = 0;
+
+	for (unsigned s = 0; s < m_drawStates.size(); s++) {
+
+		if (verts == 0) {
+			m_chunks[m_numChunks].firstState = s;
+		}
+
+		verts += m_drawStates[s].mesh->vertexCount;
+
+		if (verts >= perChunk || s + 1 == m_drawStates.size()) {
+			m_chunks[m_numChunks++].lastState = s + 1;
+			verts = 0;
+		}
+	}
+
+	m_pool.ParallelFor(m_numChunks, [this](unsigned i, unsigned) {
+		SetupChunk(m_chunks[i]);
+	});
+
+	Pass pass;
+	pass.layer			= layer;
+	pass.discardAlpha	= discardAlpha;
+	pass.greater		= greater;
+	pass.depth			= &depth;
+
+	m_pool.ParallelFor(m_tilesX * m_tilesY, [this, &pass](unsigned tile, unsigned) {
+		RasterTile(tile, pass);
+	});
+
+	return hasOverlay;
+}
+
+const PackedVertex* CSoft3D::GetVertices(const Model& model, const Mesh& mesh) const
+{
+	// same layout as the New3D vbo: rom models, cached polygon RAM models, then a slot for this frame's dynamic models
+	const PackedVertex* buffer	= m_polyBufferRom.data();
+	size_t size					= m_polyBufferRom.size();
+	size_t offset				= mesh.vboOffset;
+
+	if (model.dynamic) {
+		buffer	= m_polyBufferRam.data();
+		size	= m_polyBufferRam.size();
+		offset	= mesh.vboOffset - (RAM_SLOT_BASE + m_ramSlot * MAX_RAM_VERTS);
+	}
+	else if (mesh.vboOffset >= MAX_ROM_VERTS) {
+		buffer	= m_ramCacheVerts.data();
+		size	= m_ramCacheVerts.size();
+		offset	= mesh.vboOffset - MAX_ROM_VERTS;
+	}
+
+	if (offset + mesh.vertexCount > size) {
+		return nullptr;
+	}
+
+	return buffer + offset;
+}
+
+void CSoft3D::SetupChunk(Chunk& chunk) const
+{
+	chunk.tris.clear();
+	chunk.bins.resize(m_tilesX * m_tilesY);
+
+	for (auto& bin : chunk.bins) {
+		bin.clear();
+	}
+
+	for (unsigned s = chunk.firstState; s < chunk.lastState; s++) {
+
+		const DrawState& ds	= m_drawStates[s];
+		const Mesh& mesh	= *ds.mesh;
+		const Model& model	= *ds.model;
+		const float* mv		= model.modelMat;
+		const float* proj	= ds.vp->projectionMatrix;
+
+		const PackedVertex* verts = GetVertices(model, mesh);
+
+		if (!verts) {
+			continue;
+		}
+
+		for (int first = 0; first + 3 <= mesh.vertexCount; first += 3) {
+
+			ClipVertex cv[3];
+			Triangle proto;
+
+			// the vertex shader
+			for (int k = 0; k < 3; k++) {
+
+				const PackedVertex& pv = verts[first + k];
+				ClipVertex& v = cv[k];
+
+				const float pos[4] = { pv.pos[0], pv.pos[1], pv.pos[2], 1.0f };
+
+				float view[4];
+				New3D::Mat4::TransformPoint(mv, pos, view);
+				New3D::Mat4::TransformPoint(proj, view, v.pos);
+
+				float n[3], fn[3];
+				PackedVertex::UnpackNormal(pv.normal, n);
+				PackedVertex::UnpackNormal(pv.faceNormal, fn);
+
+				v.attr[ATTR_VX] = view[0];
+				v.attr[ATTR_VY] = view[1];
+				v.attr[ATTR_VZ] = view[2];
+
+				float backFace = 0.0f;
+
+				for (int r = 0; r < 3; r++) {
+					v.attr[ATTR_NX + r] = ds.normalMat[r] * n[0] + ds.normalMat[3 + r] * n[1] + ds.normalMat[6 + r] * n[2];
+					backFace += view[r] * (mv[r] * fn[0] + mv[4 + r] * fn[1] + mv[8 + r] * fn[2]);
+				}
+
+				v.attr[ATTR_U]			= pv.texcoords[0];
+				v.attr[ATTR_V]			= pv.texcoords[1];
+				v.attr[ATTR_SHADE]		= PackedVertex::HalfToFloat(pv.fixedShade);
+				v.attr[ATTR_BACKFACE]	= backFace;
+			}
+
+			// every fragment of a back facing poly is discarded, no need to get that far
+			if (cv[0].attr[ATTR_BACKFACE] > 0.0f && cv[1].attr[ATTR_BACKFACE] > 0.0f && cv[2].attr[ATTR_BACKFACE] > 0.0f) {
+				continue;
+			}
+
+			// face attributes are the same for every vertex
+			const PackedVertex& pv = verts[first];
+
+			for (int c = 0; c < 4; c++) {
+				proto.colour[c] = pv.faceColour[c] * (1.0f / 255.0f);
+			}
+
+			if (mesh.translatorMap) {
+				for (int c = 0; c < 3; c++) {
+					proto.colour[c] *= 16.0f;
+				}
+			}
+
+			proto.colour[3]	*= model.alpha;
+			proto.lodScale	= -ds.vp->cota * PackedVertex::HalfToFloat(pv.textureNP);
+			proto.state		= s;
+
+			ClipTriangle(cv, proto, chunk);
+		}
+	}
+}
+
+void CSoft3D::ClipTriangle(const ClipVertex* in, const Triangle& proto, Chunk& chunk) const
+{
+	// near plane, then the guard band
+	auto distance = [](const ClipVertex& v, int plane) {
+		switch (plane) {
+		case 0:		return v.pos[3] - NEAR_PLANE;
+		case 1:		return v.pos[3] * GUARD_BAND + v.pos[0];
+		case 2:		return v.pos[3] * GUARD_BAND - v.pos[0];
+		case 3:		return v.pos[3] * GUARD_BAND + v.pos[1];
+		default:	return v.pos[3] * GUARD_BAND - v.pos[1];
+		}
+	};
+
+	unsigned outside[3] = { 0, 0, 0 };
+
+	for (int k = 0; k < 3; k++) {
+		for (int plane = 0; plane < 5; plane++) {
+			if (distance(in[k], plane) < 0.0f) {
+				outside[k] |= 1 << plane;
+			}
+		}
+	}
+
+	if (outside[0] & outside[1] & outside[2]) {
+		return;				// all on the wrong side of one plane
+	}
+
+	if ((outside[0] | outside[1] | outside[2]) == 0) {
+		SetupTriangle(in[0], in[1], in[2], proto, chunk);
+		return;
+	}
+
+	ClipVertex buffer[2][3 + 5];
+	int count = 3;
+
+	std::copy(in, in + 3, buffer[0]);
+
+	ClipVertex* src = buffer[0];
+	ClipVertex* dst = buffer[1];
+
+	for (int plane = 0; plane < 5 && count >= 3; plane++) {
+
+		if (!((outside[0] | outside[1] | outside[2]) & (1 << plane))) {
+			continue;
+		}
+
+		int newCount = 0;
+
+		for (int k = 0; k < count; k++) {
+
+			const ClipVertex& a = src[k];
+			const ClipVertex& b = src[(k + 1) % count];
+			float da = distance(a, plane);
+			float db = distance(b, plane);
+
+			if (da >= 0.0f) {
+				dst[newCount++] = a;
+			}
+
+			if ((da >= 0.0f) != (db >= 0.0f)) {
+
+				float t = da / (da - db);
+				ClipVertex& v = dst[newCount++];
+
+				for (int i = 0; i < 4; i++) {
+					v.pos[i] = a.pos[i] + (b.pos[i] - a.pos[i]) * t;
+				}
+
+				for (int i = 0; i < NUM_ATTRIBS; i++) {
+					v.attr[i] = a.attr[i] + (b.attr[i] - a.attr[i]) * t;
+				}
+			}
+		}
+
+		count = newCount;
+		std::swap(src, dst);
+	}
+
+	for (int k = 1; k + 1 < count; k++) {
+		SetupTriangle(src[0], src[k], src[k + 1], proto, chunk);
+	}
+}
+
+void CSoft3D::SetupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, const Triangle& proto, Chunk& chunk) const
+{
+	const Viewport& vp = *m_drawStates[proto.state].vp;
+	const ClipVertex* v[3] = { &v0, &v1, &v2 };
+
+	float x[3], y[3], invW[3];
+
+	for (int k = 0; k < 3; k++) {
+		invW[k]	= 1.0f / v[k]->pos[3];
+		x[k]	= vp.x + (v[k]->pos[0] * invW[k] + 1.0f) * 0.5f * vp.width;
+		y[k]	= vp.y + (v[k]->pos[1] * invW[k] + 1.0f) * 0.5f * vp.height;
+	}
+
+	float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+
+	if (!(std::fabs(area) > 0.0f)) {
+		return;				// degenerate
+	}
+
+	int order[3] = { 0, 1, 2 };
+
+	if (area < 0.0f) {		// both windings are drawn, make them all counter clockwise
+		std::swap(order[1], order[2]);
+		area = -area;
+	}
+
+	// scissor to the viewport, the guard band lets the triangle extend past it
+	float minXf = std::min({ x[0], x[1], x[2] });
+	float maxXf = std::max({ x[0], x[1], x[2] });
+	float minYf = std::min({ y[0], y[1], y[2] });
+	float maxYf = std::max({ y[0], y[1], y[2] });
+
+	Triangle tri = proto;
+
+	tri.minX = std::max({ (int)std::ceil(minXf - 0.5f), vp.x, 0 });
+	tri.minY = std::max({ (int)std::ceil(minYf - 0.5f), vp.y, 0 });
+	tri.maxX = std::min({ (int)std::floor(maxXf - 0.5f), vp.x + vp.width - 1, (int)m_width - 1 });
+	tri.maxY = std::min({ (int)std::floor(maxYf - 0.5f), vp.y + vp.height - 1, (int)m_height - 1 });
+
+	if (tri.minX > tri.maxX || tri.minY > tri.maxY) {
+		return;				// falls between pixel centres
+	}
+
+	for (int k = 0; k < 3; k++) {
+		int i = order[k];
+		tri.x[k]	= x[i];
+		tri.y[k]	= y[i];
+		tri.invW[k]	= invW[i];
+
+		for (int a = 0; a < NUM_ATTRIBS; a++) {
+			tri.attr[k][a] = v[i]->attr[a] * invW[i];
+		}
+	}
+
+	// Edge i runs from vertex i+1 to i+2. Two triangles sharing an edge evaluate it
+	// from the same end point with the same deltas, so they get exactly opposite
+	// values and a pixel on the edge is never drawn twice or missed.
+	tri.inclusive = 0;
+
+	for (int i = 0; i < 3; i++) {
+
+		int a = (i + 1) % 3;
+		int b = (i + 2) % 3;
+
+		float dx = tri.x[b] - tri.x[a];
+		float dy = tri.y[b] - tri.y[a];
+
+		bool forward = tri.x[a] < tri.x[b] || (tri.x[a] == tri.x[b] && tri.y[a] < tri.y[b]);
+		int origin = forward ? a : b;		// the same end whichever way round the edge is walked
+
+		tri.edgeA[i] = -dy;
+		tri.edgeB[i] = dx;
+		tri.edgeX[i] = tri.x[origin];
+		tri.edgeY[i] = tri.y[origin];
+
+		// top-left rule, the interior is to the left of a counter clockwise edge
+		if (dy < 0.0f || (dy == 0.0f && dx < 0.0f)) {
+			tri.inclusive |= 1 << i;
+		}
+	}
+
+	tri.invArea = 1.0f / area;
+
+	UINT32 index = (UINT32)chunk.tris.size();
+	chunk.tris.push_back(tri);
+
+	for (int ty = tri.minY / TILE_SIZE; ty <= tri.maxY / TILE_SIZE; ty++) {
+		for (int tx = tri.minX / TILE_SIZE; tx <= tri.maxX / TILE_SIZE; tx++) {
+			chunk.bins[ty * m_tilesX + tx].push_back(index);
+		}
+	}
+}
+
+static inline void UnpackColour(UINT32 packed, float c[4])
+{
+	for (int i = 0; i < 4; i++) {
+		c[i] = ((packed >> (i * 8)) & 0xFF) * (1.0f / 255.0f);
+	}
+}
+
+void CSoft3D::DrawFog(const FogLayer& fog)
+{
+	const Viewport& vp = *fog.viewport;
+
+	int x0 = std::max(vp.x, 0);
+	int y0 = std::max(vp.y, 0);
+	int x1 = std::min(vp.x + vp.width, (int)m_width);
+	int y1 = std::min(vp.y + vp.height, (int)m_height);
+
+	// same as the New3D scroll fog shader
+	for (int y = y0; y < y1; y++) {
+		for (int x = x0; x < x1; x++) {
+
+			float ellipse = 0.0f;
+
+			if (fog.spotEllipse[2] != 0.0f && fog.spotEllipse[3] != 0.0f) {
+				float ex = (x + 0.5f - fog.spotEllipse[0]) / fog.spotEllipse[2];
+				float ey = (y + 0.5f - fog.spotEllipse[1]) / fog.spotEllipse[3];
+				ellipse = std::max(0.0f, 1.0f - (ex * ex + ey * ey));
+			}
+
+			float colour[4];
+
+			for (int i = 0; i < 3; i++) {
+				colour[i] = fog.rgba[i] * fog.ambient + fog.spotFogColor[i] * ellipse * fog.rgba[i] * fog.attenuation;
+			}
+
+			colour[3] = fog.rgba[3];
+
+			size_t index = (size_t)y * m_width + x;
+			m_layers[0][index] = PackColour(colour);
+			m_layers[1][index] = 0;
+			m_layers[2][index] = 0;
+		}
+	}
+}
+
+void CSoft3D::ProcessLos(int priority)
+{
+	for (const auto &n : m_nodes) {
+		if (n.viewport.priority == priority) {
+			if (n.viewport.losPosX || n.viewport.losPosY) {
+
+				int losX, losY;
+				TranslateLosPosition(n.viewport.losPosX, n.viewport.losPosY, losX, losY);
+
+				if (losX < 0 || losY < 0 || losX >= (int)m_width || losY >= (int)m_height) {
+					return;
+				}
+
+				size_t index	= (size_t)losY * m_width + losX;
+				UINT8 stencilVal= m_depth.stencil[index] & 0x80;
+				float zVal		= m_depth.depth[index] / NEAR_PLANE;
+
+				auto zValP = reinterpret_cast<unsigned char*>(&zVal);
+				if (stencilVal == 0) zValP[0] |= 1;
+				else                 zValP[0] &= 0xFE;
+				m_losBack->value[priority] = zVal;
+
+				return;
+			}
+		}
+	}
+}
+
+void CSoft3D::Composite()
+{
+	// same as the New3D composite shader, the rows are flipped on the way out
+	m_pool.ParallelFor(m_height, [this](unsigned y, unsigned) {
+
+		size_t src	= (size_t)y * m_width;
+		UINT32* dst	= &m_frameBuffer[(size_t)(m_height - 1 - y) * m_width];
+
+		for (unsigned x = 0; x < m_width; x++, src++) {
+
+			if (m_layers[1][src] == 0 && m_layers[2][src] == 0) {
+				// no translucency, the base layer is only premultiplied
+				UINT32 base = m_layers[0][src];
+				UINT32 a = base >> 24;
+				if (a == 0xFF || a == 0) {
+					dst[x] = a ? base : 0;
+					continue;
+				}
+			}
+
+			float base[4], t1[4], t2[4], trans[4];
+			UnpackColour(m_layers[0][src], base);
+			UnpackColour(m_layers[1][src], t1);
+			UnpackColour(m_layers[2][src], t2);
+
+			if (t1[3] * t2[3] > 0.0f) {
+				float blend = (t2[3] + (1.0f - t1[3])) * 0.5f;
+				for (int i = 0; i < 3; i++) {
+					trans[i] = t1[i] + (t2[i] - t1[i]) * blend;
+				}
+				trans[3] = 1.0f;
+			}
+			else if (t1[3] > 0.0f) {
+				std::copy(t1, t1 + 4, trans);
+			}
+			else {
+				std::copy(t2, t2 + 4, trans);
+			}
+
+			float out[4];
+			for (int i = 0; i < 3; i++) {
+				out[i] = trans[3] * trans[i] + (1.0f - trans[3]) * base[3] * base[i];
+			}
+			out[3] = trans[3] + base[3] - trans[3] * base[3];
+
+			dst[x] = PackColour(out);
+		}
+	});
+}
+
+} // Soft3D
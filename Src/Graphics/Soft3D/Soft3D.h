@@ -0,0 +1,238 @@
+/**
+** Supermodel
+** A Sega Model 3 Arcade Emulator.
+** Copyright 2011 Bart Trzynadlowski, Nik Henson
+**
+** This file is part of Supermodel.
+**
+** Supermodel is free software: you can redistribute it and/or modify it under
+** the terms of the GNU General Public License as published by the Free
+** Software Foundation, either version 3 of the License, or (at your option)
+** any later version.
+**
+** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+** more details.
+**
+** You should have received a copy of the GNU General Public License along
+** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+**/
+
+/*
+* Soft3D.h
+*
+* Header file defining the CSoft3D class: a software Real3D renderer. It shares
+* the scene traversal and model conversion of the New3D engine and replaces the
+* OpenGL half with a tile based rasterizer that runs on a pool of threads. The
+* shading follows the New3D shaders, so both engines should produce the same
+* image. The result is left in memory for the caller to present, which makes it
+* usable on hosts without a GPU.
+*/
+
+#ifndef INCLUDED_SOFT3D_H
+#define INCLUDED_SOFT3D_H
+
+#include <vector>
+#include <memory>
+#include "Types.h"
+#include "Graphics/New3D/New3DScene.h"
+#include "WorkerPool.h"
+
+namespace Soft3D {
+
+class CSoft3D final : public New3D::CNew3DScene
+{
+public:
+	/*
+	* RenderFrame(void):
+	*
+	* Renders the complete scene database into the frame buffer. Must be
+	* called between BeginFrame() and EndFrame().
+	*/
+	void RenderFrame(void) override;
+
+	/*
+	* BeginFrame(void):
+	*
+	* Prepare to render a new frame. Must be called once per frame prior to
+	* drawing anything.
+	*/
+	void BeginFrame(void) override;
+
+	/*
+	* EndFrame(void):
+	*
+	* Signals the end of rendering for this frame. Must be called last during
+	* the frame.
+	*/
+	void EndFrame(void) override;
+
+	/*
+	* UploadTextures(level, x, y, width, height):
+	*
+	* Signals that a portion of texture RAM has been updated. The renderer
+	* keeps its own copy of the texture sheet, like the GL textures of New3D,
+	* so changes only become visible once they are uploaded.
+	*
+	* Parameters:
+	*		level	Mipmap level (0-3).
+	*		x		X position within texture RAM.
+	*		y		Y position within texture RAM.
+	*		width	Width of texture data in texels.
+	*		height	Height.
+	*/
+	void UploadTextures(unsigned level, unsigned x, unsigned y, unsigned width, unsigned height) override;
+
+	/*
+	* Init(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes, aaTarget):
+	*
+	* One-time initialization of the context. Must be called before any other
+	* members (meaning it should be called even before being attached to any
+	* other objects that want to use it).
+	*
+	* Parameters:
+	*		xOffset		X offset of the viewable area within the frame buffer.
+	*		yOffset		Y offset.
+	*		xRes		Horizontal resolution of the viewable area.
+	*		yRes		Vertical resolution.
+	*		totalXRes	Horizontal resolution of the frame buffer.
+	*		totalYRes	Vertical resolution.
+	*		aaTarget	Ignored, there is no GL frame buffer to draw into.
+	*
+	* Returns:
+	*		OKAY.
+	*/
+	Result Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes, unsigned aaTarget) override;
+
+	Render3DStats GetStats(void) const override;
+
+	/*
+	* GetFrameBuffer(void):
+	*
+	* Returns the last rendered frame, totalXRes x totalYRes pixels with the
+	* top row first. Pixels are RGBA8 in memory order with premultiplied
+	* alpha, ready to be blended over the 2D layers the same way New3D
+	* composites its layers.
+	*/
+	const UINT32 *GetFrameBuffer(void) const;
+	unsigned GetWidth(void) const;
+	unsigned GetHeight(void) const;
+
+	/*
+	* CSoft3D(config, gameName, numThreads):
+	*
+	* Constructor.
+	*
+	* Parameters:
+	*		config		Run-time configuration.
+	*		gameName	Name of the game.
+	*		numThreads	Rendering threads, including the one calling
+	*					RenderFrame(). 0 uses one per hardware thread.
+	*/
+	CSoft3D(const Util::Config::Node &config, const std::string& gameName, unsigned numThreads = 0);
+	~CSoft3D(void);
+
+private:
+
+	static constexpr int TILE_SIZE = 32;		// tiles are the unit of work for the rasterizer threads
+
+	enum Attrib { ATTR_VX, ATTR_VY, ATTR_VZ, ATTR_NX, ATTR_NY, ATTR_NZ, ATTR_U, ATTR_V, ATTR_SHADE, ATTR_BACKFACE, NUM_ATTRIBS };
+
+	struct DrawState				// the uniforms of one mesh
+	{
+		const New3D::Viewport*	vp;
+		const New3D::Model*		model;
+		const New3D::Mesh*		mesh;
+		float					normalMat[9];		// mat3(modelMat) / modelScale
+	};
+
+	struct ClipVertex
+	{
+		float pos[4];				// clip space
+		float attr[NUM_ATTRIBS];
+	};
+
+	struct Triangle
+	{
+		float	x[3], y[3];			// window coordinates, y up like GL
+		float	invW[3];
+		float	attr[3][NUM_ATTRIBS];	// divided by w so they interpolate linearly in screen space
+		float	edgeA[3], edgeB[3];	// edge i (opposite vertex i) = edgeA*(x-edgeX) + edgeB*(y-edgeY)
+		float	edgeX[3], edgeY[3];
+		UINT32	inclusive;			// bit i set if pixels exactly on edge i belong to this triangle
+		float	invArea;
+		float	colour[4];
+		float	lodScale;			// -cota * textureNP, fsLODBase is the back face value times this
+		int		minX, minY, maxX, maxY;
+		UINT32	state;
+	};
+
+	struct Chunk					// the triangles one thread set up, kept in draw order
+	{
+		unsigned firstState, lastState;
+		std::vector<Triangle> tris;
+		std::vector<std::vector<UINT32>> bins;		// triangle indices per tile
+	};
+
+	struct DepthStencil
+	{
+		std::vector<float> depth;
+		std::vector<UINT8> stencil;
+	};
+
+	struct Pass
+	{
+		New3D::Layer	layer;
+		bool			discardAlpha;
+		bool			greater;	// depth test, GREATER instead of GEQUAL
+		DepthStencil*	depth;
+	};
+
+	bool RenderPass(int priority, bool renderOverlay, New3D::Layer layer, bool discardAlpha, bool greater, DepthStencil& depth);
+	void SetupChunk(Chunk& chunk) const;
+	void ClipTriangle(const ClipVertex* in, const Triangle& proto, Chunk& chunk) const;
+	void SetupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, const Triangle& proto, Chunk& chunk) const;
+	void RasterTile(unsigned tile, const Pass& pass);
+	void RasterTriangle(const Triangle& tri, int x0, int y0, int x1, int y1, const Pass& pass);
+	bool ShadeFragment(const Triangle& tri, const DrawState& ds, const Pass& pass, float fragX, float fragY, float invW, const float* attr, float out[4]) const;
+	bool GetTextureValue(const Triangle& tri, const DrawState& ds, const Pass& pass, float invW, const float* attr, float out[4]) const;
+	void TexBiLinear(int format, int page, const int wrapMode[2], int sizeX, int sizeY, int posX, int posY, float u, float v, int level, bool alphaTest, float out[4]) const;
+	void DrawFog(const FogLayer& fog);
+	void ProcessLos(int priority);
+	void Composite();
+	void ClearDepth(DepthStencil& ds);
+	static UINT32 PackColour(const float c[4]);		// to the RGBA8 of the layers, rounded like GL
+
+	const New3D::PackedVertex* GetVertices(const New3D::Model& model, const New3D::Mesh& mesh) const;
+
+	// Threads
+	CWorkerPool m_pool;
+
+	// Frame buffers, bottom row first like GL
+	unsigned				m_width		= 0;
+	unsigned				m_height	= 0;
+	std::vector<UINT32>		m_layers[3];	// colour, trans1, trans2 as RGBA8
+	DepthStencil			m_depth;
+	DepthStencil			m_depthCopy;	// the opaque depth the second transparent layer is tested against
+	std::vector<UINT32>		m_frameBuffer;	// composited output, top row first
+
+	// Tiles
+	unsigned				m_tilesX	= 0;
+	unsigned				m_tilesY	= 0;
+
+	// Per pass
+	std::vector<DrawState>	m_drawStates;
+	std::vector<Chunk>		m_chunks;
+	unsigned				m_numChunks = 0;
+
+	// Our copy of texture RAM, updated by UploadTextures()
+	std::vector<UINT16>		m_texSheet;
+
+	Render3DStats m_frameStats;
+	Render3DStats m_lastFrameStats;
+};
+
+} // Soft3D
+
+#endif  // INCLUDED_SOFT3D_H
@@ -0,0 +1,558 @@
+#include "Soft3D.h"
+#include <algorithm>
+#include <cmath>
+#include "Util/SIMD.h"
+
+/*
+* The fragment half of the software renderer. Everything in here follows the
+* New3D fragment shaders (R3DShaderTriangles.h and R3DShaderCommon.h), if one
+* changes the other should too.
+*/
+
+using namespace New3D;
+
+namespace Soft3D {
+
+static const int mipXBase[] = { 0, 1024, 1536, 1792, 1920, 1984, 2016, 2032, 2040, 2044, 2046, 2047 };
+static const int mipYBase[] = { 0, 512, 768, 896, 960, 992, 1008, 1016, 1020, 1022, 1023 };
+
+UINT32 CSoft3D::PackColour(const float c[4])
+{
+	UINT32 packed = 0;
+
+	for (int i = 0; i < 4; i++) {
+		float v = std::min(std::max(c[i], 0.0f), 1.0f);
+		packed |= (UINT32)(v * 255.0f + 0.5f) << (i * 8);
+	}
+
+	return packed;
+}
+
+static inline float Fract(float x)
+{
+	return x - std::floor(x);
+}
+
+static void ExtractColour(int type, UINT32 value, float c[4])
+{
+	auto grey = [&](float v, bool alphaKey) {
+		c[0] = c[1] = c[2] = c[3] = v;
+		if (alphaKey) {
+			c[3] = (c[3] == 1.0f) ? 0.0f : 1.0f;
+		}
+	};
+
+	switch (type) {
+	case 0:		// T1RGB5
+		c[0] = ((value >> 10) & 0x1F) * (1.0f / 31.0f);
+		c[1] = ((value >> 5) & 0x1F) * (1.0f / 31.0f);
+		c[2] = (value & 0x1F) * (1.0f / 31.0f);
+		c[3] = 1.0f - (float)((value >> 15) & 0x1);
+		break;
+	case 1:		// Interleaved A4L4 (low byte)
+		c[0] = c[1] = c[2] = (value & 0xF) * (1.0f / 15.0f);
+		c[3] = ((value >> 4) & 0xF) * (1.0f / 15.0f);
+		break;
+	case 2:
+		c[3] = (value & 0xF) * (1.0f / 15.0f);
+		c[0] = c[1] = c[2] = ((value >> 4) & 0xF) * (1.0f / 15.0f);
+		break;
+	case 3:
+		c[0] = c[1] = c[2] = ((value >> 8) & 0xF) * (1.0f / 15.0f);
+		c[3] = ((value >> 12) & 0xF) * (1.0f / 15.0f);
+		break;
+	case 4:
+		c[3] = ((value >> 8) & 0xF) * (1.0f / 15.0f);
+		c[0] = c[1] = c[2] = ((value >> 12) & 0xF) * (1.0f / 15.0f);
+		break;
+	case 5:
+		grey((value & 0xFF) / 255.0f, true);
+		break;
+	case 6:
+		grey(((value >> 8) & 0xFF) / 255.0f, true);
+		break;
+	case 7:		// RGBA4
+		c[0] = ((value >> 12) & 0xF) * (1.0f / 15.0f);
+		c[1] = ((value >> 8) & 0xF) * (1.0f / 15.0f);
+		c[2] = ((value >> 4) & 0xF) * (1.0f / 15.0f);
+		c[3] = (value & 0xF) * (1.0f / 15.0f);
+		break;
+	case 8:		// low byte, low nibble
+		grey((value & 0xF) / 15.0f, true);
+		break;
+	case 9:		// low byte, high nibble
+		grey(((value >> 4) & 0xF) / 15.0f, true);
+		break;
+	case 10:	// high byte, low nibble
+		grey(((value >> 8) & 0xF) / 15.0f, true);
+		break;
+	case 11:	// high byte, high nibble
+		grey(((value >> 12) & 0xF) / 15.0f, true);
+		break;
+	default:
+		grey(0.0f, false);
+		break;
+	}
+}
+
+static float LinearTexLocations(int wrapMode, float size, float u, float& u0, float& u1)
+{
+	float texelSize		= 1.0f / size;
+	float halfTexelSize	= 0.5f / size;
+
+	if (wrapMode == Mesh::repeat) {
+		u	= u * size - 0.5f;
+		u0	= (std::floor(u) + 0.5f) / size;		// + 0.5 offset added to push us into the centre of a pixel
+		u0	= Fract(u0);
+		u1	= u0 + texelSize;
+		u1	= Fract(u1);
+
+		return Fract(u);							// return weight
+	}
+
+	if (wrapMode == Mesh::repeatClamp) {
+		u = Fract(u);								// must force into 0-1 to start
+	}
+	else {											// mirror + mirror clamp - both are the same since the edge pixels are repeated anyway
+		float odd = std::floor(u - 2.0f * std::floor(u * 0.5f));	// odd values are mirrored
+		u = (odd > 0.0f) ? 1.0f - Fract(u) : Fract(u);
+	}
+
+	u	= u * size - 0.5f;
+	u0	= (std::floor(u) + 0.5f) / size;
+	u1	= u0 + texelSize;
+
+	if (u0 < 0.0f)	u0 = 0.0f;
+	if (u1 >= 1.0f)	u1 = 1.0f - halfTexelSize;
+
+	return Fract(u);
+}
+
+void CSoft3D::TexBiLinear(int format, int page, const int wrapMode[2], int sizeX, int sizeY, int posX, int posY, float u, float v, int level, bool alphaTest, float out[4]) const
+{
+	float tx[2], ty[2];
+	float a = LinearTexLocations(wrapMode[0], (float)sizeX, u, tx[0], tx[1]);
+	float b = LinearTexLocations(wrapMode[1], (float)sizeY, v, ty[0], ty[1]);
+
+	const UINT16* sheet = &m_texSheet[(size_t)(page * 1024 + mipYBase[level]) * 2048 + mipXBase[level]];
+	int maskX = 2047 >> level;
+	int maskY = 1023 >> level;
+
+	float p[2][2][4];		// [y][x]
+
+	for (int j = 0; j < 2; j++) {
+		for (int i = 0; i < 2; i++) {
+			int x = (int)(tx[i] * sizeX + posX) & maskX;
+			int y = (int)(ty[j] * sizeY + posY) & maskY;
+			ExtractColour(format, sheet[y * 2048 + x], p[j][i]);
+		}
+	}
+
+	if (alphaTest) {
+		// spread the colour of opaque texels into their transparent neighbours, so the edges don't go dark
+		auto copyRGB = [](const float* from, float* to) { to[0] = from[0]; to[1] = from[1]; to[2] = from[2]; };
+
+		if (p[0][0][3] > p[0][1][3])	{ copyRGB(p[0][0], p[0][1]); }
+		if (p[0][0][3] > p[1][0][3])	{ copyRGB(p[0][0], p[1][0]); }
+
+		if (p[0][1][3] > p[0][0][3])	{ copyRGB(p[0][1], p[0][0]); }
+		if (p[0][1][3] > p[1][1][3])	{ copyRGB(p[0][1], p[1][1]); }
+
+		if (p[1][0][3] > p[0][0][3])	{ copyRGB(p[1][0], p[0][0]); }
+		if (p[1][0][3] > p[1][1][3])	{ copyRGB(p[1][0], p[1][1]); }
+
+		if (p[1][1][3] > p[1][0][3])	{ copyRGB(p[1][1], p[1][0]); }
+		if (p[1][1][3] > p[0][1][3])	{ copyRGB(p[1][1], p[0][1]); }
+	}
+
+	for (int c = 0; c < 4; c++) {
+		float q0 = p[0][0][c] + (p[0][1][c] - p[0][0][c]) * a;
+		float q1 = p[1][0][c] + (p[1][1][c] - p[1][0][c]) * a;
+		out[c] = q0 + (q1 - q0) * b;
+	}
+}
+
+bool CSoft3D::GetTextureValue(const Triangle& tri, const DrawState& ds, const Pass& pass, float invW, const float* attr, float out[4]) const
+{
+	const Mesh& m		= *ds.mesh;
+	const Model& model	= *ds.model;
+
+	if (m.width <= 0 || m.height <= 0) {
+		return true;		// leaves the texture white
+	}
+
+	float lodBase	= attr[ATTR_BACKFACE] * tri.lodScale;
+	float lodArg	= invW * invW * lodBase;
+	float lod;
+
+	if (lodArg > 0.0f) {
+		lod = -std::log2(lodArg);
+	}
+	else {
+		lod = (lodArg == 0.0f) ? 1e30f : 0.0f;		// what the gpu gets out of log2 of zero or a negative number
+	}
+
+	float numLevels	= std::floor(std::log2((float)std::min(m.width, m.height))) - 1.0f;	// r3d only generates down to 2:2 for square textures, otherwise its the min dimension
+	float fLevel	= std::max(std::min(std::max(lod, 0.0f), numLevels), 0.0f);
+	int iLevel		= (int)fLevel;
+
+	int posX	= m.x + model.textureOffsetX;
+	int posY	= m.y + model.textureOffsetY;
+	int page	= (m.page ^ model.page) & 1;
+	int wrap[2]	= { m.wrapModeU, m.wrapModeV };
+
+	float tex1[4];
+	TexBiLinear(m.format, page, wrap, m.width >> iLevel, m.height >> iLevel, posX >> iLevel, posY >> iLevel, attr[ATTR_U], attr[ATTR_V], iLevel, m.alphaTest, tex1);
+
+	float tex2[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	float blendFactor = 0.0f;
+
+	float ffL = fLevel - (float)iLevel;
+
+	if (ffL > 0.0f) {
+		int level = iLevel + 1;
+		TexBiLinear(m.format, page, wrap, m.width >> level, m.height >> level, posX >> level, posY >> level, attr[ATTR_U], attr[ATTR_V], level, m.alphaTest, tex2);
+		blendFactor = ffL;
+	}
+	else if (m.microTexture && lod < 0.0f) {
+		static const float scaleIndex[] = { 2.0f, 4.0f, 16.0f, 256.0f };
+		static const int xCoords[8] = { 0, 0, 128, 128, 0, 0, 128, 128 };
+		static const int yCoords[8] = { 0, 128, 0, 128, 256, 384, 256, 384 };
+
+		int minLOD	= std::min(std::max((int)m.microTextureMinLOD, 0), 3);
+		int id		= m.microTextureID & 7;
+		float scaleU= (m.width / 128.0f) * scaleIndex[minLOD];
+		float scaleV= (m.height / 128.0f) * scaleIndex[minLOD];
+		int repeat[2] = { Mesh::repeat, Mesh::repeat };
+
+		// microtextures are always 128x128 and only use LOD 0 mipmap
+		TexBiLinear(m.format, page ^ 1, repeat, 128, 128, xCoords[id], yCoords[id], attr[ATTR_U] * scaleU, attr[ATTR_V] * scaleV, 0, m.alphaTest, tex2);
+
+		blendFactor = std::min(-lod * std::exp2(-m.microTextureMinLOD) * 0.5f, 0.5f);
+	}
+
+	for (int c = 0; c < 4; c++) {
+		out[c] = tex1[c] + (tex2[c] - tex1[c]) * blendFactor;
+	}
+
+	if (m.inverted) {
+		for (int c = 0; c < 3; c++) {
+			out[c] = 1.0f - out[c];
+		}
+	}
+
+	if (m.alphaTest && out[3] < (32.0f / 255.0f)) {
+		return false;
+	}
+
+	if (m.textureAlpha) {
+		if (pass.discardAlpha) {				// opaque 1st pass
+			if (out[3] < 1.0f) {
+				return false;
+			}
+		}
+		else if (out[3] * tri.colour[3] >= 1.0f) {	// transparent 2nd pass
+			return false;
+		}
+	}
+
+	if (!m.textureAlpha && !m.alphaTest) {
+		out[3] = 1.0f;
+	}
+
+	return true;
+}
+
+bool CSoft3D::ShadeFragment(const Triangle& tri, const DrawState& ds, const Pass& pass, float fragX, float fragY, float invW, const float* attr, float out[4]) const
+{
+	const Mesh& m		= *ds.mesh;
+	const Viewport& vp	= *ds.vp;
+	const float* lighting = vp.lightingParams;		// sun direction, then diffuse and ambient intensity
+
+	if (attr[ATTR_BACKFACE] > 0.0f) {
+		return false;		// emulate back face culling here
+	}
+
+	float viewZ = attr[ATTR_VZ];
+	float fog	= m.fogIntensity * std::min(std::max(vp.fogStart + -viewZ * vp.fogDensity, 0.0f), 1.0f);
+
+	float tex[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	if (m.textured && !GetTextureValue(tri, ds, pass, invW, attr, tex)) {
+		return false;
+	}
+
+	float col[4] = { tri.colour[0], tri.colour[1], tri.colour[2], tri.colour[3] };
+
+	// luminous polys on step 1.5 hardware
+	if (vp.hardwareStep == 0x15 && !m.lighting) {
+		float scale = m.fixedShading ? 1.0f + attr[ATTR_SHADE] + lighting[4] : 1.5f;
+		for (int c = 0; c < 3; c++) {
+			col[c] *= scale;
+		}
+	}
+
+	for (int c = 0; c < 4; c++) {
+		out[c] = tex[c] * col[c];
+	}
+
+	if (out[3] < (1.0f / 32.0f)) {
+		return false;		// basically chuck out any totally transparent pixels
+	}
+
+	// spotlight
+	float ellipse = 0.0f;
+
+	if (vp.spotEllipse[2] != 0.0f && vp.spotEllipse[3] != 0.0f) {
+		float ex = (fragX - vp.spotEllipse[0]) / vp.spotEllipse[2];
+		float ey = (fragY - vp.spotEllipse[1]) / vp.spotEllipse[3];
+		ellipse = std::max(0.0f, 1.0f - (ex * ex + ey * ey));
+	}
+
+	float enable	= (-viewZ < vp.spotRange[0]) ? 0.0f : 1.0f;
+	float range		= 0.0f;
+
+	if (vp.spotRange[1] != 0.0f) {
+		float absExtent	= std::fabs(vp.spotRange[1]);
+		float d			= std::min(vp.spotRange[0] + absExtent + viewZ, 0.0f);
+		float r			= d / (1.0f + absExtent) - 1.0f;
+
+		range = enable / (r * r);		// inverse-linear falloff
+	}
+
+	float lobeEffect	= range * ellipse;
+	float lobeFogEffect	= enable * ellipse;
+
+	if (m.lighting) {
+
+		const float* sunVector	= lighting;
+		const float* normal		= &attr[ATTR_NX];
+
+		float sunFactor = m.fixedShading ? attr[ATTR_SHADE] : sunVector[0] * normal[0] + sunVector[1] * normal[1] + sunVector[2] * normal[2];
+
+		sunFactor = std::min(std::max(sunFactor, -1.0f), 1.0f);
+
+		if (vp.sunClamp || out[3] < 0.999f) {
+			sunFactor = std::max(sunFactor, 0.0f);
+		}
+
+		for (int c = 0; c < 3; c++) {
+
+			float intensity = sunFactor * lighting[3] + lighting[4] + vp.spotColor[c] * lobeEffect;
+
+			if (vp.intensityClamp) {
+				intensity = std::min(intensity, 1.0f);
+			}
+
+			out[c] *= intensity;
+		}
+
+		if (m.specular) {
+
+			float specularFactor;
+
+			if (m.smoothShading) {
+				static const float expIndex[4]	= { 8.0f, 16.0f, 32.0f, 64.0f };
+				static const float multIndex[4]	= { 1.6f, 1.6f, 2.4f, 3.2f };
+
+				int shininess = std::min(std::max((int)m.shininess, 0), 3);
+
+				specularFactor = std::pow(std::max(0.0f, sunFactor), expIndex[shininess]) * multIndex[shininess];
+			}
+			else {
+				// R dot V with V = (0, 0, 1), so just the z of the reflected sun vector
+				float NdotL = sunVector[0] * normal[0] + sunVector[1] * normal[1] + sunVector[2] * normal[2];
+				specularFactor = std::max(0.0f, 2.0f * NdotL * normal[2] - sunVector[2]);
+			}
+
+			specularFactor *= m.specularValue * lighting[3];
+
+			if (col[3] < 1.0f) {
+				out[3] = std::max(out[3], specularFactor);		// specular hi-light affects translucent polygons alpha channel
+			}
+
+			for (int c = 0; c < 3; c++) {
+				out[c] += specularFactor;
+			}
+		}
+	}
+
+	for (int c = 0; c < 3; c++) {
+		float fogColour	= vp.fogColour[c] * vp.fogAmbient + vp.spotFogColor[c] * vp.fogAttenuation * vp.fogColour[c] * lobeFogEffect;
+		float colour	= std::min(out[c], 1.0f);
+
+		out[c] = colour + (fogColour - colour) * fog;
+	}
+
+	return true;
+}
+
+void CSoft3D::RasterTile(unsigned tile, const Pass& pass)
+{
+	int x0 = (int)(tile % m_tilesX) * TILE_SIZE;
+	int y0 = (int)(tile / m_tilesX) * TILE_SIZE;
+	int x1 = std::min(x0 + TILE_SIZE, (int)m_width) - 1;
+	int y1 = std::min(y0 + TILE_SIZE, (int)m_height) - 1;
+
+	// chunks are in draw order, so every pixel sees its triangles in the order the game drew them
+	for (unsigned c = 0; c < m_numChunks; c++) {
+
+		const Chunk& chunk = m_chunks[c];
+
+		for (UINT32 index : chunk.bins[tile]) {
+			const Triangle& tri = chunk.tris[index];
+			RasterTriangle(tri, std::max(x0, tri.minX), std::max(y0, tri.minY), std::min(x1, tri.maxX), std::min(y1, tri.maxY), pass);
+		}
+	}
+}
+
+void CSoft3D::RasterTriangle(const Triangle& tri, int x0, int y0, int x1, int y1, const Pass& pass)
+{
+	const DrawState& ds	= m_drawStates[tri.state];
+	const Mesh& mesh	= *ds.mesh;
+	float depthScale	= ds.vp->projectionMatrix[14];		// gl_FragDepth = projMat[3][2] * gl_FragCoord.w
+
+	float* depthBuffer		= pass.depth->depth.data();
+	UINT8* stencilBuffer	= pass.depth->stencil.data();
+	UINT32* layer			= m_layers[(int)pass.layer].data();
+
+#if defined(SUPERMODEL_SIMD_SSE2)
+	const __m128 laneX = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	__m128 edgeA[3], edgeX[3], inclusive[3];
+	for (int i = 0; i < 3; i++) {
+		edgeA[i]		= _mm_set1_ps(tri.edgeA[i]);
+		edgeX[i]		= _mm_set1_ps(tri.edgeX[i]);
+		inclusive[i]	= _mm_castsi128_ps(_mm_set1_epi32((tri.inclusive >> i) & 1 ? -1 : 0));
+	}
+#elif defined(SUPERMODEL_SIMD_NEON)
+	static const float laneOffsets[4] = { 0.5f, 1.5f, 2.5f, 3.5f };
+	static const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+	const float32x4_t laneX = vld1q_f32(laneOffsets);
+	const uint32x4_t bits = vld1q_u32(laneBits);
+	float32x4_t edgeA[3], edgeX[3];
+	uint32x4_t inclusive[3];
+	for (int i = 0; i < 3; i++) {
+		edgeA[i]		= vdupq_n_f32(tri.edgeA[i]);
+		edgeX[i]		= vdupq_n_f32(tri.edgeX[i]);
+		inclusive[i]	= vdupq_n_u32((tri.inclusive >> i) & 1 ? 0xFFFFFFFF : 0);
+	}
+#endif
+
+	for (int y = y0; y <= y1; y++) {
+
+		float py = y + 0.5f;
+		float rowTerm[3];
+
+		for (int i = 0; i < 3; i++) {
+			rowTerm[i] = tri.edgeB[i] * (py - tri.edgeY[i]);
+		}
+
+		for (int x = x0; x <= x1; x += 4) {
+
+			// edge functions for 4 pixels at once
+			float e[3][4];
+			unsigned mask;
+
+#if defined(SUPERMODEL_SIMD_SSE2)
+			__m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneX);
+			__m128 covered = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+			for (int i = 0; i < 3; i++) {
+				__m128 ev = _mm_add_ps(_mm_mul_ps(edgeA[i], _mm_sub_ps(px, edgeX[i])), _mm_set1_ps(rowTerm[i]));
+				__m128 zero = _mm_setzero_ps();
+				__m128 in = _mm_or_ps(_mm_and_ps(inclusive[i], _mm_cmpge_ps(ev, zero)), _mm_andnot_ps(inclusive[i], _mm_cmpgt_ps(ev, zero)));
+				covered = _mm_and_ps(covered, in);
+				_mm_storeu_ps(e[i], ev);
+			}
+
+			mask = (unsigned)_mm_movemask_ps(covered);
+#elif defined(SUPERMODEL_SIMD_NEON)
+			float32x4_t px = vaddq_f32(vdupq_n_f32((float)x), laneX);
+			uint32x4_t covered = vdupq_n_u32(0xFFFFFFFF);
+
+			for (int i = 0; i < 3; i++) {
+				float32x4_t ev = vaddq_f32(vmulq_f32(edgeA[i], vsubq_f32(px, edgeX[i])), vdupq_n_f32(rowTerm[i]));
+				float32x4_t zero = vdupq_n_f32(0.0f);
+				uint32x4_t in = vbslq_u32(inclusive[i], vcgeq_f32(ev, zero), vcgtq_f32(ev, zero));
+				covered = vandq_u32(covered, in);
+				vst1q_f32(e[i], ev);
+			}
+
+			uint32x4_t laneMask = vandq_u32(covered, bits);
+			uint32x2_t sum = vadd_u32(vget_low_u32(laneMask), vget_high_u32(laneMask));
+			mask = vget_lane_u32(vpadd_u32(sum, sum), 0);
+#else
+			mask = 0xF;
+
+			for (int i = 0; i < 3; i++) {
+				for (int k = 0; k < 4; k++) {
+					float ev = tri.edgeA[i] * ((x + k + 0.5f) - tri.edgeX[i]) + rowTerm[i];
+					bool in = ((tri.inclusive >> i) & 1) ? ev >= 0.0f : ev > 0.0f;
+					e[i][k] = ev;
+					if (!in) mask &= ~(1u << k);
+				}
+			}
+#endif
+
+			if (x1 - x < 3) {
+				mask &= (1u << (x1 - x + 1)) - 1;		// past the end of the span
+			}
+
+			while (mask) {
+
+				int k = 0;
+				while (!(mask & (1u << k))) k++;
+				mask &= ~(1u << k);
+
+				size_t index = (size_t)y * m_width + x + k;
+
+				float l0	= e[0][k] * tri.invArea;
+				float l1	= e[1][k] * tri.invArea;
+				float l2	= e[2][k] * tri.invArea;
+				float invW	= l0 * tri.invW[0] + l1 * tri.invW[1] + l2 * tri.invW[2];
+				float depth	= depthScale * invW;
+
+				UINT8 stencil = stencilBuffer[index];
+
+				if (mesh.layered && (stencil & 0x7F) != 0) {
+					continue;
+				}
+
+				if (pass.greater ? !(depth > depthBuffer[index]) : !(depth >= depthBuffer[index])) {
+					continue;
+				}
+
+				float w = 1.0f / invW;
+				float attr[NUM_ATTRIBS];
+
+				for (int a = 0; a < NUM_ATTRIBS; a++) {
+					attr[a] = (l0 * tri.attr[0][a] + l1 * tri.attr[1][a] + l2 * tri.attr[2][a]) * w;
+				}
+
+				float colour[4];
+
+				if (!ShadeFragment(tri, ds, pass, x + k + 0.5f, py, invW, attr, colour)) {
+					continue;
+				}
+
+				if (pass.layer == Layer::colour) {
+					colour[3] = 1.0f;		// always have alpha of 1, and the opaque pixel masks the transparent layers
+					m_layers[1][index] = 0;
+					m_layers[2][index] = 0;
+				}
+
+				layer[index]		= PackColour(colour);
+				depthBuffer[index]	= depth;
+
+				if (mesh.layered) {
+					stencilBuffer[index] = (stencil & 0x80) | ((stencil + 1) & 0x7F);
+				}
+				else {
+					stencilBuffer[index] = (stencil & 0x7F) | (mesh.noLosReturn ? 0x80 : 0);
+				}
+			}
+		}
+	}
+}
+
+} // Soft3D
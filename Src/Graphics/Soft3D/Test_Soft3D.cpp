@@ -0,0 +1,221 @@
+#include "Graphics/Soft3D/Soft3D.h"
+#include "Util/BitCast.h"
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Renders a small synthetic scene through the whole software pipeline: scene
+ * traversal, model conversion, clipping, rasterization, shading and
+ * compositing. The frame is compared against a known hash, so any change in
+ * the output shows up, intended or not.
+ *
+ * The hash must come out the same with the SIMD edge functions and with the
+ * scalar ones, so build and run it both ways:
+ *
+ *   g++ -O2 -std=c++17 -ffp-contract=off -I Src -I Src/OSD -I Src/OSD/libretro \
+ *       Src/Graphics/Soft3D/Test_Soft3D.cpp Src/Graphics/Soft3D/Soft3D.cpp \
+ *       Src/Graphics/Soft3D/Soft3DRaster.cpp Src/Graphics/Soft3D/WorkerPool.cpp \
+ *       Src/Graphics/New3D/New3DScene.cpp Src/Graphics/New3D/Model.cpp \
+ *       Src/Graphics/New3D/Mat4.cpp Src/Graphics/New3D/PolyHeader.cpp \
+ *       Src/Graphics/New3D/Vec.cpp Src/Graphics/New3D/R3DFloat.cpp \
+ *       Src/Util/NewConfig.cpp Src/Util/Format.cpp Src/OSD/Logger.cpp -lpthread
+ *
+ * and again with -DSUPERMODEL_NO_SIMD added.
+ */
+
+static void PrintTestResults(std::vector<std::pair<std::string, bool>> results)
+{
+  std::cout << "TEST RESULTS" << std::endl;
+  std::cout << "------------" << std::endl;
+  for (auto v: results)
+    std::cout << v.first << ": " << (v.second ? "passed" : "FAILED") << std::endl;
+}
+
+static const unsigned XRES = 496;
+static const unsigned YRES = 384;
+static const UINT64 EXPECTED_HASH = 0x3b2ddff4d8d7a21eULL;
+
+static UINT32 Float(float f)
+{
+  return (UINT32)Util::FloatAsInt32(f);
+}
+
+// Step 2.0 fixed point vertex: depth is added to the distance of the model, right and up are as seen on screen
+static void PutVertex(UINT32 *&p, float depth, float right, float up)
+{
+  const float real3D[3] = { depth, right, -up };   // the Real3D axes are Z, X, Y in OpenGL terms
+  for (int i = 0; i < 3; i++)
+    *p++ = (UINT32)((INT32)(real3D[i] * 2048.0f) * 256);
+  *p++ = 0;                                         // texture coordinates
+}
+
+static void PutPoly(UINT32 *&p, bool quad, bool last, UINT32 rgb, UINT32 word6)
+{
+  *p++ = quad ? 0x40 : 0;
+  *p++ = 0xC0000000 | (last ? 0x04 : 0) | 0x02;    // face normal X of -1 (towards the viewer), RGB colour
+  *p++ = 0;
+  *p++ = 0;
+  *p++ = rgb << 8;
+  *p++ = 0;
+  *p++ = word6;
+}
+
+struct Scene
+{
+  std::vector<UINT32> cullingRAMLo = std::vector<UINT32>(0x100000, 0);
+  std::vector<UINT32> cullingRAMHi = std::vector<UINT32>(0x40000, 0);
+  std::vector<UINT32> polyRAM = std::vector<UINT32>(0x100000, 0);
+  std::vector<UINT32> vrom = std::vector<UINT32>(16, 0);
+  std::vector<UINT16> textureRAM = std::vector<UINT16>(2048 * 2048, 0);
+
+  Scene()
+  {
+    const UINT32 opaque = 0x00800000;
+    const UINT32 unlit = 0x00010000;
+    const UINT32 halfTransparent = 16 << 18;
+
+    // Viewport 0x800000, full screen, 90 degrees wide, sun straight behind the viewer
+    UINT32 *vp = &cullingRAMHi[0];
+    vp[0x01] = 0x01000000;                        // no next viewport
+    vp[0x02] = 0x800100;                          // culling node
+    vp[0x03] = Float(1.0f);                       // cota
+    vp[0x04] = Float(-1.0f);                      // sun vector
+    vp[0x07] = Float(0.75f);                      // sun intensity
+    vp[0x08] = Float(0.5f);                       // frustum
+    vp[0x09] = Float(0.5f * XRES / YRES);
+    vp[0x0A] = Float(0.5f);
+    vp[0x0B] = Float(0.5f);
+    vp[0x14] = ((YRES * 4) << 16) | (XRES * 4);   // size
+    vp[0x16] = 0x800200;                          // matrix base
+    vp[0x17] = 0x800400;                          // LOD blend table
+    vp[0x24] = 0x40 << 8;                         // ambient intensity
+
+    // Culling node 0x800100, 20 units in front of the viewer, draws the model at 0x1000
+    UINT32 *node = &cullingRAMHi[0x100];
+    node[0x00] = 0x10 | 0x02;                     // translation, culling node
+    node[0x04] = Float(20.0f);
+    node[0x07] = 0x01000000 | 0x1000;
+    node[0x08] = 0x01000000;                      // no sibling
+    node[0x09] = 0x28002800;                      // blend and culling radius of 1024
+
+    // Identity coordinate system matrix
+    float *matrix = (float *)&cullingRAMHi[0x200];
+    matrix[3] = matrix[7] = matrix[11] = 1.0f;
+
+    // LOD table 0 never deletes or fades anything
+    LODBlendTable *lod = (LODBlendTable *)&cullingRAMHi[0x400];
+    lod->table[0].lod[3].deleteSize = 0.0f;
+    lod->table[0].lod[3].blendFactor = 1e6f;
+
+    UINT32 *p = &polyRAM[0x1000];
+
+    // Opaque red quad
+    PutPoly(p, true, false, 0xFF0000, opaque | unlit);
+    PutVertex(p, 0, -12, -8);
+    PutVertex(p, 0, 8, -8);
+    PutVertex(p, 0, 8, 10);
+    PutVertex(p, 0, -12, 10);
+
+    // Opaque green triangle in front of it
+    PutPoly(p, false, false, 0x00FF00, opaque | unlit);
+    PutVertex(p, -5, -4, -6);
+    PutVertex(p, -5, 10, 2);
+    PutVertex(p, -5, -2, 12);
+
+    // Lit blue triangle slanting through the red quad
+    PutPoly(p, false, false, 0x0000FF, opaque);
+    PutVertex(p, -3, -14, -10);
+    PutVertex(p, 3, 4, -12);
+    PutVertex(p, 0, -6, 6);
+
+    // Cyan triangle reaching behind the viewer, which has to be clipped
+    PutPoly(p, false, false, 0x00FFFF, opaque | unlit);
+    PutVertex(p, -25, 0, -14);
+    PutVertex(p, 0, 14, -13);
+    PutVertex(p, 0, 18, -4);
+
+    // Half transparent yellow quad in front of everything
+    PutPoly(p, true, true, 0xFFFF00, halfTransparent | unlit);
+    PutVertex(p, -8, -3, -9);
+    PutVertex(p, -8, 9, -9);
+    PutVertex(p, -8, 9, 3);
+    PutVertex(p, -8, -3, 3);
+  }
+};
+
+// Renders the scene for a number of frames and returns the last one, top row first
+static std::vector<UINT32> Render(const Scene &scene, unsigned threads, int frames)
+{
+  Util::Config::Node config("Global");
+  config.Set("QuadRendering", false);
+  config.Set("WideScreen", false);
+  config.Set("NoWhiteFlash", false);
+
+  std::unique_ptr<Soft3D::CSoft3D> render(new Soft3D::CSoft3D(config, "test", threads));
+  render->Init(0, 0, XRES, YRES, XRES, YRES, 0);
+  render->AttachMemory(scene.cullingRAMLo.data(), scene.cullingRAMHi.data(), scene.polyRAM.data(), scene.vrom.data(), scene.textureRAM.data());
+  render->SetStepping(0x20);
+
+  for (int i = 0; i < frames; i++)
+  {
+    render->BeginFrame();
+    render->RenderFrame();
+    render->EndFrame();
+  }
+
+  const UINT32 *fb = render->GetFrameBuffer();
+  return std::vector<UINT32>(fb, fb + XRES * YRES);
+}
+
+static UINT64 Hash(const std::vector<UINT32> &frame)
+{
+  UINT64 h = 0xcbf29ce484222325ULL;
+  for (UINT32 pixel : frame)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      h ^= (pixel >> (i * 8)) & 0xFF;
+      h *= 0x100000001b3ULL;
+    }
+  }
+  return h;
+}
+
+static UINT32 Pixel(const std::vector<UINT32> &frame, unsigned x, unsigned y)
+{
+  return frame[y * XRES + x];
+}
+
+int main()
+{
+  std::vector<std::pair<std::string, bool>> test_results;
+  std::unique_ptr<Scene> scene(new Scene());
+
+  std::vector<UINT32> frame = Render(*scene, 1, 1);
+
+  // A few pixels whose colour follows from the scene alone (RGBA8, red in the low byte)
+  {
+    bool ok = Pixel(frame, 2, 2) == 0;                          // background
+    ok &= Pixel(frame, 130, 90) == 0xFF0000FF;                  // red quad
+    ok &= Pixel(frame, 250, 60) == 0xFF00FF00;                  // green triangle
+    ok &= Pixel(frame, 100, 300) == 0xFFFF0000;                 // blue triangle, lit to full intensity
+    ok &= Pixel(frame, 470, 330) == 0xFFFFFF00;                 // what's left of the cyan triangle
+    test_results.push_back({ "Coverage", ok });
+  }
+
+  UINT64 hash = Hash(frame);
+  std::printf("Frame hash: 0x%016llx\n", (unsigned long long)hash);
+  test_results.push_back({ "Frame hash", hash == EXPECTED_HASH });
+
+  // Tiles are shared out between threads, that mustn't change a single pixel
+  test_results.push_back({ "Threads", Render(*scene, 4, 1) == frame });
+
+  // Polygon RAM models unchanged for two frames are drawn from the RAM model cache from then on
+  test_results.push_back({ "Cached model", Render(*scene, 1, 3) == frame });
+
+  PrintTestResults(test_results);
+  return 0;
+}
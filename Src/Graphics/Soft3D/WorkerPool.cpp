@@ -0,0 +1,104 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+namespace Soft3D {
+
+CWorkerPool::CWorkerPool(unsigned numThreads)
+{
+	if (numThreads == 0) {
+		numThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	for (unsigned i = 1; i < numThreads; i++) {
+		m_threads.emplace_back(&CWorkerPool::WorkerMain, this, i);
+	}
+}
+
+CWorkerPool::~CWorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+
+	m_startCond.notify_all();
+
+	for (auto& t : m_threads) {
+		t.join();
+	}
+}
+
+unsigned CWorkerPool::GetNumThreads() const
+{
+	return (unsigned)m_threads.size() + 1;
+}
+
+void CWorkerPool::ParallelFor(unsigned count, const Job& job)
+{
+	if (count == 0) {
+		return;
+	}
+
+	if (m_threads.empty() || count == 1) {
+		for (unsigned i = 0; i < count; i++) {
+			job(i, 0);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_job	= &job;
+		m_count	= count;
+		m_next	= 0;
+		m_busy	= (unsigned)m_threads.size();
+		m_generation++;
+	}
+
+	m_startCond.notify_all();
+
+	RunJob(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCond.wait(lock, [this] { return m_busy == 0; });
+	m_job = nullptr;
+}
+
+void CWorkerPool::RunJob(unsigned thread)
+{
+	unsigned i;
+
+	while ((i = m_next.fetch_add(1, std::memory_order_relaxed)) < m_count) {
+		(*m_job)(i, thread);
+	}
+}
+
+void CWorkerPool::WorkerMain(unsigned thread)
+{
+	unsigned generation = 0;
+
+	for (;;) {
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_startCond.wait(lock, [&] { return m_quit || m_generation != generation; });
+
+			if (m_quit) {
+				return;
+			}
+
+			generation = m_generation;
+		}
+
+		RunJob(thread);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_busy--;
+		}
+
+		m_doneCond.notify_one();
+	}
+}
+
+} // Soft3D
@@ -0,0 +1,51 @@
+#ifndef _WORKERPOOL_H_
+#define _WORKERPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Soft3D {
+
+/*
+* A fixed set of threads that run one parallel loop at a time. The thread that
+* calls ParallelFor() works through the loop as well, so a pool created with a
+* single thread never starts any.
+*/
+class CWorkerPool
+{
+public:
+	typedef std::function<void(unsigned index, unsigned thread)> Job;
+
+	explicit CWorkerPool(unsigned numThreads);		// 0 picks one per hardware thread
+	~CWorkerPool();
+
+	unsigned GetNumThreads() const;					// including the calling thread
+
+	// calls job(i, thread) for every i < count and returns when they have all finished
+	void ParallelFor(unsigned count, const Job& job);
+
+private:
+
+	void WorkerMain(unsigned thread);
+	void RunJob(unsigned thread);
+
+	std::vector<std::thread>	m_threads;
+	std::mutex					m_mutex;
+	std::condition_variable		m_startCond;
+	std::condition_variable		m_doneCond;
+
+	const Job*					m_job		= nullptr;
+	unsigned					m_count		= 0;
+	std::atomic<unsigned>		m_next		{ 0 };
+	unsigned					m_busy		= 0;		// workers still inside the current job
+	unsigned					m_generation= 0;		// bumped for every job so workers don't run one twice
+	bool						m_quit		= false;
+};
+
+} // Soft3D
+
+#endif
@@ -41,54 +41,38 @@
 
 #include "Supermodel.h"
 #include "Sound/MPEG/MpegAudio.h"
+#include "Util/SIMD.h"
 #include <algorithm>
+#include <cmath>
 
 /******************************************************************************
  Resampler
 
- MPEG Layer 2 audio can be 32, 44.1, or 48 KHz. Here, an up-sampling algorithm
- is provided, which should work for any frequency less than 44.1 KHz and an
- output frequency of 44.1 KHz. Down-sampling is not yet implemented, but would
- work in a similar fashion. The chief difference is that the input index would
- sometimes advance by more than one for a single output sample and the
- fractions, nFrac and pFrac, would sometimes exceed 1.0.
+ MPEG Layer 2 audio can be 32, 44.1, or 48 KHz. The resampler converts between
+ any two fixed rates with a polyphase filter, although the DSB only ever uses
+ it to go from 32 KHz to 44.1 KHz.
 
- Up-Sampling Description
- -----------------------
+ 1. Polyphase Filtering
 
- Linear interpolation is used to up-sample. Not as accurate as the Shannon
- reconstruction equation but it seems to work quite well.
+ With the rate ratio reduced to lowest terms, fout/fin = L/M (441/320 for 32
+ to 44.1 KHz), every output sample lies at one of only L distinct positions
+ between two input samples. Output positions are tracked exactly as a whole
+ input sample index plus a phase in units of 1/L, and each output advances the
+ phase by M. The filter that produces an output sample depends only on its
+ phase, so the coefficients of all L filters are computed once, and every
+ output sample is a single dot product of a row of coefficients with the
+ input samples around it.
 
- 1. Linear Interpolation
+ Two filters are available, selected with MusicResampler:
 
- Input samples for a given frame (here, this means 1/60Hz, not to be confused
- with an MPEG frame, which is shorter) are numbered 0 ... L-1 (L samples in
- total). Output samples are 0 ... M-1.
+ 	linear	Linear interpolation between the two nearest input samples. Cheap
+ 			but lets images of the input spectrum alias into the output.
+ 	sinc	Kaiser-windowed sinc with 32 taps, a low-pass filter that removes
+ 			the images above the input Nyquist frequency. This is the default.
 
- For two adjacent input samples at times p ("previous") and n ("next"), in[p]
- and in[n], and output out[t] at time t, linear interpolation yields:
-
- 		out[t] = (n-t)/(n-p) * in[p] + (t-p)/(n-p) * in[n]
-
- Note that (n-p) = 1/fin (fin being the input sampling frequency).
-
- Let pFrac = (n-t)/(n-p) and nFrac = (t-p)/(n-p). As t moves from p to n, pFrac
- moves from 1 to 0 and nFrac from 0 to 1, as we expect.
-
- If we proceed one output sample at a time, we must add the time difference
- between output samples, 1/fout, to t. Call this delta_t. If we divide delta_t
- by (n-p), we can add it directly to nFrac and subtract from pFrac. Therefore:
-
- 	delta = (1/fout)/(n-p) = fin/fout
-
- What happens when nFrac exceeds 1.0 or pFrac goes below 0.0? That can't
- be allowed to happen -- it means that we've actually moved along the line into
- the region between the next set of samples. We use pFrac < 0 as the condition
- to update the input samples.
-
- It so happens that when fin < fout, pFrac and nFrac will never exceed 1.0. So
- there is no need to check or mask the fixed point values when using them to
- interpolate samples.
+ Sinc rows are padded with zeros to a multiple of 4 taps so that they can be
+ processed with SIMD instructions, and each row is normalized to unity DC
+ gain.
 
  2. Input Buffer Overflows
 
@@ -100,85 +84,202 @@
 
  3. Continuity Between Frames
 
- The very last output sample will typically sit somewhere between two input
- samples. It is wrong to start the next frame by assuming everything is lined
- up again. The first sample of the next frame will often have to be interpol-
- ated with the last sample of the previous frame. To facilitate this, we check
- to see how many input samples remain unprocessed when up-sampling is finished,
- and then copy those to the beginning of the buffer. We then return the number
- of samples so that the buffer update function will know to skip them.
+ The input of a frame is appended to the last taps-1 samples of the previous
+ frame (the history), converted to float with the volume applied. A filter
+ reads its taps from the window starting at the current input index, so the
+ output lags the input by half the filter length (0.5 ms for the sinc filter).
+ Input samples that the window has not yet moved past are copied back to the
+ start of the caller's buffer and their number is returned, so that the buffer
+ update function will know to skip them. The phase persists across frames.
+******************************************************************************/
 
- We also must maintain the state of pFrac and nFrac to resume interpolation
- correctly. Therefore, these variables are persistent.
+static int GCD(int a, int b)
+{
+	while (b != 0)
+	{
+		int t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
 
- 4. Fixed Point Arithmetic
+// Modified Bessel function of the first kind, order 0, used by the Kaiser window
+static double BesselI0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	for (int k = 1; k < 32; k++)
+	{
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+	}
+	return sum;
+}
 
- Fixed point arithmetic is used to track fractions. For such numbers, the low
- 8 bits represent a fraction (0x100 would be 1.0, 0x080 would be 0.5, etc.)
- and the upper bits are the integral portion.
-******************************************************************************/
+void CDSBResampler::BuildFilter(int outRate, int inRate, bool sinc)
+{
+	const double pi = 3.14159265358979323846;
+	int g = GCD(outRate, inRate);
+	L = outRate / g;
+	M = inRate / g;
+	numTaps = sinc ? 32 : 2;
+	rowLength = sinc ? (numTaps + 3) & ~3 : numTaps;	// linear rows are too short to be worth vectorizing
+	coeffs.assign((size_t)L * rowLength, 0.0f);
+
+	// Cut off a little below the lower of the two Nyquist frequencies
+	double cutoff = 0.89 * std::min(1.0, (double)outRate / (double)inRate);
+	const double beta = 6.0;
+
+	for (int p = 0; p < L; p++)
+	{
+		float *row = &coeffs[(size_t)p * rowLength];
+		double frac = (double)p / (double)L;
+		double sum = 0.0;
+		for (int k = 0; k < numTaps; k++)
+		{
+			// Distance of tap k from the output position, in input samples
+			double x = (double)(k - (numTaps / 2 - 1)) - frac;
+			double h;
+			if (sinc)
+			{
+				double t = x / (numTaps / 2);
+				double window = std::fabs(t) < 1.0 ? BesselI0(beta * std::sqrt(1.0 - t * t)) / BesselI0(beta) : 0.0;
+				double y = pi * cutoff * x;
+				h = (std::fabs(y) < 1e-9 ? 1.0 : std::sin(y) / y) * window;
+			}
+			else
+				h = std::max(0.0, 1.0 - std::fabs(x));
+			row[k] = (float)h;
+			sum += h;
+		}
+		for (int k = 0; k < numTaps; k++)
+			row[k] = (float)(row[k] / sum);
+	}
+
+	filterOutRate = outRate;
+	filterInRate = inRate;
+	filterSinc = sinc;
+}
 
 void CDSBResampler::Reset(void)
 {
-	// Initial state of fractions (24.8 fixed point)
-	nFrac = 0<<8;	// fraction of next sample to use (0->1.0 as x moves p->n)
-	pFrac = 1<<8;	// previous sample (1.0->0 as x moves p->n)
+	phase = 0;
+	std::fill(bufL.begin(), bufL.end(), 0.0f);
+	std::fill(bufR.begin(), bufR.end(), 0.0f);
 }
 
-// Mixes audio and returns number of samples copied back to start of buffer (ie. offset at which new samples should be written)
-int CDSBResampler::UpSampleAndMix(float *outL, float *outR, INT16 *inL, INT16 *inR, UINT8 volumeL, UINT8 volumeR, int sizeOut, int sizeIn, int outRate, int inRate)
+// Filters one output sample of both channels from the windows starting at inL and inR
+static inline void FilterSample(float *outL, float *outR, const float *inL, const float *inR, const float *row, int rowLength)
+{
+#if defined(SUPERMODEL_SIMD_SSE2)
+	__m128 l = _mm_setzero_ps();
+	__m128 r = _mm_setzero_ps();
+	for (int k = 0; k < rowLength; k += 4)
+	{
+		__m128 c = _mm_loadu_ps(row + k);
+		l = _mm_add_ps(l, _mm_mul_ps(c, _mm_loadu_ps(inL + k)));
+		r = _mm_add_ps(r, _mm_mul_ps(c, _mm_loadu_ps(inR + k)));
+	}
+	__m128 lr = _mm_add_ps(_mm_unpacklo_ps(l, r), _mm_unpackhi_ps(l, r));	// l0+l2, r0+r2, l1+l3, r1+r3
+	lr = _mm_add_ps(lr, _mm_movehl_ps(lr, lr));
+	*outL = _mm_cvtss_f32(lr);
+	*outR = _mm_cvtss_f32(_mm_shuffle_ps(lr, lr, _MM_SHUFFLE(1, 1, 1, 1)));
+#elif defined(SUPERMODEL_SIMD_NEON)
+	float32x4_t l = vdupq_n_f32(0.0f);
+	float32x4_t r = vdupq_n_f32(0.0f);
+	for (int k = 0; k < rowLength; k += 4)
+	{
+		float32x4_t c = vld1q_f32(row + k);
+		l = vmlaq_f32(l, c, vld1q_f32(inL + k));
+		r = vmlaq_f32(r, c, vld1q_f32(inR + k));
+	}
+	float32x2_t lr = vpadd_f32(vadd_f32(vget_low_f32(l), vget_high_f32(l)), vadd_f32(vget_low_f32(r), vget_high_f32(r)));
+	*outL = vget_lane_f32(lr, 0);
+	*outR = vget_lane_f32(lr, 1);
+#else
+	float l = 0.0f, r = 0.0f;
+	for (int k = 0; k < rowLength; k++)
+	{
+		l += row[k] * inL[k];
+		r += row[k] * inR[k];
+	}
+	*outL = l;
+	*outR = r;
+#endif
+}
+
+// Resamples audio into the output buffers and returns number of samples copied back to start of buffer (ie. offset at which new samples should be written)
+int CDSBResampler::UpSample(float *outL, float *outR, INT16 *inL, INT16 *inR, UINT8 volumeL, UINT8 volumeR, int sizeOut, int sizeIn, int outRate, int inRate)
 {
-	int 	delta = (inRate<<8)/outRate;	// (1/fout)/(1/fin)=fin/fout, 24.8 fixed point
-	int		outIdx = 0;
-	int		inIdx = 0;
 	float	v[2], musicVol;
 
 	// Obtain program volume settings
-	musicVol = (float)std::max(0,std::min(200,m_config["MusicVolume"].ValueAs<int>()));
+	musicVol = (float)std::max(0,std::min(200,m_musicVolume.Get()));
 	musicVol = musicVol * (float) (1.0 / 100.0);
 
-	v[0] = musicVol * (float) volumeL * (float) (1.0 / (255.0*256.0)); // 256 is there to correct for fixed point interpolation below
-	v[1] = musicVol * (float) volumeR * (float) (1.0 / (255.0*256.0));
+	v[0] = musicVol * (float) volumeL * (float) (1.0 / 255.0);
+	v[1] = musicVol * (float) volumeR * (float) (1.0 / 255.0);
 
-	// Up-sample and mix!
-	while (outIdx < sizeOut)
+	// Coefficients are rebuilt only when the rates or the filter change
+	bool sinc = m_musicResampler.Get() != "linear";
+	if (coeffs.empty() || outRate != filterOutRate || inRate != filterInRate || sinc != filterSinc)
 	{
-		// nFrac, pFrac will never exceed 1.0 (0x100) (only true if delta does not exceed 1)
-		INT32 leftSample  = (int)inL[inIdx]*pFrac+(int)inL[inIdx+1]*nFrac;	// left channel
-		INT32 rightSample = (int)inR[inIdx]*pFrac+(int)inR[inIdx+1]*nFrac;	// right channel
+		BuildFilter(outRate, inRate, sinc);
+		phase = 0;
+		bufL.clear();
+		bufR.clear();
+	}
 
-		// Apply DSB volume+overall music volume setting, and mix into output
-		outL[outIdx] += (float)leftSample  * v[0];
-		outR[outIdx] += (float)rightSample * v[1];
-		outIdx++;
+	// History followed by this frame's input, padded so that full rows can be read at the end
+	int history = numTaps - 1;
+	size_t bufSize = (size_t)(history + sizeIn + rowLength);
+	if (bufL.size() < bufSize)
+	{
+		bufL.resize(bufSize, 0.0f);
+		bufR.resize(bufSize, 0.0f);
+	}
+	for (int i = 0; i < sizeIn; i++)
+	{
+		bufL[history + i] = (float)inL[i] * v[0];
+		bufR[history + i] = (float)inR[i] * v[1];
+	}
 
-		// Time step
-		pFrac -= delta;
-		nFrac += delta;
+	// Up-sample!
+	int inIdx = 0;
+	for (int outIdx = 0; outIdx < sizeOut; outIdx++)
+	{
+		const float *row = &coeffs[(size_t)phase * rowLength];
+		if (numTaps == 2)
+		{
+			outL[outIdx] = row[0] * bufL[inIdx] + row[1] * bufL[inIdx + 1];
+			outR[outIdx] = row[0] * bufR[inIdx] + row[1] * bufR[inIdx + 1];
+		}
+		else
+			FilterSample(&outL[outIdx], &outR[outIdx], &bufL[inIdx], &bufR[inIdx], row, rowLength);
 
-		// Time to move to next samples?
-		if (pFrac <= 0)	// when pFrac becomes 0, advance samples, reset pFrac to 1
+		// Time step
+		phase += M;
+		while (phase >= L)
 		{
-			pFrac += (1<<8);
-			nFrac -= (1<<8);
-			inIdx++;	// advance samples (for upsampling only; downsampling may advance by more than one -- add delta every loop iteration)
+			phase -= L;
+			inIdx++;
 		}
 	}
 
+	// Keep the history for the next frame
+	std::copy(bufL.begin() + inIdx, bufL.begin() + inIdx + history, bufL.begin());
+	std::copy(bufR.begin() + inIdx, bufR.begin() + inIdx + history, bufR.begin());
+
 	// Copy remaining "active" input samples to start of buffer
 	int i = 0;
-	int j = inIdx;
-	while (j < sizeIn)
+	for (int j = inIdx; j < sizeIn; i++, j++)
 	{
 		inL[i] = inL[j];
 		inR[i] = inR[j];
-		i++;
-		j++;
 	}
 	return i;	// first free position in input buffer to copy next MPEG update to
 }
 
-
 /******************************************************************************
  Digital Sound Board Type 1: Z80 CPU
 ******************************************************************************/
@@ -403,12 +504,12 @@ void CDSB1::SendCommand(UINT8 data)
 
 void CDSB1::RunFrame(float *audioL, float *audioR)
 {
-	if (!m_config["EmulateDSB"].ValueAs<bool>())
+	if (!m_emulateDSB.Get())
 	{
-		// DSB code applies SCSP volume, too, so we must still mix
+		// Output silence, keeping the resampler in step
 		memset(mpegL, 0, (32000/60+2)*sizeof(INT16));
 		memset(mpegR, 0, (32000/60+2)*sizeof(INT16));
-		retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, 0, 0, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
+		retainedSamples = Resampler.UpSample(audioL, audioR, mpegL, mpegR, 0, 0, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
 		return;
 	}
 
@@ -431,7 +532,7 @@ void CDSB1::RunFrame(float *audioL, float *audioR)
 
 	// Decode MPEG for this frame
 	MpegDec::DecodeAudio(&mpegL[retainedSamples], &mpegR[retainedSamples], 32000 / 60 - retainedSamples + 2);
-	retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, v, v, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
+	retainedSamples = Resampler.UpSample(audioL, audioR, mpegL, mpegR, v, v, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
 }
 
 void CDSB1::Reset(void)
@@ -572,6 +673,9 @@ Result CDSB1::Init(const UINT8 *progROMPtr, const UINT8 *mpegROMPtr)
 
 	retainedSamples = 0;
 
+	// Decoded loops are cached in MB
+	MpegDec::SetCacheSize((size_t)m_config["MusicCacheSize"].ValueAsDefault<unsigned>(64) * 0x100000);
+
 	return Result::OKAY;
 }
 
@@ -582,6 +686,7 @@ CZ80 *CDSB1::GetZ80(void)
 
 CDSB1::CDSB1(const Util::Config::Node &config)
   : m_config(config),
+    m_emulateDSB(config, "EmulateDSB"),
     Resampler(config)
 {
 	progROM		= NULL;
@@ -603,6 +708,8 @@ CDSB1::CDSB1(const Util::Config::Node &config)
 
 CDSB1::~CDSB1(void)
 {
+	MpegDec::Stop();	// the decoder mustn't read ahead from freed MPEG ROM
+
 	delete [] memoryPool;
 	memoryPool = NULL;
 
@@ -967,12 +1074,12 @@ void CDSB2::SendCommand(UINT8 data)
 
 void CDSB2::RunFrame(float *audioL, float *audioR)
 {
-  if (!m_config["EmulateDSB"].ValueAs<bool>())
+  if (!m_emulateDSB.Get())
   {
-    // DSB code applies SCSP volume, too, so we must still mix
+    // Output silence, keeping the resampler in step
     memset(mpegL, 0, (32000/60+2) * sizeof(INT16));
     memset(mpegR, 0, (32000/60+2) * sizeof(INT16));
-    retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, 0, 0, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
+    retainedSamples = Resampler.UpSample(audioL, audioR, mpegL, mpegR, 0, 0, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
     return;
   }
 
@@ -1043,7 +1150,7 @@ void CDSB2::RunFrame(float *audioL, float *audioR)
       break;
   }
 
-  retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, leftChannelSource, rightChannelSource, volL, volR, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
+  retainedSamples = Resampler.UpSample(audioL, audioR, leftChannelSource, rightChannelSource, volL, volR, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
 }
 
 void CDSB2::Reset(void)
@@ -1216,6 +1323,9 @@ Result CDSB2::Init(const UINT8 *progROMPtr, const UINT8 *mpegROMPtr)
 
 	retainedSamples = 0;
 
+	// Decoded loops are cached in MB
+	MpegDec::SetCacheSize((size_t)m_config["MusicCacheSize"].ValueAsDefault<unsigned>(64) * 0x100000);
+
 	return Result::OKAY;
 }
 
@@ -1226,6 +1336,7 @@ M68KCtx *CDSB2::GetM68K(void)
 
 CDSB2::CDSB2(const Util::Config::Node &config)
   : m_config(config),
+    m_emulateDSB(config, "EmulateDSB"),
     Resampler(config)
 {
 	progROM		= NULL;
@@ -1262,6 +1373,8 @@ CDSB2::CDSB2(const Util::Config::Node &config)
 
 CDSB2::~CDSB2(void)
 {
+	MpegDec::Stop();	// the decoder mustn't read ahead from freed MPEG ROM
+
 	if (memoryPool != NULL)
 	{
 		delete [] memoryPool;
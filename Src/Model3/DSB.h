@@ -37,6 +37,7 @@
 #include "CPU/68K/68K.h"
 #include "CPU/Z80/Z80.h"
 #include "Util/NewConfig.h"
+#include <vector>
 
 #define FIFO_STACK_SIZE			0x100
 #define FIFO_STACK_SIZE_MASK	(FIFO_STACK_SIZE - 1)
@@ -53,35 +54,45 @@
 /*
  * CDSBResampler:
  *
- * Frame-by-frame resampler. Resamples one single frame of audio and maintains
- * continuity between frames by copying unprocessed input samples to the
- * beginning of the buffer and retaining the internal interpolation state.
+ * Frame-by-frame polyphase resampler. Resamples one single frame of audio and
+ * maintains continuity between frames by copying unprocessed input samples to
+ * the beginning of the buffer and retaining the filter history and phase.
  *
  * See DSB.cpp for a detailed description of how this works.
  *
- * NOTE: If the sampling frequencies change, it is probably best to call
- * Reset(). Whether the resampler will otherwise behave correctly and stay
- * within array bounds has not been verified.
- *
  * Designed for use at 60 Hz, for input frequencies of 11.025, 22.05, 16, and
- * 32 KHz and 44.1 KHz output frequencies. Theoretically, it should be able to
- * operate on most output frequencies and input frequencies that are simply
- * lower, but it has not been extensively verified.
+ * 32 KHz and 44.1 KHz output frequencies. The filter coefficients are rebuilt
+ * whenever the rates or the MusicResampler setting change, but the rate ratio
+ * must reduce to a reasonably small number of phases (441 for 32 KHz).
  */
 class CDSBResampler
 {
 public:
-	int		UpSampleAndMix(float *outL, float *outR, INT16 *inL, INT16 *inR, UINT8 volumeL, UINT8 volumeR, int sizeOut, int sizeIn, int outRate, int inRate);
+	int		UpSample(float *outL, float *outR, INT16 *inL, INT16 *inR, UINT8 volumeL, UINT8 volumeR, int sizeOut, int sizeIn, int outRate, int inRate);
 	void	Reset(void);
 	CDSBResampler(const Util::Config::Node &config)
-	  : m_config(config)
+	  : m_musicVolume(config, "MusicVolume"),
+	    m_musicResampler(config, "MusicResampler", "sinc")
 	{
 		Reset();
 	}
 private:
-	const Util::Config::Node &m_config;
-	int	nFrac;
-	int	pFrac;
+	void	BuildFilter(int outRate, int inRate, bool sinc);
+
+	Util::Config::Setting<int>			m_musicVolume;
+	Util::Config::Setting<std::string>	m_musicResampler;
+
+	// Polyphase filter
+	std::vector<float>	coeffs;			// L rows of rowLength coefficients, one per output phase
+	int		L = 1, M = 1;				// output/input rate ratio in lowest terms
+	int		numTaps = 0;				// taps per row, rowLength is padded to a multiple of 4
+	int		rowLength = 0;
+	int		filterOutRate = 0, filterInRate = 0;
+	bool	filterSinc = false;
+
+	// Interpolation state
+	int		phase = 0;					// output position between input samples, in units of 1/L
+	std::vector<float>	bufL, bufR;		// history followed by the current frame's input, volume applied
 };
 
 
@@ -108,8 +119,9 @@ public:
 	/*
 	 * RunFrame(audioL, audioR):
 	 *
-	 * Runs one frame and updates the MPEG audio. Audio is mixed into the
-	 * supplied buffers (they are assumed to already contain audio data).
+	 * Runs one frame and updates the MPEG audio. Audio is written to the
+	 * supplied buffers, replacing their contents. It is mixed with the SCSP
+	 * output when the sound board sends it to the audio system.
 	 *
 	 * Parameters:
 	 *		audioL	Left audio channel, one frame (44 KHz, 1/60th second).
@@ -203,6 +215,7 @@ public:
 
 private:
   const Util::Config::Node &m_config;
+  Util::Config::Setting<bool> m_emulateDSB;
 
 	// Resampler
 	CDSBResampler	Resampler;
@@ -280,6 +293,7 @@ public:
 
 private:
 	const Util::Config::Node &m_config;
+	Util::Config::Setting<bool> m_emulateDSB;
 
 	// Private helper functions
 	void	WriteMPEGFIFO(UINT8 byte);
@@ -0,0 +1,127 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2016 Bart Trzynadlowski, Nik Henson
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * GraphicsCapture.cpp
+ *
+ * Writes and identifies frame captures. See GraphicsCapture.h for the format.
+ */
+
+#include "GraphicsCapture.h"
+
+#include <cstdio>
+#include "Supermodel.h"
+#include "Game.h"
+#include "Util/Format.h"
+
+static const int32_t GRAPHICS_CAPTURE_VERSION = 1;
+static const uint32_t VROM_SIZE = 64*0x100000;
+
+static Result SaveVROM(IEmulator *Model3, const std::string &file_path)
+{
+  // Video ROM doesn't change, one dump serves every capture of the game
+  FILE *fp = fopen(file_path.c_str(), "rb");
+  if (fp != NULL)
+  {
+    fclose(fp);
+    return Result::OKAY;
+  }
+
+  fp = fopen(file_path.c_str(), "wb");
+  if (NULL == fp)
+    return ErrorLog("Unable to write video ROM to '%s'.", file_path.c_str());
+  size_t written = fwrite(Model3->GetVROM(), 1, VROM_SIZE, fp);
+  fclose(fp);
+  if (written != VROM_SIZE)
+  {
+    remove(file_path.c_str());
+    return ErrorLog("Unable to write video ROM to '%s'.", file_path.c_str());
+  }
+  return Result::OKAY;
+}
+
+Result SaveGraphicsCapture(IEmulator *Model3, const std::string &dir, uint32_t frame)
+{
+  const Game &game = Model3->GetGame();
+  std::string vrom_file = game.name + ".vrom";
+  if (Result::OKAY != SaveVROM(Model3, dir + vrom_file))
+    return Result::FAIL;
+
+  CBlockFile Capture;
+  std::string file_path = Util::Format() << dir << game.name << "." << frame << ".gfx";
+  if (Result::OKAY != Capture.Create(file_path, "Supermodel Graphics Capture", "Supermodel Version " SUPERMODEL_VERSION))
+    return ErrorLog("Unable to save graphics capture to '%s'.", file_path.c_str());
+
+  int32_t fileVersion = GRAPHICS_CAPTURE_VERSION;
+  Capture.Write(&fileVersion, sizeof(fileVersion));
+  Capture.Write(game.name);
+  Capture.Write(game.stepping);
+  Capture.Write(vrom_file);
+  Capture.Write(&frame, sizeof(frame));
+
+  Model3->SaveGraphicsState(&Capture);
+  Capture.Close();
+  InfoLog("Saved graphics capture to '%s'.", file_path.c_str());
+  return Result::OKAY;
+}
+
+static void ReadString(CBlockFile *file, std::string *str)
+{
+  str->clear();
+  char c;
+  while (file->Read(&c, sizeof(c)) == sizeof(c) && c != '\0')
+    *str += c;
+}
+
+Result LoadGraphicsCaptureInfo(CBlockFile *Capture, GraphicsCaptureInfo *info)
+{
+  if (Result::OKAY != Capture->FindBlock("Supermodel Graphics Capture"))
+    return Result::FAIL;
+
+  int32_t fileVersion = 0;
+  Capture->Read(&fileVersion, sizeof(fileVersion));
+  if (fileVersion != GRAPHICS_CAPTURE_VERSION)
+    return Result::FAIL;
+
+  ReadString(Capture, &info->game);
+  ReadString(Capture, &info->stepping);
+  ReadString(Capture, &info->vromFile);
+  Capture->Read(&info->frame, sizeof(info->frame));
+  return Result::OKAY;
+}
+
+void CGraphicsCapture::EndFrame(IEmulator *Model3)
+{
+  uint32_t frame = m_frame++;
+  if (frame < m_firstFrame || frame - m_firstFrame >= m_numFrames)
+    return;
+
+  Model3->PauseThreads();
+  SaveGraphicsCapture(Model3, m_dir, frame);
+  Model3->ResumeThreads();
+}
+
+CGraphicsCapture::CGraphicsCapture(const Util::Config::Node &config, const std::string &dir)
+  : m_dir(dir),
+    m_firstFrame(config["GfxCaptureFrame"].ValueAsDefault<unsigned>(0)),
+    m_numFrames(config["GfxCaptureCount"].ValueAsDefault<unsigned>(0))
+{
+}
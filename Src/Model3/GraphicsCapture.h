@@ -0,0 +1,125 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2016 Bart Trzynadlowski, Nik Henson
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * GraphicsCapture.h
+ *
+ * Frame captures: the renderer input of single frames written to disk, so
+ * that rendering can be replayed and timed without emulating any CPUs (see
+ * Src/Tools/Real3DReplay.cpp).
+ *
+ * A capture is a block file holding a "Supermodel Graphics Capture" header
+ * block followed by the "Tile Generator" and "Real3D" blocks of a save state,
+ * which makes it loadable by CModel3GraphicsState as well. Video ROM is too
+ * large to store with every frame, so it is dumped once per game next to the
+ * captures and the header refers to it by file name.
+ *
+ * Header block data: capture file version (4-byte integer), ROM set ID,
+ * stepping and VROM file name (strings including terminating \0), frame
+ * number (4-byte integer).
+ */
+
+#ifndef INCLUDED_GRAPHICSCAPTURE_H
+#define INCLUDED_GRAPHICSCAPTURE_H
+
+#include <cstdint>
+#include <string>
+#include "BlockFile.h"
+#include "Model3/IEmulator.h"
+#include "Util/NewConfig.h"
+
+struct GraphicsCaptureInfo
+{
+  std::string game;       // ROM set ID
+  std::string stepping;   // hardware stepping, as in Game
+  std::string vromFile;   // VROM dump, relative to the directory of the capture
+  uint32_t    frame = 0;  // frames run since the game was loaded
+};
+
+/*
+ * SaveGraphicsCapture(Model3, dir, frame):
+ *
+ * Writes <dir><game>.<frame>.gfx and, unless it already exists, the VROM dump
+ * <dir><game>.vrom. Emulator threads must be paused.
+ *
+ * Parameters:
+ *    Model3  Emulator to capture.
+ *    dir     Directory to write to, including the trailing separator.
+ *    frame   Frame number, stored in the header and used in the file name.
+ *
+ * Returns:
+ *    OKAY if successful, FAIL if a file could not be written.
+ */
+Result SaveGraphicsCapture(IEmulator *Model3, const std::string &dir, uint32_t frame);
+
+/*
+ * LoadGraphicsCaptureInfo(Capture, info):
+ *
+ * Reads the header block of a capture.
+ *
+ * Parameters:
+ *    Capture   Block file the capture was loaded into.
+ *    info      Filled in with the header contents.
+ *
+ * Returns:
+ *    OKAY if successful, FAIL if this is not a capture or it is from an
+ *    incompatible version.
+ */
+Result LoadGraphicsCaptureInfo(CBlockFile *Capture, GraphicsCaptureInfo *info);
+
+/*
+ * CGraphicsCapture:
+ *
+ * Captures a range of frames, configured with GfxCaptureFrame (first frame,
+ * counted from game load) and GfxCaptureCount (number of frames, 0 disables
+ * capturing).
+ */
+class CGraphicsCapture
+{
+public:
+  /*
+   * EndFrame(Model3):
+   *
+   * Must be called after every RunFrame(). Pauses the emulator threads and
+   * writes a capture if this frame is one of those requested.
+   *
+   * Parameters:
+   *    Model3  Emulator that has just run the frame.
+   */
+  void EndFrame(IEmulator *Model3);
+
+  /*
+   * CGraphicsCapture(config, dir):
+   *
+   * Parameters:
+   *    config  Run-time configuration.
+   *    dir     Directory captures are written to.
+   */
+  CGraphicsCapture(const Util::Config::Node &config, const std::string &dir);
+
+private:
+  const std::string m_dir;
+  uint32_t          m_firstFrame;
+  uint32_t          m_numFrames;
+  uint32_t          m_frame = 0;
+};
+
+#endif  // INCLUDED_GRAPHICSCAPTURE_H
@@ -31,7 +31,7 @@
 class CBlockFile;
 struct Game;
 struct ROMSet;
-class CRender2D;
+class IRender2D;
 class IRender3D;
 class CInputs;
 class COutputs;
@@ -69,6 +69,27 @@ public:
    *    SaveState   Block file to load state information from.
    */
   virtual void LoadState(CBlockFile *SaveState) = 0;
+
+  /*
+   * SaveGraphicsState(SaveState):
+   *
+   * Saves only what the renderers read: the tile generator and Real3D
+   * state. The result can be loaded by CModel3GraphicsState. Video ROM is
+   * not included, see GetVROM(). Must never be called while emulator is
+   * running (inside RunFrame()).
+   *
+   * Parameters:
+   *    SaveState   Block file to save graphics state information to.
+   */
+  virtual void SaveGraphicsState(CBlockFile *SaveState) = 0;
+
+  /*
+   * GetVROM(void):
+   *
+   * Returns:
+   *    Pointer to the 64 MB of video ROM. Only valid after LoadGame().
+   */
+  virtual const uint8_t *GetVROM(void) const = 0;
   
   /*
    * SaveNVRAM(NVRAM):
@@ -143,15 +164,17 @@ public:
   virtual Result LoadGame(const Game &game, const ROMSet &rom_set) = 0;
   
   /*
-   * AttachRenderers(Render2DPtr, Render3DPtr):
+   * AttachRenderers(Render2DPtr, Render3DPtr, superAA):
    *
    * Attaches the renderers to the appropriate device objects.
    *
    * Parameters:
    *    Render2DPtr   Pointer to a tile renderer object.
    *    Render3DPtr   Same as above but for a 3D renderer.
+   *    superAA       Resolves the rendered frame for display. May be NULL
+   *                  when the renderers don't draw to a GL target.
    */
-  virtual void AttachRenderers(CRender2D *Render2DPtr, IRender3D *Render3DPtr, SuperAA *superAA) = 0;
+  virtual void AttachRenderers(IRender2D *Render2DPtr, IRender3D *Render3DPtr, SuperAA *superAA) = 0;
   
   /*
    * AttachInputs(InputsPtr):
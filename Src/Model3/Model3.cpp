@@ -1928,6 +1928,12 @@ void CModel3::SaveState(CBlockFile *SaveState)
   m_jtag.SaveState(SaveState);
 }
 
+void CModel3::SaveGraphicsState(CBlockFile *SaveState)
+{
+  TileGen.SaveState(SaveState);
+  GPU.SaveState(SaveState);
+}
+
 void CModel3::LoadState(CBlockFile *SaveState)
 {
   // Load Model 3 state
@@ -2054,7 +2060,7 @@ void CModel3::RunFrame(bool skipRender)
       SyncGPUs();
 
 #ifdef NET_BOARD
-    if (NetBoard->IsRunning() && m_config["SimulateNet"].ValueAs<bool>())
+    if (NetBoard->IsRunning() && m_simulateNet.Get())
         RunNetBoardFrame();
 #endif
   }
@@ -2237,7 +2243,8 @@ void CModel3::RenderFrame(void)
     TileGen.RenderFrameTop();
     GPU.EndFrame();
     TileGen.EndFrame();
-    m_superAA->Draw();
+    if (m_superAA)
+      m_superAA->Draw();
   }
 
   EndFrameVideo();
@@ -2250,11 +2257,12 @@ bool CModel3::RunSoundBoardFrame(void)
   // Sound emulation is configured when content is loaded. Keep this tied to
   // the active Model 3 configuration so changing the core option cannot leave
   // the SCSP and DSB paths in a partially updated state.
-  if (!m_config["EmulateSound"].ValueAs<bool>())
+  if (!m_emulateSound.Get())
     return false;
   UINT32 start = CThread::GetTicks();
   bool bufferFull = SoundBoard.RunFrame();
   timings.sndTicks = CThread::GetTicks() - start;
+  timings.sndIdleCycles = SoundBoard.GetIdleCycles();
   return bufferFull;
 }
 
@@ -2527,12 +2535,12 @@ void CModel3::DeleteThreadObjects(void)
 
 void CModel3::DumpTimings(void)
 {
-  InfoLog("PPC:%3ums%c render:%3ums%c sync:%4uK%c%3ums%c snd:%3ums%c drv:%3ums%c frame:%3ums%c",
+  InfoLog("PPC:%3ums%c render:%3ums%c sync:%4uK%c%3ums%c snd:%3ums%c(idle %4uK) drv:%3ums%c frame:%3ums%c",
     timings.ppcTicks, (timings.ppcTicks > timings.renderTicks ? '!' : ','),
     timings.renderTicks, (timings.renderTicks > timings.ppcTicks ? '!' : ','),
     timings.syncSize / 1024, (timings.syncSize / 1024 > 128 ? '!' : ','),
     timings.syncTicks, (timings.syncTicks > 1 ? '!' : ','),
-    timings.sndTicks, (timings.sndTicks > 10 ? '!' : ','),
+    timings.sndTicks, (timings.sndTicks > 10 ? '!' : ','), timings.sndIdleCycles / 1000,
     timings.drvTicks, (timings.drvTicks > 10 ? '!' : ','),
     timings.frameTicks, (timings.frameTicks > 16 ? '!' : ' '));
 }
@@ -2913,6 +2921,7 @@ void CModel3::Reset(void)
   timings.syncTicks = 0;
   timings.renderTicks = 0;
   timings.sndTicks = 0;
+  timings.sndIdleCycles = 0;
   timings.drvTicks = 0;
 #ifdef NET_BOARD
   timings.netTicks = 0;
@@ -2934,6 +2943,11 @@ const Game &CModel3::GetGame() const
   return m_game;
 }
 
+const uint8_t *CModel3::GetVROM() const
+{
+  return vrom;
+}
+
 // Stepping-dependent parameters (MPC10x type, etc.) are initialized here
 Result CModel3::LoadGame(const Game &game, const ROMSet &rom_set)
 {
@@ -3139,7 +3153,7 @@ Result CModel3::LoadGame(const Game &game, const ROMSet &rom_set)
   return Result::OKAY;
 }
 
-void CModel3::AttachRenderers(CRender2D *Render2DPtr, IRender3D *Render3DPtr, SuperAA *superAA)
+void CModel3::AttachRenderers(IRender2D *Render2DPtr, IRender3D *Render3DPtr, SuperAA *superAA)
 {
   TileGen.AttachRenderer(Render2DPtr);
   GPU.AttachRenderer(Render3DPtr);
@@ -3287,6 +3301,8 @@ CModel3::CModel3(Util::Config::Node &config)
   : m_config(config),
     m_multiThreaded(config["MultiThreaded"].ValueAs<bool>()),
     m_gpuMultiThreaded(config["GPUMultiThreaded"].ValueAs<bool>()),
+    m_emulateSound(config, "EmulateSound"),
+    m_simulateNet(config, "SimulateNet"),
     sndBrdWakeNotify(false),
     TileGen(config),
     GPU(config),
@@ -60,6 +60,7 @@ struct FrameTimings
   UINT32 syncTicks;
   UINT32 renderTicks;
   UINT32 sndTicks;
+  UINT32 sndIdleCycles;   // sound 68K cycles skipped in idle loops
   UINT32 drvTicks;
 #ifdef NET_BOARD
   UINT32 netTicks;
@@ -87,6 +88,8 @@ public:
   bool ResumeThreads(void);
   void SaveState(CBlockFile *SaveState);
   void LoadState(CBlockFile *SaveState);
+  void SaveGraphicsState(CBlockFile *SaveState);
+  const uint8_t *GetVROM(void) const;
   void SaveNVRAM(CBlockFile *NVRAM);
   void LoadNVRAM(CBlockFile *NVRAM);
   void ClearNVRAM(void);
@@ -94,7 +97,7 @@ public:
   void RenderFrame(void);
   void Reset(void);
   const Game &GetGame(void) const;
-  void AttachRenderers(CRender2D *Render2DPtr, IRender3D *Render3DPtr, SuperAA *superAA);
+  void AttachRenderers(IRender2D *Render2DPtr, IRender3D *Render3DPtr, SuperAA *superAA);
   void AttachInputs(CInputs *InputsPtr);
   void AttachOutputs(COutputs *OutputsPtr);
   Result Init(void);
@@ -236,6 +239,8 @@ private:
   Util::Config::Node &m_config;
   bool m_multiThreaded;
   bool m_gpuMultiThreaded;
+  Util::Config::Setting<bool> m_emulateSound;
+  Util::Config::Setting<bool> m_simulateNet;
   bool m_skipRender;        // Frame skip hint passed to PPC thread
 
   // Game and hardware information
@@ -49,7 +49,7 @@
 class CModel3GraphicsState: public IEmulator, public IBus
 {
 public:
-  void SaveState(CBlockFile *SaveState) override
+  void SaveState(CBlockFile *) override
   {
   }
 
@@ -59,11 +59,22 @@ public:
     m_tileGen.LoadState(SaveState);
   }
 
-  void SaveNVRAM(CBlockFile *NVRAM) override
+  void SaveGraphicsState(CBlockFile *SaveState) override
   {
+    m_tileGen.SaveState(SaveState);
+    m_real3D.SaveState(SaveState);
   }
 
-  void LoadNVRAM(CBlockFile *NVRAM) override
+  const uint8_t *GetVROM(void) const override
+  {
+    return m_vrom.get();
+  }
+
+  void SaveNVRAM(CBlockFile *) override
+  {
+  }
+
+  void LoadNVRAM(CBlockFile *) override
   {
   }
 
@@ -71,7 +82,7 @@ public:
   {
   }
 
-  void RunFrame(void) override
+  void RunFrame(bool = false) override
   {
     RenderFrame();
   }
@@ -120,17 +131,17 @@ public:
     return Result::OKAY;
   }
 
-  void AttachRenderers(CRender2D *render2D, IRender3D *render3D, SuperAA* superAA) override
+  void AttachRenderers(IRender2D *render2D, IRender3D *render3D, SuperAA *) override
   {
     m_tileGen.AttachRenderer(render2D);
     m_real3D.AttachRenderer(render3D);
   }
 
-  void AttachInputs(CInputs *InputsPtr) override
+  void AttachInputs(CInputs *) override
   {
   }
 
-  void AttachOutputs(COutputs *OutputsPtr) override
+  void AttachOutputs(COutputs *) override
   {
   }
 
@@ -75,8 +75,10 @@ static FILE		*soundFP;
 #define OFFSET_AUDIO_FRONTRIGHT (OFFSET_AUDIO_FRONTLEFT + LENGTH_CHANNEL_BUFFER)    // 2940 bytes right audio channel
 #define OFFSET_AUDIO_REARLEFT   (OFFSET_AUDIO_FRONTRIGHT + LENGTH_CHANNEL_BUFFER)   // 2940 bytes (32 bits, 44.1 KHz, 1/60th second) left audio channel
 #define OFFSET_AUDIO_REARRIGHT  (OFFSET_AUDIO_REARLEFT + LENGTH_CHANNEL_BUFFER)     // 2940 bytes right audio channel
+#define OFFSET_MUSIC_LEFT       (OFFSET_AUDIO_REARRIGHT + LENGTH_CHANNEL_BUFFER)    // 2940 bytes DSB left audio channel
+#define OFFSET_MUSIC_RIGHT      (OFFSET_MUSIC_LEFT + LENGTH_CHANNEL_BUFFER)         // 2940 bytes DSB right audio channel
 
-#define MEMORY_POOL_SIZE        (0x100000 + 0x100000 + 4*LENGTH_CHANNEL_BUFFER)
+#define MEMORY_POOL_SIZE        (0x100000 + 0x100000 + 6*LENGTH_CHANNEL_BUFFER)
 
 
 /******************************************************************************
@@ -354,14 +356,17 @@ static INT16 ClampINT16(float x)
 bool CSoundBoard::RunFrame(void)
 {
 	// Run sound board first to generate SCSP audio
-	if (m_config["EmulateSound"].ValueAs<bool>())
+	if (m_emulateSound.Get())
 	{
 		M68KSetContext(&M68K);
+		UINT64 idleStart = M68KGetIdleCycles();
 		SCSP_Update();
+		idleCycles = (UINT32)(M68KGetIdleCycles() - idleStart);
 		M68KGetContext(&M68K);
 	}
 	else
 	{
+		idleCycles = 0;
 		memset(audioFL, 0, LENGTH_CHANNEL_BUFFER);
 		memset(audioFR, 0, LENGTH_CHANNEL_BUFFER);
 		memset(audioRL, 0, LENGTH_CHANNEL_BUFFER);
@@ -369,43 +374,30 @@ bool CSoundBoard::RunFrame(void)
 	}
 
 	// Compute sound volume as 
-	float soundVol = (float)std::max(0,std::min(200,m_config["SoundVolume"].ValueAs<int>()));
+	float soundVol = (float)std::max(0,std::min(200,m_soundVolume.Get()));
 	soundVol = soundVol * (float)(1.0 / 100.0);
 
-	// Apply sound volume setting to SCSP channels only
-	for (int i = 0; i < NUM_SAMPLES_PER_FRAME; i++) {
-		audioFL[i] *= soundVol;
-		audioFR[i] *= soundVol;
-		audioRL[i] *= soundVol;
-		audioRR[i] *= soundVol;
-	}
-
-	// Run DSB and mix with existing audio, apply music volume
-	if (NULL != DSB) {
-		// Will need to mix with proper front, rear channels or both (game specific)
-		constexpr bool mixDSBWithFront = true; // Everything to front channels for now
-		// Case "both" not handled for now
-		if (mixDSBWithFront)
-			DSB->RunFrame(audioFL, audioFR);
-		else
-			DSB->RunFrame(audioRL, audioRR);
-	}
+	// Run DSB into its own buffers, music volume is applied by the DSB
+	if (NULL != DSB)
+		DSB->RunFrame(musicL, musicR);
 
-	// Output the audio buffers
-	bool bufferFull = OutputAudio(NUM_SAMPLES_PER_FRAME, audioFL, audioFR, audioRL, audioRR, m_config["FlipStereo"].ValueAs<bool>());
+	// Sound volume (SCSP channels only) and the DSB mix, which goes to the
+	// front channels for now, are applied as the audio is output
+	bool bufferFull = OutputAudio(NUM_SAMPLES_PER_FRAME, audioFL, audioFR, audioRL, audioRR, soundVol,
+		DSB ? musicL : NULL, DSB ? musicR : NULL, m_flipStereo.Get());
 
 #ifdef SUPERMODEL_LOG_AUDIO
 	// Output to binary file
 	INT16	s;
 	for (int i = 0; i < NUM_SAMPLES_PER_FRAME; i++)
 	{	
-		s = ClampINT16(audioFL[i]);
+		s = ClampINT16(audioFL[i]*soundVol + (DSB ? musicL[i] : 0.0f));
 		fwrite(&s, sizeof(INT16), 1, soundFP);	// left channel
-		s = ClampINT16(audioFR[i]);
+		s = ClampINT16(audioFR[i]*soundVol + (DSB ? musicR[i] : 0.0f));
 		fwrite(&s, sizeof(INT16), 1, soundFP);	// right channel
-		s = ClampINT16(audioRL[i]);
+		s = ClampINT16(audioRL[i]*soundVol);
 		fwrite(&s, sizeof(INT16), 1, soundFP);	// left channel
-		s = ClampINT16(audioRR[i]);
+		s = ClampINT16(audioRR[i]*soundVol);
 		fwrite(&s, sizeof(INT16), 1, soundFP);	// right channel
 	}
 #endif // SUPERMODEL_LOG_AUDIO
@@ -504,12 +496,15 @@ Result CSoundBoard::Init(const UINT8 *soundROMPtr, const UINT8 *sampleROMPtr)
 	audioFR = (float*)&memoryPool[OFFSET_AUDIO_FRONTRIGHT];
 	audioRL = (float*)&memoryPool[OFFSET_AUDIO_REARLEFT];
 	audioRR = (float*)&memoryPool[OFFSET_AUDIO_REARRIGHT];
+	musicL = (float*)&memoryPool[OFFSET_MUSIC_LEFT];
+	musicR = (float*)&memoryPool[OFFSET_MUSIC_RIGHT];
 
 	// Initialize 68K core
 	M68KSetContext(&M68K);
 	M68KInit();
 	M68KAttachBus(this);
 	M68KSetIRQCallback(IRQAck);
+	M68KSetIdleDetect(true);	// SCSP state only changes between 68K timeslices
 	M68KGetContext(&M68K);
 		
 	// Initialize SCSPs
@@ -530,6 +525,11 @@ Result CSoundBoard::Init(const UINT8 *soundROMPtr, const UINT8 *sampleROMPtr)
 	return Result::OKAY;
 }
 
+UINT32 CSoundBoard::GetIdleCycles(void) const
+{
+	return idleCycles;
+}
+
 M68KCtx *CSoundBoard::GetM68K(void)
 {
 	return &M68K;
@@ -541,7 +541,10 @@ CDSB *CSoundBoard::GetDSB(void)
 }
 
 CSoundBoard::CSoundBoard(const Util::Config::Node &config)
-  : m_config(config)
+  : m_config(config),
+    m_emulateSound(config, "EmulateSound"),
+    m_soundVolume(config, "SoundVolume"),
+    m_flipStereo(config, "FlipStereo")
 {
 	DSB = NULL;
 	memoryPool = NULL;
@@ -551,11 +554,14 @@ CSoundBoard::CSoundBoard(const Util::Config::Node &config)
 	audioFR = NULL;
 	audioRL = NULL;
 	audioRR = NULL;
+	musicL = NULL;
+	musicR = NULL;
 	soundROM = NULL;
 	sampleROM = NULL;
 
 	sampleBank = nullptr;
 	ctrlReg = 0;
+	idleCycles = 0;
 
 	DebugLog("Built Sound Board\n");
 }
@@ -582,6 +588,8 @@ CSoundBoard::~CSoundBoard(void)
 	audioFR = NULL;
 	audioRL = NULL;
 	audioRR = NULL;
+	musicL = NULL;
+	musicR = NULL;
 	soundROM = NULL;
 	sampleROM = NULL;
 
@@ -130,6 +130,14 @@ public:
 	 */
 	void AttachDSB(CDSB *DSBPtr);
 	
+	/*
+	 * GetIdleCycles(void):
+	 *
+	 * Returns:
+	 *		Number of 68K cycles skipped in idle loops during the last frame.
+	 */
+	UINT32 GetIdleCycles(void) const;
+
 	/*
 	 * GetMS68K(void):
 	 *
@@ -184,12 +192,16 @@ private:
 	
 	// Config
 	const Util::Config::Node &m_config;
+	Util::Config::Setting<bool>	m_emulateSound;
+	Util::Config::Setting<int>	m_soundVolume;
+	Util::Config::Setting<bool>	m_flipStereo;
 
 	// Digital Sound Board
 	CDSB		*DSB;
 	
 	// 68K context
 	M68KCtx		M68K;
+	UINT32		idleCycles;		// cycles skipped in idle loops last frame
 	
 	// Sound board memory
 	const UINT8	*soundROM;		// 68K program ROM (passed in from parent object)
@@ -204,6 +216,7 @@ private:
 	// Audio
 	float* audioFL, * audioFR;	// left and right front audio channels (1/60th second, 44.1 KHz)
 	float* audioRL, * audioRR;	// left and right rear audio channels (1/60th second, 44.1 KHz)
+	float* musicL, * musicR;	// left and right DSB audio channels (1/60th second, 44.1 KHz)
 };
 
 
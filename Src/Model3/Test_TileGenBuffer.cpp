@@ -0,0 +1,77 @@
+#include "Model3/TileGenBuffer.h"
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+static void PrintTestResults(std::vector<std::pair<std::string, bool>> results)
+{
+  std::cout << "TEST RESULTS" << std::endl;
+  std::cout << "------------" << std::endl;
+  for (auto v: results)
+    std::cout << v.first << ": " << (v.second ? "passed" : "FAILED") << std::endl;
+}
+
+int main()
+{
+  std::vector<std::pair<std::string, bool>> test_results;
+  const UINT32 black = 0xFF000000;  // opaque black, differs from transparent only in alpha
+  static UINT32 line[512];
+
+  // Hidden pixels past 496 don't count
+  {
+    std::fill(line, line + 512, 0);
+    bool ok = TileGenBuffer::HashLine(line) == TileGenBuffer::EmptyLineHash();
+    std::fill(line + 496, line + 512, black);
+    ok &= TileGenBuffer::HashLine(line) == TileGenBuffer::EmptyLineHash();
+    test_results.push_back({ "Hidden pixels", ok });
+  }
+
+  // Every pixel turning opaque on its own changes the hash, and each one differently
+  {
+    std::fill(line, line + 512, 0);
+    std::set<UINT64> hashes = { TileGenBuffer::EmptyLineHash() };
+    for (int x = 0; x < 496; x++)
+    {
+      line[x] = black;
+      hashes.insert(TileGenBuffer::HashLine(line));
+      line[x] = 0;
+    }
+    test_results.push_back({ "Alpha change, one pixel", hashes.size() == 497 });
+  }
+
+  // Same for every pair of pixels, including pairs hashed by the same lane
+  {
+    std::fill(line, line + 512, 0);
+    std::set<UINT64> hashes = { TileGenBuffer::EmptyLineHash() };
+    size_t pairs = 0;
+    for (int x = 0; x < 496; x++)
+    {
+      line[x] = black;
+      for (int y = x + 1; y < 496; y++)
+      {
+        line[y] = black;
+        hashes.insert(TileGenBuffer::HashLine(line));
+        line[y] = 0;
+        pairs++;
+      }
+      line[x] = 0;
+    }
+    test_results.push_back({ "Alpha change, two pixels", hashes.size() == pairs + 1 });
+  }
+
+  // Stored hashes follow the surface
+  {
+    std::unique_ptr<TileGenBuffer> buffer(new TileGenBuffer());
+    buffer->GetLine(100)[7] = black;
+    buffer->UpdateLineHash(100);
+    bool ok = buffer->lineHash[100] != TileGenBuffer::EmptyLineHash() && buffer->lineHash[99] == TileGenBuffer::EmptyLineHash();
+    buffer->Clear();
+    ok &= buffer->lineHash[100] == TileGenBuffer::EmptyLineHash();
+    test_results.push_back({ "Line hashes", ok });
+  }
+
+  PrintTestResults(test_results);
+  return 0;
+}
@@ -38,11 +38,23 @@
  *
  * The computed palettes are updated whenever the real palette is modified, a
  * single color entry at a time. If the color register is modified, the entire
- * palette has to be recomputed accordingly.
+ * palette has to be recomputed accordingly. That is deferred until a tile is
+ * next decoded with it, so a layer that is disabled or not redrawn costs
+ * nothing, and is done from a third copy without the color offsets applied,
+ * which leaves only a saturating add or subtract per channel.
  *
  * The read-only copy of the palette, which is generated for the renderer, only
  * stores the two computed palettes.
  *
+ * Layer Cache
+ * -----------
+ *
+ * Each of the four layers is kept decoded, as final colours, in a 512x512
+ * surface. Writes stamp the VRAM, palette and colour offsets they touch and a
+ * tile pair is decoded again only if one of its sources was written since it
+ * was last decoded. Lines are copied out of these surfaces with the same
+ * scrolling and masking as before, so a static screen costs a masked copy.
+ *
  * TO-DO List:
  * -----------
  * - For consistency, the registers should probably be byte reversed (this is a
@@ -56,6 +68,7 @@
 #include <cstring>
 #include <algorithm>
 #include "Supermodel.h"
+#include "Util/SIMD.h"
 
 // Offsets of memory regions within TileGen memory pool
 #define OFFSET_VRAM         0x000000	// VRAM and palette data
@@ -93,9 +106,9 @@ void CTileGen::LoadState(CBlockFile *SaveState)
 	SaveState->Read(m_regs, sizeof(m_regs));
 
 	m_colourOffsetRegs[0].Update(m_regs[0x40 / 4]);
-	RecomputePalettes(0);	// layer 0 & 1
+	m_palDirty[0] = true;	// layer 0 & 1
 	m_colourOffsetRegs[1].Update(m_regs[0x44 / 4]);
-	RecomputePalettes(1);	// layer 2 & 3
+	m_palDirty[1] = true;	// layer 2 & 3
 
 	// clear surfaces
 	for (auto& s : m_drawSurface) {
@@ -130,6 +143,8 @@ void CTileGen::BeginVBlank(void)
 	printf("\n");
 */
 
+	WaitForLines();
+
 // clear surfaces
 	for (auto& s : m_drawSurface) {
 		s->Clear();
@@ -142,6 +157,7 @@ void CTileGen::EndVBlank(void)
 
 UINT32 CTileGen::SyncSnapshots(void)
 {
+	WaitForLines();
 
 	// swap buffers
 	for (int i = 0; i < 2; i++) {
@@ -189,6 +205,8 @@ UINT32 CTileGen::ReadRAM32(unsigned addr) const
 
 void CTileGen::WriteRAM32(unsigned addr, UINT32 data)
 {
+	WaitForLines();
+
 	*(UINT32 *) &m_vram[addr] = data;
 
 	if (addr >= 0x100000) {
@@ -197,9 +215,16 @@ void CTileGen::WriteRAM32(unsigned addr, UINT32 data)
 		unsigned color = addr / 4;	// color index
 
 		// Both palettes will be modified simultaneously
-		WritePalette(0, color, data);
-		WritePalette(1, color, data);
+		WritePalette(color, data);
+
+		m_palStamp16[color / 16]	= m_epoch;
+		m_palStamp256[color / 256]	= m_epoch;
 	}
+	else {
+		m_vramStamp[addr / 32] = m_epoch;
+	}
+
+	m_newStamps = true;
 }
 
 //TODO: 8- and 16-bit handlers have not been thoroughly tested
@@ -258,14 +283,20 @@ void CTileGen::WriteRegister(unsigned reg, UINT32 data)
 		break;
 	case 0x40:	// layer A/A' color offset
 		if (m_regs[reg / 4] != data) {
+			WaitForLines();
 			m_colourOffsetRegs[0].Update(data);
-			RecomputePalettes(0);
+			m_palDirty[0] = true;
+			m_colourOffsetStamp[0] = m_epoch;
+			m_newStamps = true;
 		}
 		break;
 	case 0x44:	// layer B/B' color offset
 		if (m_regs[reg / 4] != data) {
+			WaitForLines();
 			m_colourOffsetRegs[1].Update(data);
-			RecomputePalettes(1);
+			m_palDirty[1] = true;
+			m_colourOffsetStamp[1] = m_epoch;
+			m_newStamps = true;
 		}
 		break;
 	case 0x10:	// IRQ acknowledge
@@ -285,9 +316,12 @@ void CTileGen::WriteRegister(unsigned reg, UINT32 data)
 
 void CTileGen::Reset(void)
 {
+	WaitForLines();
+
 	unsigned memSize = (m_gpuMultiThreaded ? MEMORY_POOL_SIZE : MEM_POOL_SIZE_RW);
 	memset(memoryPool, 0, memSize);
 	memset(m_regs, 0, sizeof(m_regs));
+	InvalidateLayerCaches();
 
 	DebugLog("Tile Generator reset\n");
 }
@@ -297,7 +331,7 @@ void CTileGen::Reset(void)
  Configuration, Initialization, and Shutdown
 ******************************************************************************/
 
-void CTileGen::AttachRenderer(CRender2D *Render2DPtr)
+void CTileGen::AttachRenderer(IRender2D *Render2DPtr)
 {
 	Render2D = Render2DPtr;
 
@@ -332,6 +366,7 @@ Result CTileGen::Init(CIRQ *IRQObjectPtr)
 CTileGen::CTileGen(const Util::Config::Node& config)
 	: //m_config(config),
 	m_gpuMultiThreaded(config["GPUMultiThreaded"].ValueAs<bool>()),
+	m_lineThreaded(config["MultiThreaded"].ValueAsDefault<bool>(false)),
 	IRQ(nullptr),
 	Render2D(nullptr),
 	memoryPool(nullptr),
@@ -339,7 +374,15 @@ CTileGen::CTileGen(const Util::Config::Node& config)
 	m_vramP(nullptr),
 	m_palP(nullptr),
 	m_pal{nullptr},
-	m_regs{}
+	m_palBase(nullptr),
+	m_palDirty{},
+	m_regs{},
+	m_vramStamp(0x100000 / 32),
+	m_palStamp16(0x8000 / 16),
+	m_palStamp256(0x8000 / 256),
+	m_colourOffsetStamp{},
+	m_epoch(1),
+	m_newStamps(false)
 {
 	for (auto& s : m_drawSurface) {
 		s = std::make_shared<TileGenBuffer>();
@@ -354,11 +397,33 @@ CTileGen::CTileGen(const Util::Config::Node& config)
 		memset(p, 0, 0x8000 * sizeof(UINT32));
 	}
 
+	m_palBase = new UINT32[0x8000];
+	memset(m_palBase, 0, 0x8000 * sizeof(UINT32));
+
+	for (auto& c : m_layerCache) {
+		c.pixels.resize(512 * 512);
+		c.cellStamp.resize(64 * 32);
+		c.rowStamp.resize(64);
+	}
+
+	if (m_lineThreaded) {
+		m_lineThread = std::thread(&CTileGen::LineThread, this);
+	}
+
 	DebugLog("Built Tile Generator\n");
 }
 
 CTileGen::~CTileGen(void)
 {
+	if (m_lineThread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(m_lineMutex);
+			m_lineQuit = true;
+		}
+		m_lineQueued.notify_one();
+		m_lineThread.join();
+	}
+
 	// Dump tile generator RAM
 #if 0
 	FILE *fp;
@@ -385,38 +450,41 @@ CTileGen::~CTileGen(void)
 		delete[] p;
 		p = nullptr;
 	}
+
+	delete[] m_palBase;
+	m_palBase = nullptr;
 	
 	DebugLog("Destroyed Tile Generator\n");
 }
 
-bool CTileGen::IsEnabled(int layerNumber) const
+bool CTileGen::IsEnabled(const LineRegisters& regs, int layerNumber) const
 {
-	return (m_regs[0x60 / 4 + layerNumber] & 0x80000000) > 0;
+	return (regs.layerScroll[layerNumber] & 0x80000000) > 0;
 }
 
-bool CTileGen::Above3D(int layerNumber) const
+bool CTileGen::Above3D(const LineRegisters& regs, int layerNumber) const
 {
-	return (m_regs[0x20 / 4] >> (8 + layerNumber)) & 0x1;
+	return (regs.layerControl >> (8 + layerNumber)) & 0x1;
 }
 
-bool CTileGen::Is4Bit(int layerNumber) const
+bool CTileGen::Is4Bit(const LineRegisters& regs, int layerNumber) const
 {
-	return (m_regs[0x20 / 4] & (1 << (12 + layerNumber))) != 0;
+	return (regs.layerControl & (1 << (12 + layerNumber))) != 0;
 }
 
-int CTileGen::GetYScroll(int layerNumber) const
+int CTileGen::GetYScroll(const LineRegisters& regs, int layerNumber) const
 {
-	return (m_regs[0x60 / 4 + layerNumber] >> 16) & 0x1FF;
+	return (regs.layerScroll[layerNumber] >> 16) & 0x1FF;
 }
 
-int CTileGen::GetXScroll(int layerNumber) const
+int CTileGen::GetXScroll(const LineRegisters& regs, int layerNumber) const
 {
-	return m_regs[0x60 / 4 + layerNumber] & 0x3FF;
+	return regs.layerScroll[layerNumber] & 0x3FF;
 }
 
-bool CTileGen::LineScrollMode(int layerNumber) const
+bool CTileGen::LineScrollMode(const LineRegisters& regs, int layerNumber) const
 {
-	return (m_regs[0x60 / 4 + layerNumber] & 0x8000) != 0;
+	return (regs.layerScroll[layerNumber] & 0x8000) != 0;
 }
 
 int CTileGen::GetLineScroll(int layerNumber, int yCoord) const
@@ -466,16 +534,31 @@ int CTileGen::GetPixelMask(int lineMask, int xCoord) const
 	return (lineMask & maskTest) != 0;		// zero means alt layer
 }
 
-UINT32 CTileGen::GetColour32(int layer, UINT32 data) const
+// (i * 255) / 31
+static const UINT8 s_colour5To8[32] =
+{
+	0, 8, 16, 24, 32, 41, 49, 57, 65, 74, 82, 90, 98, 106, 115, 123,
+	131, 139, 148, 156, 164, 172, 180, 189, 197, 205, 213, 222, 230, 238, 246, 255
+};
+
+UINT32 CTileGen::GetColour32(UINT32 data) const
 {
-	int a = (((data >> 15) +1) & 1) * 255;
-	int b = ((((data >> 10) & 0x1F) * 255) / 31) & a;
-	int g = ((((data >> 5 ) & 0x1F) * 255) / 31) & a;
-	int r = (((data & 0x1F)         * 255) / 31) & a;
+	if (data & 0x8000) {
+		return 0;		// transparent
+	}
+
+	UINT32 b = s_colour5To8[(data >> 10) & 0x1F];
+	UINT32 g = s_colour5To8[(data >> 5) & 0x1F];
+	UINT32 r = s_colour5To8[data & 0x1F];
+
+	return 0xFF000000 | (b << 16) | (g << 8) | r;
+}
 
-	auto rr = m_colourOffsetRegs[layer].r + r;
-	auto gg = m_colourOffsetRegs[layer].g + g;
-	auto bb = m_colourOffsetRegs[layer].b + b;
+UINT32 CTileGen::AddColourOffset(int layer, UINT32 colour) const
+{
+	INT32 rr = m_colourOffsetRegs[layer].r + (INT32)(colour & 0xFF);
+	INT32 gg = m_colourOffsetRegs[layer].g + (INT32)((colour >> 8) & 0xFF);
+	INT32 bb = m_colourOffsetRegs[layer].b + (INT32)((colour >> 16) & 0xFF);
 
 	//std::clamp is embarassingly slow in debug mode .. 
 
@@ -488,9 +571,87 @@ UINT32 CTileGen::GetColour32(int layer, UINT32 data) const
 	if (bb > 255)		bb = 255;
 	else if (bb < 0)	bb = 0;
 
-	return (a << 24) | (bb << 16) | (gg << 8) | rr;
+	return (colour & 0xFF000000) | (bb << 16) | (gg << 8) | rr;
 }
 
+/*
+ * Vector paths for whole tiles, 8 pixels at a time. A palette entry is opaque
+ * if any of its alpha bits are set, the same test as the scalar loops below,
+ * which remain the reference and still draw the partial tiles at the edges of
+ * scrolled or masked layers.
+ */
+
+#if defined(SUPERMODEL_SIMD_AVX2)
+
+static inline void WriteOpaquePixels(UINT32* dst, const UINT32* pal, __m256i index)
+{
+	__m256i colour = _mm256_i32gather_epi32((const int*)pal, index, 4);
+	__m256i opaque = _mm256_cmpgt_epi32(_mm256_srli_epi32(colour, 24), _mm256_setzero_si256());
+	_mm256_maskstore_epi32((int*)dst, opaque, colour);
+}
+
+static inline void WriteOpaquePixels(UINT32* dst, const UINT32* colour)
+{
+	__m256i c		= _mm256_loadu_si256((const __m256i*)colour);
+	__m256i opaque	= _mm256_cmpgt_epi32(_mm256_srli_epi32(c, 24), _mm256_setzero_si256());
+	_mm256_maskstore_epi32((int*)dst, opaque, c);
+}
+
+static inline void Draw4BitTile(UINT32 pattern, const UINT32* pal, UINT32* dst)
+{
+	const __m256i shifts = _mm256_setr_epi32(28, 24, 20, 16, 12, 8, 4, 0);
+	__m256i index = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32((int)pattern), shifts), _mm256_set1_epi32(0xF));
+	WriteOpaquePixels(dst, pal, index);
+}
+
+static inline void Draw8BitTile(UINT32 pattern0, UINT32 pattern1, const UINT32* pal, UINT32* dst)
+{
+	const __m256i shifts = _mm256_setr_epi32(24, 16, 8, 0, 24, 16, 8, 0);
+	__m256i patterns = _mm256_setr_epi32((int)pattern0, (int)pattern0, (int)pattern0, (int)pattern0, (int)pattern1, (int)pattern1, (int)pattern1, (int)pattern1);
+	__m256i index = _mm256_and_si256(_mm256_srlv_epi32(patterns, shifts), _mm256_set1_epi32(0xFF));
+	WriteOpaquePixels(dst, pal, index);
+}
+
+#elif defined(SUPERMODEL_SIMD_SSE2) || defined(SUPERMODEL_SIMD_NEON)
+
+// no gathers, the lookups stay scalar but the transparency test and the stores don't branch
+static inline void WriteOpaquePixels(UINT32* dst, const UINT32* colour)
+{
+	for (int i = 0; i < 8; i += 4) {
+#if defined(SUPERMODEL_SIMD_SSE2)
+		__m128i c		= _mm_loadu_si128((const __m128i*)(colour + i));
+		__m128i opaque	= _mm_cmpgt_epi32(_mm_srli_epi32(c, 24), _mm_setzero_si128());
+		__m128i d		= _mm_loadu_si128((const __m128i*)(dst + i));
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_and_si128(opaque, c), _mm_andnot_si128(opaque, d)));
+#else
+		uint32x4_t c		= vld1q_u32(colour + i);
+		uint32x4_t opaque	= vtstq_u32(c, vdupq_n_u32(0xFF000000));
+		vst1q_u32(dst + i, vbslq_u32(opaque, c, vld1q_u32(dst + i)));
+#endif
+	}
+}
+
+static inline void Draw4BitTile(UINT32 pattern, const UINT32* pal, UINT32* dst)
+{
+	UINT32 colour[8];
+	for (int i = 0; i < 8; i++) {
+		colour[i] = pal[(pattern >> ((7 - i) * 4)) & 0xFu];
+	}
+	WriteOpaquePixels(dst, colour);
+}
+
+static inline void Draw8BitTile(UINT32 pattern0, UINT32 pattern1, const UINT32* pal, UINT32* dst)
+{
+	UINT32 colour[8];
+	for (int i = 0; i < 4; i++) {
+		colour[i]		= pal[(pattern0 >> ((3 - i) * 8)) & 0xFFu];
+		colour[i + 4]	= pal[(pattern1 >> ((3 - i) * 8)) & 0xFFu];
+	}
+	WriteOpaquePixels(dst, colour);
+}
+
+#endif
+
 void CTileGen::Draw4BitTilePair(int tileData, int hStart, int hEnd, int vFine, UINT32* const lineBuffer, const UINT32* const pal, int& x) const
 {
 	// Tile pattern offset: each tile occupies 32 bytes when using 4-bit pixels (offset of tile pattern within VRAM)
@@ -509,6 +670,15 @@ void CTileGen::Draw4BitTilePair(int tileData, int hStart, int hEnd, int vFine, U
 
 	uint32_t patterns[] = { m_vramP[patternOffset[0] + vFine], m_vramP[patternOffset[1] + vFine] };
 
+#if defined(SUPERMODEL_SIMD_SSE2) || defined(SUPERMODEL_SIMD_NEON)
+	if (hStart == 0 && hEnd == 16) {		// whole pair, every pair after the first on a line unless the mask switches
+		Draw4BitTile(patterns[0], pal + paletteIndex[0], lineBuffer + x);
+		Draw4BitTile(patterns[1], pal + paletteIndex[1], lineBuffer + x + 8);
+		x += 16;
+		return;
+	}
+#endif
+
 	for (int i = hStart; i < hEnd; i++, x++) {
 		auto pattern = patterns[i / 8];		// first 8 pixels use pattern 1, next 8 pattern 2
 		auto p = (pattern >> ((7 - (i % 8)) * 4)) & 0xFu;
@@ -554,6 +724,15 @@ void CTileGen::Draw8BitTilePair(int tileData, int hStart, int hEnd, int vFine, U
 	uint32_t patterns[] = { m_vramP[patternOffset[0] + (vFine * 2)], m_vramP[patternOffset[0] + (vFine * 2) + 1],
 							m_vramP[patternOffset[1] + (vFine * 2)], m_vramP[patternOffset[1] + (vFine * 2) + 1]};
 
+#if defined(SUPERMODEL_SIMD_SSE2) || defined(SUPERMODEL_SIMD_NEON)
+	if (hStart == 0 && hEnd == 16) {
+		Draw8BitTile(patterns[0], patterns[1], pal + paletteIndex[0], lineBuffer + x);
+		Draw8BitTile(patterns[2], patterns[3], pal + paletteIndex[1], lineBuffer + x + 8);
+		x += 16;
+		return;
+	}
+#endif
+
 	for (int i = hStart; i < hEnd; i++, x++) {
 		auto pattern = patterns[i / 4];		// each pattern contains 4 pixels
 		auto p = (pattern >> ((3 - (i % 4)) * 8)) & 0xFFu;
@@ -565,38 +744,264 @@ void CTileGen::Draw8BitTilePair(int tileData, int hStart, int hEnd, int vFine, U
 	}
 }
 
-void CTileGen::WritePalette(int layer, int address, UINT32 data)
+void CTileGen::CopyTilePair(const UINT32* const src, int hStart, int hEnd, UINT32* const lineBuffer, int& x) const
+{
+#if defined(SUPERMODEL_SIMD_SSE2) || defined(SUPERMODEL_SIMD_NEON)
+	if (hStart == 0 && hEnd == 16) {
+		WriteOpaquePixels(lineBuffer + x, src);
+		WriteOpaquePixels(lineBuffer + x + 8, src + 8);
+		x += 16;
+		return;
+	}
+#endif
+
+	for (int i = hStart; i < hEnd; i++, x++) {
+		if (src[i] >= 0x1000000) {			// if not transparent write pixel colour
+			lineBuffer[x] = src[i];
+		}
+	}
+}
+
+void CTileGen::WritePalette(int address, UINT32 data)
 {
-	m_pal[layer][address] = GetColour32(layer, data);
+	m_palBase[address] = GetColour32(data);
+
+	for (int i = 0; i < 2; i++) {
+		if (!m_palDirty[i]) {
+			m_pal[i][address] = AddColourOffset(i, m_palBase[address]);
+		}
+	}
 }
 
 void CTileGen::RecomputePalettes(int layer)
 {
+	m_palDirty[layer] = false;
+
+#if defined(SUPERMODEL_SIMD_SSE2) || defined(SUPERMODEL_SIMD_NEON)
+	// offsets are -256 to 254, split into what is added and what is subtracted, both saturating
+	const ColourOffsetRegister& offset = m_colourOffsetRegs[layer];
+	UINT32 add = 0;
+	UINT32 sub = 0;
+	int channel[3] = { offset.r, offset.g, offset.b };
+	for (int i = 0; i < 3; i++) {
+		add |= (UINT32)std::max(channel[i], 0) << (i * 8);
+		sub |= (UINT32)std::min(std::max(-channel[i], 0), 255) << (i * 8);	// -256 clears the channel just like -255
+	}
+
+#if defined(SUPERMODEL_SIMD_SSE2)
+	const __m128i vadd = _mm_set1_epi32((int)add);
+	const __m128i vsub = _mm_set1_epi32((int)sub);
+	for (int i = 0; i < 32768; i += 4) {
+		__m128i c = _mm_loadu_si128((const __m128i*)(m_palBase + i));
+		_mm_storeu_si128((__m128i*)(m_pal[layer] + i), _mm_subs_epu8(_mm_adds_epu8(c, vadd), vsub));
+	}
+#else
+	const uint8x16_t vadd = vreinterpretq_u8_u32(vdupq_n_u32(add));
+	const uint8x16_t vsub = vreinterpretq_u8_u32(vdupq_n_u32(sub));
+	for (int i = 0; i < 32768; i += 4) {
+		uint8x16_t c = vreinterpretq_u8_u32(vld1q_u32(m_palBase + i));
+		vst1q_u32(m_pal[layer] + i, vreinterpretq_u32_u8(vqsubq_u8(vqaddq_u8(c, vadd), vsub)));
+	}
+#endif
+#else
 	for (int i = 0; i < 32768; i++) {
-		WritePalette(layer, i, m_palP[i]);
+		m_pal[layer][i] = AddColourOffset(layer, m_palBase[i]);
+	}
+#endif
+}
+
+bool CTileGen::IsCellStale(int layerNumber, int tilePairNumber) const
+{
+	const UINT64 stamp	= m_layerCache[layerNumber].cellStamp[tilePairNumber];
+	const UINT32 tileData	= GetTileData(layerNumber, tilePairNumber);
+
+	if (m_vramStamp[(0xF8000 + (layerNumber * 0x2000) + (tilePairNumber * 4)) / 32] >= stamp ||
+		m_colourOffsetStamp[layerNumber / 2] >= stamp) {
+		return true;
+	}
+
+	// same pattern and palette addressing as Draw4BitTilePair() and Draw8BitTilePair()
+	if (m_layerCache[layerNumber].is4Bit) {
+		int pattern[2] = { (int)((((tileData >> 16) & 0x3FFF) << 1) | ((tileData >> 31) & 1)),
+						   (int)(((tileData & 0x3FFF) << 1) | ((tileData >> 15) & 1)) };
+
+		return	m_vramStamp[pattern[0]] >= stamp ||
+				m_vramStamp[pattern[1]] >= stamp ||
+				m_palStamp16[(tileData >> 20) & 0x7FF] >= stamp ||
+				m_palStamp16[(tileData >> 4) & 0x7FF] >= stamp;
+	}
+
+	int pattern[2] = { (int)((tileData >> 16) & 0x3FFF) * 2, (int)(tileData & 0x3FFF) * 2 };
+
+	return	m_vramStamp[pattern[0]] >= stamp ||
+			m_vramStamp[pattern[0] + 1] >= stamp ||
+			m_vramStamp[pattern[1]] >= stamp ||
+			m_vramStamp[pattern[1] + 1] >= stamp ||
+			m_palStamp256[(tileData >> 24) & 0x7F] >= stamp ||
+			m_palStamp256[(tileData >> 8) & 0x7F] >= stamp;
+}
+
+void CTileGen::DecodeCell(int layerNumber, int tilePairNumber)
+{
+	LayerCache& cache	= m_layerCache[layerNumber];
+	const int tileData	= GetTileData(layerNumber, tilePairNumber);
+	if (m_palDirty[layerNumber / 2]) {
+		RecomputePalettes(layerNumber / 2);
+	}
+
+	const UINT32* pal	= m_pal[layerNumber / 2];
+
+	UINT32* dst = &cache.pixels[((tilePairNumber / 32) * 8 * 512) + ((tilePairNumber % 32) * 16)];
+
+	for (int vFine = 0; vFine < 8; vFine++, dst += 512) {
+
+		// the tile pair draws only opaque pixels
+		memset(dst, 0, 16 * sizeof(UINT32));
+
+		int x = 0;
+		if (cache.is4Bit) {
+			Draw4BitTilePair(tileData, 0, 16, vFine, dst, pal, x);
+		}
+		else {
+			Draw8BitTilePair(tileData, 0, 16, vFine, dst, pal, x);
+		}
+	}
+
+	cache.cellStamp[tilePairNumber] = m_epoch;
+}
+
+void CTileGen::UpdateLayerCache(const LineRegisters& regs, int layerNumber, int row)
+{
+	LayerCache& cache = m_layerCache[layerNumber];
+
+	if (cache.is4Bit != Is4Bit(regs, layerNumber)) {
+		cache.is4Bit = !cache.is4Bit;
+		std::fill(cache.cellStamp.begin(), cache.cellStamp.end(), 0);
+		std::fill(cache.rowStamp.begin(), cache.rowStamp.end(), 0);
+	}
+
+	if (cache.rowStamp[row] == m_epoch) {
+		return;
+	}
+
+	for (int i = row * 32; i < (row + 1) * 32; i++) {
+		if (IsCellStale(layerNumber, i)) {
+			DecodeCell(layerNumber, i);
+		}
+	}
+
+	cache.rowStamp[row] = m_epoch;
+}
+
+void CTileGen::InvalidateLayerCaches(void)
+{
+	for (auto& c : m_layerCache) {
+		std::fill(c.cellStamp.begin(), c.cellStamp.end(), 0);
+		std::fill(c.rowStamp.begin(), c.rowStamp.end(), 0);
 	}
 }
 
 void CTileGen::DrawLine(int line)
 {
+	LineJob job;
+	job.line				= line;
+	job.regs.layerControl	= m_regs[0x20 / 4];
+	for (int i = 0; i < 4; i++) {
+		job.regs.layerScroll[i] = m_regs[0x60 / 4 + i];
+	}
+
+	if (!m_lineThreaded) {
+		DrawLine(job);
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(m_lineMutex);
+		m_lineDrawn.wait(lock, [this] { return m_linesQueued - m_linesDrawn < LINE_QUEUE_SIZE; });
+		m_lineQueue[m_linesQueued % LINE_QUEUE_SIZE] = job;
+		m_linesQueued++;
+	}
+
+	m_lineQueued.notify_one();
+}
+
+void CTileGen::WaitForLines(void)
+{
+	if (m_linesDrawn.load(std::memory_order_acquire) == m_linesQueued.load(std::memory_order_relaxed)) {
+		return;		// also the single threaded case, nothing is ever queued
+	}
+
+	std::unique_lock<std::mutex> lock(m_lineMutex);
+	m_lineDrawn.wait(lock, [this] { return m_linesDrawn == m_linesQueued; });
+}
+
+void CTileGen::LineThread(void)
+{
+	for (;;) {
+
+		LineJob job;
+
+		{
+			std::unique_lock<std::mutex> lock(m_lineMutex);
+			m_lineQueued.wait(lock, [this] { return m_lineQuit || m_linesDrawn != m_linesQueued; });
+
+			if (m_lineQuit) {
+				return;
+			}
+
+			job = m_lineQueue[m_linesDrawn % LINE_QUEUE_SIZE];
+		}
+
+		DrawLine(job);
+
+		{
+			std::lock_guard<std::mutex> lock(m_lineMutex);
+			m_linesDrawn++;
+		}
+
+		m_lineDrawn.notify_all();
+	}
+}
+
+void CTileGen::DrawLine(const LineJob& job)
+{
+	const int line = job.line;
+	const LineRegisters& regs = job.regs;
+
+	if (m_newStamps) {
+		m_epoch++;
+		m_newStamps = false;
+	}
+
+	bool drawn[2] = { false, false };	// lines of surfaces nothing was drawn to keep the hash Clear() gave them
+
 	for (int i = 2; i-- > 0;) {
 
 		const int primaryIndex	= i * 2;
 		const int altIndex		= (i * 2) + 1;
 
-		bool hasLayer[2] = { IsEnabled(primaryIndex), IsEnabled(altIndex) };
+		bool hasLayer[2] = { IsEnabled(regs, primaryIndex), IsEnabled(regs, altIndex) };
 		if (!hasLayer[0] && !hasLayer[1]) {
 			continue;	// both disabled let's try next pair
 		}
 
-		UINT32* drawLayers[2] = { m_drawSurface[Above3D(primaryIndex)]->GetLine(line),
-								  m_drawSurface[Above3D(altIndex)]->GetLine(line) };
+		UINT32* drawLayers[2] = { m_drawSurface[Above3D(regs, primaryIndex)]->GetLine(line),
+								  m_drawSurface[Above3D(regs, altIndex)]->GetLine(line) };
+
+		drawn[Above3D(regs, primaryIndex)] |= hasLayer[0];
+		drawn[Above3D(regs, altIndex)] |= hasLayer[1];
 
 		int lineMask	= GetLineMask(primaryIndex, line);
-		int scrollX[2]	= { LineScrollMode(primaryIndex) ? GetLineScroll(primaryIndex,line) : GetXScroll(primaryIndex),
-							LineScrollMode(altIndex) ? GetLineScroll(altIndex,line) : GetXScroll(altIndex) };
-		int scrollY[2]	= { GetYScroll(primaryIndex),GetYScroll(altIndex) };
-		
+		int scrollX[2]	= { LineScrollMode(regs, primaryIndex) ? GetLineScroll(primaryIndex,line) : GetXScroll(regs, primaryIndex),
+							LineScrollMode(regs, altIndex) ? GetLineScroll(altIndex,line) : GetXScroll(regs, altIndex) };
+		int scrollY[2]	= { GetYScroll(regs, primaryIndex),GetYScroll(regs, altIndex) };
+
+		for (int j = 0; j < 2; j++) {
+			if (hasLayer[j]) {
+				UpdateLayerCache(regs, primaryIndex + j, ((line + scrollY[j]) / 8) & 0x3F);
+			}
+		}
+
 		for (int x = 0; x < 496; ) {
 
 			int layer = (GetPixelMask(lineMask, x) + 1) & 1;	// 1 means primary layer, so we flip so it's zero
@@ -612,14 +1017,9 @@ void CTileGen::DrawLine(int line)
 				int	hStart			= GetHFine(x, scrollX[layer]);
 				int hEnd			= maskSwitch ? 16 - (x & 15) : 16;
 				int vFine			= GetVFine(line, scrollY[layer]);
-				int tileData		= GetTileData(index, tilePairNumber);
-
-				if (Is4Bit(index)) {
-					Draw4BitTilePair(tileData, hStart, hEnd, vFine, drawLayers[layer], m_pal[index / 2], x);
-				}
-				else {
-					Draw8BitTilePair(tileData, hStart, hEnd, vFine, drawLayers[layer], m_pal[index / 2], x);
-				}
+				const UINT32* src	= &m_layerCache[index].pixels[((((tilePairNumber / 32) * 8) + vFine) * 512) + ((tilePairNumber % 32) * 16)];
+
+				CopyTilePair(src, hStart, hEnd, drawLayers[layer], x);
 			}
 			else {
 				int	hFine = GetHFine(x, 0);
@@ -628,4 +1028,10 @@ void CTileGen::DrawLine(int line)
 		}
 
 	}
+
+	for (int i = 0; i < 2; i++) {
+		if (drawn[i]) {
+			m_drawSurface[i]->UpdateLineHash(line);
+		}
+	}
 }
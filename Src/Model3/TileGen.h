@@ -28,8 +28,13 @@
 #ifndef INCLUDED_TILEGEN_H
 #define INCLUDED_TILEGEN_H
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "IRQ.h"
-#include "Graphics/Render2D.h"
+#include "Graphics/IRender2D.h"
 #include "TileGenBuffer.h"
 
   /*
@@ -216,13 +221,13 @@ public:
 	 * AttachRenderer(render2DPtr):
 	 *
 	 * Attaches a 2D renderer for the tile generator to use. This function will
-	 * immediately pass along the information that a CRender2D object needs to
+	 * immediately pass along the information that a 2D renderer needs to
 	 * work with.
 	 *
 	 * Parameters:
 	 *		Render2DPtr		Pointer to a 2D renderer object.
 	 */
-	void AttachRenderer(CRender2D* Render2DPtr);
+	void AttachRenderer(IRender2D* Render2DPtr);
 
 	/*
 	 * Init(IRQObjectPtr):
@@ -244,7 +249,9 @@ public:
 	/*
 	 * DrawLine(line):
 	 *
-	 * Draw a line for the tilegen
+	 * Draw a line for the tilegen. When multi-threaded, the line is only
+	 * queued, with the registers as they are now, and drawn by a separate
+	 * thread. Queued lines are finished by SyncSnapshots() and BeginVBlank().
 	 *
 	 * Parameters:
 	 *		line	The line number to draw (from 0-383)
@@ -290,12 +297,39 @@ private:
 
 	ColourOffsetRegister m_colourOffsetRegs[2];
 
-	bool	IsEnabled			(int layerNumber) const;
-	bool	Above3D				(int layerNumber) const;
-	bool	Is4Bit				(int layerNumber) const;
-	int		GetYScroll			(int layerNumber) const;
-	int		GetXScroll			(int layerNumber) const;
-	bool	LineScrollMode		(int layerNumber) const;
+	// the registers a line reads, latched when the line is queued
+	struct LineRegisters
+	{
+		UINT32 layerControl;	// 0x20
+		UINT32 layerScroll[4];	// 0x60-0x6C
+	};
+
+	struct LineJob
+	{
+		int				line;
+		LineRegisters	regs;
+	};
+
+	// Decoded pixels of a whole 512x512 layer, final colours including transparent ones. Lines are
+	// copied out of these rather than decoding every tile pair on every line. Whenever something a
+	// tile pair is made of is written (name table entry, pattern, palette, colour offset) its source
+	// is stamped with the current epoch. A tile pair decoded in an earlier or the same epoch as one of
+	// its sources is stale. The epoch moves on with the first line drawn after any such write, so
+	// while nothing is written each row of tile pairs is checked only once.
+	struct LayerCache
+	{
+		std::vector<UINT32>	pixels;		// 512x512
+		std::vector<UINT64>	cellStamp;	// per tile pair, epoch it was decoded in, 0 = never
+		std::vector<UINT64>	rowStamp;	// per row of 32 tile pairs, epoch the row was last checked in
+		bool				is4Bit = false;
+	};
+
+	bool	IsEnabled			(const LineRegisters& regs, int layerNumber) const;
+	bool	Above3D				(const LineRegisters& regs, int layerNumber) const;
+	bool	Is4Bit				(const LineRegisters& regs, int layerNumber) const;
+	int		GetYScroll			(const LineRegisters& regs, int layerNumber) const;
+	int		GetXScroll			(const LineRegisters& regs, int layerNumber) const;
+	bool	LineScrollMode		(const LineRegisters& regs, int layerNumber) const;
 	int		GetLineScroll		(int layerNumber, int yCoord) const;
 	int		GetTilePairNumber	(int xCoord, int yCoord, int xScroll, int yScroll) const;
 	int		GetTileData			(int layerNum, int tilePairNumber) const;
@@ -303,18 +337,30 @@ private:
 	int		GetHFine			(int xCoord, int xScroll) const;
 	int		GetLineMask			(int layerNumber, int yCoord) const;
 	int		GetPixelMask		(int lineMask, int xCoord) const;
-	UINT32	GetColour32			(int layer, UINT32 data) const;
+	UINT32	GetColour32			(UINT32 data) const;					// without colour offset
+	UINT32	AddColourOffset		(int layer, UINT32 colour) const;
 	void	Draw4BitTilePair	(int tileData, int hStart, int hEnd, int vFine, UINT32* const lineBuffer, const UINT32* const pal, int& x) const;
 	void	Draw8BitTilePair	(int tileData, int hStart, int hEnd, int vFine, UINT32* const lineBuffer, const UINT32* const pal, int& x) const;
+	void	CopyTilePair		(const UINT32* const src, int hStart, int hEnd, UINT32* const lineBuffer, int& x) const;
+
+	bool	IsCellStale			(int layerNumber, int tilePairNumber) const;
+	void	DecodeCell			(int layerNumber, int tilePairNumber);
+	void	UpdateLayerCache	(const LineRegisters& regs, int layerNumber, int row);	// decodes stale tile pairs of a row
+	void	InvalidateLayerCaches(void);
 
-	void	WritePalette		(int layer, int address, UINT32 data);
+	void	WritePalette		(int address, UINT32 data);
 	void	RecomputePalettes	(int layer);	// 0 = bottom, 1 = top
 
+	void	DrawLine			(const LineJob& job);
+	void	LineThread			(void);
+	void	WaitForLines		(void);		// returns once every queued line has been drawn
+
 	//const Util::Config::Node& m_config;
 	const bool m_gpuMultiThreaded;
+	const bool m_lineThreaded;			// lines are drawn by m_lineThread, concurrently with the PowerPC
 
 	CIRQ*		IRQ;		// IRQ controller the tile generator is attached to
-	CRender2D*	Render2D;	// 2D renderer the tile generator is attached to
+	IRender2D*	Render2D;	// 2D renderer the tile generator is attached to
 
 	UINT8*		memoryPool;		// all memory allocated here
 	UINT8*		m_vram;			// 1.125MB of VRAM
@@ -322,13 +368,38 @@ private:
 	UINT32*		m_palP;			// just a pointer to the palette ram which comes after the vram
 
 	UINT32*		m_pal[2];		// cached decoded pallettes. 0 = layer 0&1, 1 = layer 2&3
+	UINT32*		m_palBase;		// decoded palette before the colour offsets are added
+	bool		m_palDirty[2];	// colour offset changed, m_pal is recomputed before it is next read
 
 	// Registers
 	UINT32	m_regs[64];
 
+	// decoded layers and the write stamps of what they are decoded from
+	LayerCache			m_layerCache[4];
+	std::vector<UINT64>	m_vramStamp;			// per 32 bytes of VRAM below the palette (a 4-bit tile, half an 8-bit one)
+	std::vector<UINT64>	m_palStamp16;			// per 16 colours
+	std::vector<UINT64>	m_palStamp256;			// per 256 colours
+	UINT64				m_colourOffsetStamp[2];
+	UINT64				m_epoch;
+	bool				m_newStamps;			// something was written since the last line was drawn
+
 	// buffers we draw to
 	std::shared_ptr<TileGenBuffer> m_drawSurface[2];	// drawing surfaces 0 = bottom, 1 = top
 	std::shared_ptr<TileGenBuffer> m_drawSurfaceRO[2];	// read only version for threading, we can swap between the 2. Maybe not needed.
+
+	// Line thread. Lines only read VRAM, the palettes and their latched registers, so anything that
+	// changes the former waits for the queue to drain first. Lines see the same memory they would
+	// have if they were drawn straight away, mid-frame raster effects included.
+	static const unsigned LINE_QUEUE_SIZE = 64;
+
+	std::thread				m_lineThread;
+	std::mutex				m_lineMutex;
+	std::condition_variable	m_lineQueued;
+	std::condition_variable	m_lineDrawn;
+	LineJob					m_lineQueue[LINE_QUEUE_SIZE];
+	std::atomic<unsigned>	m_linesQueued	{ 0 };
+	std::atomic<unsigned>	m_linesDrawn	{ 0 };
+	bool					m_lineQuit		= false;
 };
 
 
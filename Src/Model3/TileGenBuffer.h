@@ -2,16 +2,61 @@
 #define _TILEGENBUFFER_H_
 
 #include "Types.h"
+#include <algorithm>
 #include <cstring>
 
 struct TileGenBuffer
 {
-	TileGenBuffer() : data{ 0 } {}
+	TileGenBuffer() : data{ 0 } { std::fill(lineHash, lineHash + 384, EmptyLineHash()); }
 
 	UINT32* GetLine(int number) { return data + (512 * number); };
-	void	Clear() { std::memset(data, 0, sizeof(data)); }
+	void	Clear() { std::memset(data, 0, sizeof(data)); std::fill(lineHash, lineHash + 384, EmptyLineHash()); }
+	void	UpdateLineHash(int number) { lineHash[number] = HashLine(GetLine(number)); }
+
+	// 64-bit hash of the 496 visible pixels, four independent lanes of two pixels each. A multiply only
+	// carries changes towards the high bits, so every step folds them back down as well. Otherwise a change
+	// confined to the alpha bytes would only reach the top few bits and two of them could cancel out.
+	static UINT64 HashLine(const UINT32* line)
+	{
+		const UINT64 prime = 0x100000001B3ull;
+		UINT64 h[4] = { 0xCBF29CE484222325ull, 0x84222325CBF29CE4ull, 0x9E3779B97F4A7C15ull, 0x7F4A7C159E3779B9ull };
+
+		for (int x = 0; x < 496; x += 8) {
+			for (int i = 0; i < 4; i++) {
+				UINT64 v;
+				std::memcpy(&v, line + x + (i * 2), sizeof(v));
+				h[i] = (h[i] ^ v) * prime;
+				h[i] ^= h[i] >> 29;
+			}
+		}
+
+		UINT64 hash = 0;
+		for (int i = 0; i < 4; i++) {
+			hash = (hash ^ Mix(h[i])) * prime;
+		}
+		return Mix(hash);
+	}
+
+	// MurmurHash3 finalizer, every input bit affects every output bit
+	static UINT64 Mix(UINT64 h)
+	{
+		h ^= h >> 33;
+		h *= 0xFF51AFD7ED558CCDull;
+		h ^= h >> 33;
+		h *= 0xC4CEB9FE1A85EC53ull;
+		h ^= h >> 33;
+		return h;
+	}
+
+	static UINT64 EmptyLineHash()
+	{
+		static const UINT32 empty[496] = { 0 };
+		static const UINT64 hash = HashLine(empty);
+		return hash;
+	}
 
 	UINT32 data[512 * 384];
+	UINT64 lineHash[384];		// of each line as drawn by the tile generator, lets renderers upload only the lines that changed
 };
 
 #endif
@@ -47,11 +47,14 @@ extern void SetAudioType(Game::AudioTypes type);
 extern Result OpenAudio(const Util::Config::Node& config);
 
 /*
- * OutputAudio(unsigned numSamples, *INT16 leftBuffer, *INT16 rightBuffer)
+ * OutputAudio(numSamples, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer, volume, leftMusicBuffer, rightMusicBuffer, flipStereo)
  *
- * Sends a chunk of two-channel audio with the given number of samples to the audio system.
+ * Sends a chunk of four-channel audio with the given number of samples to the audio system.
+ * The SCSP channels are scaled by volume and the music channels (DSB, NULL if there is none)
+ * are added to the front channels before balance, channel layout and conversion to INT16
+ * are applied, all in a single pass.
  */
-extern bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, bool flipStereo);
+extern bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, float volume, const float* leftMusicBuffer, const float* rightMusicBuffer, bool flipStereo);
 
 /*
  * AdjustAudioForCPUFrequency(float ppc_frequency_mhz)
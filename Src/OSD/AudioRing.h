@@ -0,0 +1,202 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011 Bart Trzynadlowski, Nik Henson
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * AudioRing.h
+ *
+ * Ring buffer of interleaved INT16 sample frames between the thread that
+ * mixes audio (OutputAudio(), called by the sound board) and the one that
+ * plays it (the host audio callback).
+ *
+ * There must be exactly one producer and one consumer. Each side stores only
+ * its own index and loads the other's, so neither ever waits for the other.
+ * The two indices live on separate cache lines and are not written back and
+ * forth between cores on every access. Indices count up to twice the capacity
+ * before wrapping, which tells a full ring apart from an empty one without
+ * requiring a power-of-two capacity.
+ *
+ * The consumer records how many frames were queued whenever it reads (the
+ * occupancy watermarks) and counts the reads that found too few. The producer
+ * counts the writes it had to drop because they didn't fit.
+ */
+
+#ifndef INCLUDED_AUDIORING_H
+#define INCLUDED_AUDIORING_H
+
+#include "Types.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <vector>
+
+class CAudioRing
+{
+public:
+  struct Stats
+  {
+    unsigned capacity = 0;        // frames
+    unsigned lowWatermark = 0;    // fewest frames queued when the consumer read
+    unsigned highWatermark = 0;   // most frames queued when the consumer read
+    unsigned underRuns = 0;       // reads that wanted more frames than were queued
+    unsigned overRuns = 0;        // writes dropped because they didn't fit
+  };
+
+  /*
+   * Init(capacity, channels, queued):
+   *
+   * Allocates the ring and resets the statistics. Neither side may be running.
+   *
+   * Parameters:
+   *    capacity  Size of the ring in frames.
+   *    channels  Samples per frame.
+   *    queued    Frames of silence that are initially queued for playback.
+   */
+  void Init(unsigned capacity, unsigned channels, unsigned queued)
+  {
+    m_capacity = capacity;
+    m_channels = channels;
+    m_buffer.assign((size_t)capacity * channels, 0);
+    m_write.store(std::min(queued, capacity), std::memory_order_relaxed);
+    m_read.store(0, std::memory_order_relaxed);
+    m_overRuns.store(0, std::memory_order_relaxed);
+    m_underRuns.store(0, std::memory_order_relaxed);
+    m_lowWatermark.store(UINT_MAX, std::memory_order_relaxed);
+    m_highWatermark.store(0, std::memory_order_relaxed);
+  }
+
+  unsigned Capacity() const
+  {
+    return m_capacity;
+  }
+
+  /*
+   * Producer side. Free() is a lower bound that only grows until the next
+   * Commit(). Frames are written through WriteSpan() and published by
+   * Commit().
+   */
+
+  unsigned Free() const
+  {
+    return m_capacity - Distance(m_write.load(std::memory_order_relaxed), m_read.load(std::memory_order_acquire));
+  }
+
+  // Address of the frame 'offset' frames past the write index and the number of contiguous frames from there
+  INT16 *WriteSpan(unsigned offset, unsigned *frames)
+  {
+    unsigned pos = Position(Advance(m_write.load(std::memory_order_relaxed), offset));
+    *frames = m_capacity - pos;
+    return &m_buffer[(size_t)pos * m_channels];
+  }
+
+  void Commit(unsigned frames)
+  {
+    m_write.store(Advance(m_write.load(std::memory_order_relaxed), frames), std::memory_order_release);
+  }
+
+  void CountOverRun()
+  {
+    m_overRuns.store(m_overRuns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  /*
+   * Consumer side. Queued() is a lower bound that only grows until the next
+   * Consume() and updates the watermarks. Frames are read through ReadSpan()
+   * and released by Consume(); they must not be accessed afterwards.
+   */
+
+  unsigned Queued()
+  {
+    unsigned queued = Distance(m_write.load(std::memory_order_acquire), m_read.load(std::memory_order_relaxed));
+    if (queued < m_lowWatermark.load(std::memory_order_relaxed))
+      m_lowWatermark.store(queued, std::memory_order_relaxed);
+    if (queued > m_highWatermark.load(std::memory_order_relaxed))
+      m_highWatermark.store(queued, std::memory_order_relaxed);
+    return queued;
+  }
+
+  // Address of the frame 'offset' frames past the read index and the number of contiguous frames from there
+  const INT16 *ReadSpan(unsigned offset, unsigned *frames) const
+  {
+    unsigned pos = Position(Advance(m_read.load(std::memory_order_relaxed), offset));
+    *frames = m_capacity - pos;
+    return &m_buffer[(size_t)pos * m_channels];
+  }
+
+  void Consume(unsigned frames)
+  {
+    m_read.store(Advance(m_read.load(std::memory_order_relaxed), frames), std::memory_order_release);
+  }
+
+  void CountUnderRun()
+  {
+    m_underRuns.store(m_underRuns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  // May be called from any thread, counters are read individually
+  Stats GetStats() const
+  {
+    Stats stats;
+    stats.capacity = m_capacity;
+    stats.lowWatermark = m_lowWatermark.load(std::memory_order_relaxed);
+    stats.highWatermark = m_highWatermark.load(std::memory_order_relaxed);
+    stats.underRuns = m_underRuns.load(std::memory_order_relaxed);
+    stats.overRuns = m_overRuns.load(std::memory_order_relaxed);
+    if (stats.lowWatermark > stats.highWatermark)  // never read
+      stats.lowWatermark = 0;
+    return stats;
+  }
+
+private:
+  static const size_t CACHE_LINE = 64;
+
+  unsigned Position(unsigned index) const
+  {
+    return index >= m_capacity ? index - m_capacity : index;
+  }
+
+  unsigned Advance(unsigned index, unsigned frames) const
+  {
+    index += frames;
+    return index >= 2 * m_capacity ? index - 2 * m_capacity : index;
+  }
+
+  unsigned Distance(unsigned write, unsigned read) const
+  {
+    return write >= read ? write - read : write + 2 * m_capacity - read;
+  }
+
+  // Only the contents change while running
+  std::vector<INT16> m_buffer;
+  unsigned m_capacity = 0;
+  unsigned m_channels = 0;
+
+  // Written by the producer
+  alignas(CACHE_LINE) std::atomic<unsigned> m_write{ 0 };
+  std::atomic<unsigned> m_overRuns{ 0 };
+
+  // Written by the consumer
+  alignas(CACHE_LINE) std::atomic<unsigned> m_read{ 0 };
+  std::atomic<unsigned> m_underRuns{ 0 };
+  std::atomic<unsigned> m_lowWatermark{ UINT_MAX };
+  std::atomic<unsigned> m_highWatermark{ 0 };
+};
+
+#endif  // INCLUDED_AUDIORING_H
@@ -86,6 +86,14 @@
     "; one (e.g., Fighting Vipers 2)\n"
     "LegacySoundDSP = false\n"
     "\n"
+    "; Resampling of Digital Sound Board music to 44.1 KHz: sinc (windowed sinc\n"
+    "; filter, no aliasing) or linear (linear interpolation, cheaper)\n"
+    "MusicResampler = sinc\n"
+    "\n"
+    "; Memory in MB for decoded loops of looping music tracks, which are then\n"
+    "; played without decoding them again (0 disables caching)\n"
+    "MusicCacheSize = 64\n"
+    "\n"
     "; Network board\n"
     "Network = false\n"
     "SimulateNet = true\n"
@@ -54,6 +54,7 @@
   */
 
 #include <OSD/Audio.h>
+#include <OSD/AudioRing.h>
 
 #include "Supermodel.h"
 #include "SDLIncludes.h"
@@ -83,7 +84,6 @@ int nbHostAudioChannels = NUM_CHANNELS_M3;   // Number of channels on host
 
 static int samples_per_frame_host = SAMPLES_PER_FRAME_M3;
 static int bytes_per_sample_host = BYTES_PER_SAMPLE_M3;
-static int bytes_per_frame_host = BYTES_PER_FRAME_M3;
 
 // Balance percents for mixer
 float BalanceLeftRight = 0; // 0 mid balance, 100: left only,  -100:right only 
@@ -96,20 +96,10 @@ float balanceFactorRearRight  = 1.0f;
 
 static bool enabled = true;         // True if sound output is enabled
 static constexpr unsigned latency = 20;       // Audio latency to use (ie size of audio buffer) as percentage of max buffer size
-static constexpr bool underRunLoop = true;    // True if should loop back to beginning of buffer on under-run, otherwise sound is just skipped
 
 static constexpr unsigned playSamples = 512;  // Size (in samples) of callback play buffer
 
-static UINT32 audioBufferSize = 0;  // Size (in bytes) of audio buffer
-static INT8* audioBuffer = NULL;    // Audio buffer
-
-static UINT32 writePos = 0;         // Current position at which writing into buffer
-static UINT32 playPos = 0;          // Current position at which playing data in buffer via callback
-
-static bool writeWrapped = false;   // True if write position has wrapped around at end of buffer but play position has not done so yet
-
-static unsigned underRuns = 0;      // Number of buffer under-runs that have occured
-static unsigned overRuns = 0;       // Number of buffer over-runs that have occured
+static CAudioRing audioRing;        // Mixed frames, written by OutputAudio() and read by PlayCallback()
 
 static AudioCallbackFPtr callback = NULL; // Pointer to audio callback that is called when audio buffer is less than half empty
 static void* callbackData = NULL;         // Pointer to data to be passed to audio callback when it is called
@@ -173,118 +163,62 @@ static INT16 ClampINT16(float x)
 
 static void PlayCallback(void* data, Uint8* stream, int len)
 {
-    //printf("PlayCallback(%d) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u]\n",
-    //	len, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize);
-
-    // Get current write position and adjust it if write has wrapped but play position has not
-    UINT32 adjWritePos = writePos;
-    if (writeWrapped)
-        adjWritePos += audioBufferSize;
-
-    // Check if play position overlaps write position (ie buffer under-run)
-    if (playPos + len > adjWritePos)
+    // Only the frames queued now are played, the sound board thread may keep
+    // adding more meanwhile without either side waiting for the other
+    unsigned wanted = len / bytes_per_sample_host;
+    unsigned queued = audioRing.Queued();
+    unsigned toPlay = std::min(queued, wanted);
+
+    // Check for buffer under-run and play silence for the missing part
+    if (toPlay < wanted)
     {
-        underRuns++;
-
-        //printf("Audio buffer under-run #%u in PlayCallback(%d) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u]\n",
-        //	underRuns, len, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize);
+        audioRing.CountUnderRun();
 
-        // See what action to take on under-run
-        if (underRunLoop)
-        {
-            // If loop, then move play position back to beginning of data in buffer
-            playPos = adjWritePos + bytes_per_frame_host;
-
-            // Check if play position has moved past end of buffer
-            if (playPos >= audioBufferSize)
-                // If so, wrap it around to beginning again (but keep write wrapped flag as before)
-                playPos -= audioBufferSize;
-            else
-                // Otherwise, set write wrapped flag as will now appear as if write has wrapped but play position has not
-                writeWrapped = true;
-        }
-        else
-        {
-            // Otherwise, just copy silence to audio output stream and exit
-            memset(stream, 0, len);
-            return;
-        }
-    }
-
-    INT8* src1;
-    INT8* src2;
-    UINT32 len1;
-    UINT32 len2;
-
-    // Check if play region extends past end of buffer
-    if (playPos + len > audioBufferSize)
-    {
-        // If so, split play region into two
-        src1 = audioBuffer + playPos;
-        src2 = audioBuffer;
-        len1 = audioBufferSize - playPos;
-        len2 = len - len1;
-    }
-    else
-    {
-        // Otherwise, just copy whole region
-        src1 = audioBuffer + playPos;
-        src2 = nullptr;
-        len1 = len;
-        len2 = 0;
+        //printf("Audio buffer under-run #%u in PlayCallback(%d) [queued = %u]\n",
+        //	audioRing.GetStats().underRuns, len, queued);
     }
 
     // Check if audio is enabled
+    UINT32 bytesPlayed = 0;
     if (enabled)
     {
-        // If so, copy play region into audio output stream
-        memcpy(stream, src1, len1);
-
-        // Also, if not looping on under-runs then blank region out
-        if (!underRunLoop)
-            memset(src1, 0, len1);
-
-        if (len2)
+        // If so, copy play region into audio output stream, in two parts if it wraps around
+        while (bytesPlayed < toPlay * bytes_per_sample_host)
         {
-            // If region was split into two, copy second half into audio output stream as well
-            memcpy(stream + len1, src2, len2);
-
-            // Also, if not looping on under-runs then blank region out
-            if (!underRunLoop)
-                memset(src2, 0, len2);
+            unsigned contiguous;
+            const INT16* src = audioRing.ReadSpan(bytesPlayed / bytes_per_sample_host, &contiguous);
+            UINT32 numBytes = std::min<UINT32>(contiguous * bytes_per_sample_host, toPlay * bytes_per_sample_host - bytesPlayed);
+            memcpy(stream + bytesPlayed, src, numBytes);
+            bytesPlayed += numBytes;
         }
     }
-    else
-        // Otherwise, just copy silence to audio output stream
-        memset(stream, 0, len);
+    memset(stream + bytesPlayed, 0, len - bytesPlayed);
 
-    // Move play position forward for next time
-    playPos += len;
+    // Hand the frames back to the writer
+    audioRing.Consume(toPlay);
 
-    bool bufferFull = adjWritePos + 2 * bytes_per_frame_host > playPos + audioBufferSize;
-
-    // Check if play position has moved past end of buffer
-    if (playPos >= audioBufferSize)
-    {
-        // If so, wrap it around to beginning again and reset write wrapped flag
-        playPos -= audioBufferSize;
-        writeWrapped = false;
-    }
+    bool bufferFull = queued - toPlay + 2 * samples_per_frame_host > audioRing.Capacity();
 
     // If buffer is not full then call audio callback
     if (callback && !bufferFull)
         callback(callbackData);
 }
 
-static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, void* dest, bool flipStereo)
+// Channel value after sound volume, music and balance are applied
+static inline float ChannelValue(const float* buffer, const float* musicBuffer, unsigned i, float volume, float balanceFactor)
+{
+    return (buffer[i] * volume + (musicBuffer ? musicBuffer[i] : 0.0f)) * balanceFactor;
+}
+
+static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, float volume, const float* leftMusicBuffer, const float* rightMusicBuffer, void* dest, bool flipStereo)
 {
     INT16* p = (INT16*)dest;
 
     if (nbHostAudioChannels == 1) {
         for (unsigned i = 0; i < numSamples; i++) {
             INT16 monovalue = MixINT16(
-                MixFloat(leftFrontBuffer[i] * balanceFactorFrontLeft,rightFrontBuffer[i] * balanceFactorFrontRight),
-                MixFloat(leftRearBuffer[i]  * balanceFactorRearLeft, rightRearBuffer[i]  * balanceFactorRearRight));
+                MixFloat(ChannelValue(leftFrontBuffer, leftMusicBuffer, i, volume, balanceFactorFrontLeft), ChannelValue(rightFrontBuffer, rightMusicBuffer, i, volume, balanceFactorFrontRight)),
+                MixFloat(ChannelValue(leftRearBuffer, NULL, i, volume, balanceFactorRearLeft), ChannelValue(rightRearBuffer, NULL, i, volume, balanceFactorRearRight)));
             *p++ = monovalue;
         }
     } else {
@@ -300,8 +234,8 @@ static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const
         // Now order channels according to audio type
         if (nbHostAudioChannels == 2) {
             for (unsigned i = 0; i < numSamples; i++) {
-                INT16 leftvalue = MixINT16(leftFrontBuffer[i] * balanceFactorFrontLeft, leftRearBuffer[i] * balanceFactorRearLeft);
-                INT16 rightvalue = MixINT16(rightFrontBuffer[i]*balanceFactorFrontRight, rightRearBuffer[i]*balanceFactorRearRight);
+                INT16 leftvalue = MixINT16(ChannelValue(leftFrontBuffer, leftMusicBuffer, i, volume, balanceFactorFrontLeft), ChannelValue(leftRearBuffer, NULL, i, volume, balanceFactorRearLeft));
+                INT16 rightvalue = MixINT16(ChannelValue(rightFrontBuffer, rightMusicBuffer, i, volume, balanceFactorFrontRight), ChannelValue(rightRearBuffer, NULL, i, volume, balanceFactorRearRight));
                 if (flipStereo) // swap left and right channels
                 {
                     *p++ = rightvalue;
@@ -313,10 +247,10 @@ static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const
             }
         } else if (nbHostAudioChannels == 4) {
             for (unsigned i = 0; i < numSamples; i++) {
-                float frontLeftValue = leftFrontBuffer[i]*balanceFactorFrontLeft;
-                float frontRightValue = rightFrontBuffer[i]*balanceFactorFrontRight;
-                float rearLeftValue = leftRearBuffer[i]*balanceFactorRearLeft;
-                float rearRightValue = rightRearBuffer[i]*balanceFactorRearRight;
+                float frontLeftValue = ChannelValue(leftFrontBuffer, leftMusicBuffer, i, volume, balanceFactorFrontLeft);
+                float frontRightValue = ChannelValue(rightFrontBuffer, rightMusicBuffer, i, volume, balanceFactorFrontRight);
+                float rearLeftValue = ChannelValue(leftRearBuffer, NULL, i, volume, balanceFactorRearLeft);
+                float rearRightValue = ChannelValue(rightRearBuffer, NULL, i, volume, balanceFactorRearRight);
 
                 // Check game audio type
                 switch (AudioType) {
@@ -485,193 +419,67 @@ Result OpenAudio(const Util::Config::Node& config)
         soundFreq_Hz = MIN_SND_FREQ;
     samples_per_frame_host = (INT32)(SAMPLE_RATE_M3 / soundFreq_Hz);
     bytes_per_sample_host = (nbHostAudioChannels * sizeof(INT16));
-    bytes_per_frame_host =  (samples_per_frame_host * bytes_per_sample_host);
 
 
     // Create audio buffer
-    uint32_t bufferSize = ((SAMPLE_RATE_M3 * latency) / MAX_LATENCY) * bytes_per_sample_host;
-    if (!(bufferSize % bytes_per_sample_host == 0)) {
-        return ErrorLog("must be an integer multiple of the sample size\n");
-    }
-    audioBufferSize = bufferSize;
-
-    int minBufferSize = 3 * bytes_per_frame_host;
-    audioBufferSize = std::max<int>(minBufferSize, audioBufferSize);
-    audioBuffer = new(std::nothrow) INT8[audioBufferSize];
-    if (audioBuffer == NULL) {
-        float audioBufMB = (float)audioBufferSize / (float)0x100000;
-        return ErrorLog("Insufficient memory for audio latency buffer (need %1.1f MB).", audioBufMB);
-    }
-    memset(audioBuffer, 0, sizeof(INT8) * audioBufferSize);
-
-    // Set initial play position to be beginning of buffer and initial write position to be half-way into buffer
-    playPos = 0;
-    uint32_t endOfBuffer = bufferSize - bytes_per_frame_host;
-    uint32_t midpointAfterFirstFrameUnaligned = bytes_per_frame_host + (bufferSize - bytes_per_frame_host) / 2;
-    uint32_t extraPaddingNeeded = (bytes_per_frame_host - midpointAfterFirstFrameUnaligned % bytes_per_frame_host) % bytes_per_frame_host;
-    uint32_t midpointAfterFirstFrame = midpointAfterFirstFrameUnaligned + extraPaddingNeeded;
-    if (!((endOfBuffer % (nbHostAudioChannels*sizeof(INT16))) == 0)) {
-        return ErrorLog("must be an integer multiple of the sample size\n");
-    }
-    if (!((midpointAfterFirstFrame % nbHostAudioChannels*sizeof(INT16)) == 0)) {
-        return ErrorLog("must be an integer multiple of the sample size\n");
-    }
+    unsigned bufferFrames = (SAMPLE_RATE_M3 * latency) / MAX_LATENCY;
+    unsigned capacity = std::max<unsigned>(3 * samples_per_frame_host, bufferFrames);
 
-    writePos = std::min<int>(endOfBuffer, midpointAfterFirstFrame);
-    writeWrapped = false;
+    // Initially queue silence up to half-way into buffer, rounded up to a whole number of frames
+    unsigned endOfBuffer = bufferFrames - samples_per_frame_host;
+    unsigned midpointAfterFirstFrameUnaligned = samples_per_frame_host + (bufferFrames - samples_per_frame_host) / 2;
+    unsigned extraPaddingNeeded = (samples_per_frame_host - midpointAfterFirstFrameUnaligned % samples_per_frame_host) % samples_per_frame_host;
+    unsigned midpointAfterFirstFrame = midpointAfterFirstFrameUnaligned + extraPaddingNeeded;
 
-    // Reset counters
-    underRuns = 0;
-    overRuns = 0;
+    // Also resets the under-run and over-run counters
+    audioRing.Init(capacity, nbHostAudioChannels, std::min(endOfBuffer, midpointAfterFirstFrame));
 
     // Start audio playing
     SDL_PauseAudio(0);
     return Result::OKAY;
 }
 
-bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, bool flipStereo)
+bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, float volume, const float* leftMusicBuffer, const float* rightMusicBuffer, bool flipStereo)
 {
-    //printf("OutputAudio(%u) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u]\n",
-    //	numSamples, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize);
-
-    UINT32 bytesRemaining;
-    UINT32 bytesToCopy;
-    INT16* src;
+    //printf("OutputAudio(%u) [free = %u, capacity = %u]\n", numSamples, audioRing.Free(), audioRing.Capacity());
 
     // Number of samples should never be more than max number of samples per frame
     if (numSamples > (unsigned)samples_per_frame_host)
         numSamples = samples_per_frame_host;
 
-    // Mix together left and right channels into single chunk of data
-    INT16 mixBuffer[NUM_CHANNELS_M3 * (SAMPLE_RATE_M3 / MIN_SND_FREQ)];
-    MixChannels(numSamples, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer, mixBuffer, flipStereo);
-
-    // Lock SDL audio callback so that it doesn't interfere with following code
-    SDL_LockAudio();
-
-    // Calculate number of bytes for current sound chunk
-    UINT32 numBytes = numSamples * bytes_per_sample_host;
-
-    // Get end of current play region (writing must occur past this point)
-    UINT32 playEndPos = playPos + bytes_per_frame_host;
-
-    // Undo any wrap-around of the write position that may have occurred to create following ordering: playPos < playEndPos < writePos
-    if (playEndPos > writePos && writeWrapped)
-        writePos += audioBufferSize;
-
-    // Check if play region has caught up with write position and now overlaps it (ie buffer under-run)
-    if (playEndPos > writePos)
-    {
-        underRuns++;
-
-        //printf("Audio buffer under-run #%u in OutputAudio(%u) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u, numBytes = %u]\n",
-        //	underRuns, numSamples, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize, numBytes);
-
-        // See what action to take on under-run
-		if (underRunLoop)
-		{
-            // If loop, then move play position back to beginning of data in buffer
-            playPos = writePos + numBytes + bytes_per_frame_host;
-
-            // Check if play position has moved past end of buffer
-            if (playPos >= audioBufferSize)
-                // If so, wrap it around to beginning again (but keep write wrapped flag as before)
-                playPos -= audioBufferSize;
-			else
-			{
-                // Otherwise, set write wrapped flag as will now appear as if write has wrapped but play position has not
-                writeWrapped = true;
-                writePos += audioBufferSize;
-            }
-		}
-		else
-		{
-            // Otherwise, bump write position forward in chunks until it is past end of play region
-			do
-			{
-                writePos += numBytes;
-			}
-			while (playEndPos > writePos);
-        }
-    }
-
-    // Check if write position has caught up with play region and now overlaps it (ie buffer over-run)
-    bool overRun = writePos + numBytes > playPos + audioBufferSize;
-
-    bool bufferFull = writePos + 2 * bytes_per_frame_host > playPos + audioBufferSize;
+    // Only this thread writes to the ring, so the free space can only grow
+    // until the chunk is committed below. No need to lock the SDL audio
+    // callback out.
+    unsigned freeSamples = audioRing.Free();
 
-    // Move write position back to within buffer
-    if (writePos >= audioBufferSize)
-        writePos -= audioBufferSize;
+    bool bufferFull = freeSamples < 2 * (unsigned)samples_per_frame_host;
 
-    // Handle buffer over-run
-    if (overRun)
+    // Check if write position has caught up with play region (ie buffer over-run)
+    if (freeSamples < numSamples)
     {
-        overRuns++;
+        audioRing.CountOverRun();
 
-        //printf("Audio buffer over-run #%u in OutputAudio(%u) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u, numBytes = %u]\n",
-        //	overRuns, numSamples, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize, numBytes);
-
-        bufferFull = true;
+        //printf("Audio buffer over-run #%u in OutputAudio(%u) [free = %u, capacity = %u]\n",
+        //	audioRing.GetStats().overRuns, numSamples, freeSamples, audioRing.Capacity());
 
         // Discard current chunk of data
+        return true;
     }
-    else
-    {
-    src = mixBuffer;
-    INT8* dst1;
-    INT8* dst2;
-    UINT32 len1;
-    UINT32 len2;
-
-    // Check if write region extends past end of buffer
-	if (writePos + numBytes > audioBufferSize)
-	{
-        // If so, split write region into two
-        dst1 = audioBuffer + writePos;
-        dst2 = audioBuffer;
-        len1 = audioBufferSize - writePos;
-        len2 = numBytes - len1;
-	}
-	else
-	{
-        // Otherwise, just copy whole region
-        dst1 = audioBuffer + writePos;
-        dst2 = NULL;
-        len1 = numBytes;
-        len2 = NULL;
-    }
-
-    // Copy chunk to write position in buffer
-    bytesRemaining = numBytes;
-    bytesToCopy = (bytesRemaining > len1 ? len1 : bytesRemaining);
-    memcpy(dst1, src, bytesToCopy);
-
-    // Adjust for number of bytes copied
-    bytesRemaining -= bytesToCopy;
-    src = (INT16*)((UINT8*)src + bytesToCopy);
 
-	if (bytesRemaining)
-	{
-        // If write region was split into two, copy second half of chunk into buffer as well
-        bytesToCopy = (bytesRemaining > len2 ? len2 : bytesRemaining);
-        memcpy(dst2, src, bytesToCopy);
-    }
-
-    // Move write position forward for next time
-    writePos += numBytes;
-
-    // Check if write position has moved past end of buffer
-	if (writePos >= audioBufferSize)
-	{
-        // If so, wrap it around to beginning again and set write wrapped flag
-        writePos -= audioBufferSize;
-        writeWrapped = true;
-    }
+    // Mix channels straight into the ring buffer, in two parts if the write region wraps around
+    unsigned contiguous;
+    INT16* dst = audioRing.WriteSpan(0, &contiguous);
+    unsigned numSamples1 = std::min(numSamples, contiguous);
+    MixChannels(numSamples1, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer, volume, leftMusicBuffer, rightMusicBuffer, dst, flipStereo);
+    if (numSamples1 < numSamples)
+    {
+        dst = audioRing.WriteSpan(numSamples1, &contiguous);
+        MixChannels(numSamples - numSamples1, leftFrontBuffer + numSamples1, rightFrontBuffer + numSamples1, leftRearBuffer + numSamples1, rightRearBuffer + numSamples1, volume,
+                    leftMusicBuffer ? leftMusicBuffer + numSamples1 : NULL, rightMusicBuffer ? rightMusicBuffer + numSamples1 : NULL, dst, flipStereo);
     }
 
-    // Unlock SDL audio callback
-    SDL_UnlockAudio();
+    // Publish the chunk to the audio callback
+    audioRing.Commit(numSamples);
 
     // Return whether buffer is half full
     return bufferFull;
@@ -682,7 +490,7 @@ void CloseAudio()
     // Close SDL audio output
     SDL_CloseAudio();
 
-    // Delete audio buffer
-    delete[] audioBuffer;
-    audioBuffer = nullptr;
+    CAudioRing::Stats stats = audioRing.GetStats();
+    InfoLog("Audio buffer: %u-%u of %u samples queued, %u under-run(s), %u over-run(s).",
+            stats.lowWatermark, stats.highWatermark, stats.capacity, stats.underRuns, stats.overRuns);
 }
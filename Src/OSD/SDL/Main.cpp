@@ -90,8 +90,11 @@
 #include "Debugger/SupermodelDebugger.h"
 #include "Graphics/Legacy3D/Legacy3D.h"
 #include "Graphics/New3D/New3D.h"
+#include "Graphics/Render2D.h"
+#include "Graphics/NullRender.h"
 #include "Model3/IEmulator.h"
 #include "Model3/Model3.h"
+#include "Model3/GraphicsCapture.h"
 #include "OSD/Audio.h"
 #include "Graphics/New3D/VBO.h"
 #include "Graphics/SuperAA.h"
@@ -123,6 +126,7 @@ static Util::Config::Node s_runtime_config("Global");
 ******************************************************************************/
 
 SDL_Window *s_window = nullptr;
+static bool s_headless = false;         // null renderers, the window is never shown and has no GL context
 
 /*
  * Position and size of rectangular region within OpenGL display to render to.
@@ -365,6 +369,31 @@ static Result CreateGLScreen(bool coreContext, bool quadRendering, const std::st
   return SetGLGeometry(xOffsetPtr, yOffsetPtr, xResPtr, yResPtr, totalXResPtr, totalYResPtr, keepAspectRatio);
 }
 
+/*
+ * CreateHeadlessScreen():
+ *
+ * Creates a hidden window without a GL context for headless runs. The input
+ * systems and window title updates still need a window to talk to.
+ */
+static Result CreateHeadlessScreen(const std::string &caption, unsigned *xOffsetPtr, unsigned *yOffsetPtr, unsigned *xResPtr, unsigned *yResPtr, unsigned *totalXResPtr, unsigned *totalYResPtr)
+{
+  if (s_window != nullptr)
+    return ErrorLog("Internal error: CreateHeadlessScreen() called more than once");
+
+  if (SDL_Init(SDL_INIT_VIDEO) != 0)
+    return ErrorLog("Unable to initialize SDL video subsystem: %s\n", SDL_GetError());
+
+  s_window = SDL_CreateWindow(caption.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, *xResPtr, *yResPtr, SDL_WINDOW_HIDDEN);
+  if (nullptr == s_window)
+    return ErrorLog("Unable to create a window: %s\n", SDL_GetError());
+
+  *xOffsetPtr = 0;
+  *yOffsetPtr = 0;
+  *totalXResPtr = *xResPtr;
+  *totalYResPtr = *yResPtr;
+  return Result::OKAY;
+}
+
 static void DestroyGLScreen()
 {
   if (s_window != nullptr)
@@ -852,6 +881,9 @@ bool BeginFrameVideo()
 
 void EndFrameVideo()
 {
+  if (s_headless)
+    return;
+
   // Show crosshairs for light gun games
   if (videoInputs)
     s_crosshair->Update(currentInputs, videoInputs, xOffset, yOffset, xRes, yRes);
@@ -960,15 +992,22 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
     SDL_SetWindowBordered(s_window, SDL_FALSE);
   }
 
-  SetFullScreenRefreshRate();
+  if (s_headless)
+  {
+    xOffset = yOffset = 0;
+  }
+  else
+  {
+    SetFullScreenRefreshRate();
 
-  bool stretch = s_runtime_config["Stretch"].ValueAs<bool>();
-  bool fullscreen = s_runtime_config["FullScreen"].ValueAs<bool>();
-  if (Result::OKAY != ResizeGLScreen(&xOffset, &yOffset ,&xRes, &yRes, &totalXRes, &totalYRes, !stretch, fullscreen))
-    return 1;
+    bool stretch = s_runtime_config["Stretch"].ValueAs<bool>();
+    bool fullscreen = s_runtime_config["FullScreen"].ValueAs<bool>();
+    if (Result::OKAY != ResizeGLScreen(&xOffset, &yOffset ,&xRes, &yRes, &totalXRes, &totalYRes, !stretch, fullscreen))
+      return 1;
 
-  // Info log GL information
-  PrintGLInfo(false, true, false);
+    // Info log GL information
+    PrintGLInfo(false, true, false);
+  }
 
   // Initialize audio system
   SetAudioType(game.audio);
@@ -980,7 +1019,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
   gameHasLightguns = !!(game.inputs & (Game::INPUT_GUN1|Game::INPUT_GUN2));
   gameHasLightguns |= game.name == "lostwsga";
   currentInputs = game.inputs;
-  if (gameHasLightguns)
+  if (gameHasLightguns && !s_headless)
     videoInputs = Inputs;
   else
     videoInputs = nullptr;
@@ -997,18 +1036,39 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
   uint64_t perfCountPerFrame = s_perfCounterFrequency * 1000 / GetDesiredRefreshRateMilliHz();
   uint64_t nextTime = 0;
 
+  // Frame captures for the Real3D replay tool
+  CGraphicsCapture gfxCapture(s_runtime_config, s_analysisPath);
+
   // Initialize the renderers
-  SuperAA* superAA = new SuperAA(aaValue, CRTcolors);
-  superAA->Init(totalXRes, totalYRes);  // pass actual frame sizes here
-  CRender2D *Render2D = new CRender2D(s_runtime_config);
-  IRender3D *Render3D = s_runtime_config["New3DEngine"].ValueAs<bool>() ? ((IRender3D *) new New3D::CNew3D(s_runtime_config, Model3->GetGame().name)) : ((IRender3D *) new Legacy3D::CLegacy3D(s_runtime_config));
+  SuperAA* superAA = nullptr;
+  IRender2D *Render2D;
+  IRender3D *Render3D;
 
   UpscaleMode upscaleMode = (UpscaleMode)s_runtime_config["UpscaleMode"].ValueAs<int>();
 
-  if (Result::OKAY != Render2D->Init(xOffset*aaValue, yOffset*aaValue, xRes*aaValue, yRes*aaValue, totalXRes*aaValue, totalYRes*aaValue, superAA->GetTargetID(), upscaleMode))
-    goto QuitError;
-  if (Result::OKAY != Render3D->Init(xOffset*aaValue, yOffset*aaValue, xRes*aaValue, yRes*aaValue, totalXRes*aaValue, totalYRes*aaValue, superAA->GetTargetID()))
-    goto QuitError;
+  if (s_headless)
+  {
+    // Nothing is drawn, so there is nothing for SuperAA to resolve either
+    Render2D = new CNullRender2D();
+    Render3D = new CNullRender3D(s_runtime_config, Model3->GetGame().name, s_runtime_config["HeadlessSceneTraversal"].ValueAs<bool>());
+
+    if (Result::OKAY != Render2D->Init(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes, 0, upscaleMode))
+      goto QuitError;
+    if (Result::OKAY != Render3D->Init(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes, 0))
+      goto QuitError;
+  }
+  else
+  {
+    superAA = new SuperAA(aaValue, CRTcolors);
+    superAA->Init(totalXRes, totalYRes);  // pass actual frame sizes here
+    Render2D = new CRender2D(s_runtime_config);
+    Render3D = s_runtime_config["New3DEngine"].ValueAs<bool>() ? ((IRender3D *) new New3D::CNew3D(s_runtime_config, Model3->GetGame().name)) : ((IRender3D *) new Legacy3D::CLegacy3D(s_runtime_config));
+
+    if (Result::OKAY != Render2D->Init(xOffset*aaValue, yOffset*aaValue, xRes*aaValue, yRes*aaValue, totalXRes*aaValue, totalYRes*aaValue, superAA->GetTargetID(), upscaleMode))
+      goto QuitError;
+    if (Result::OKAY != Render3D->Init(xOffset*aaValue, yOffset*aaValue, xRes*aaValue, yRes*aaValue, totalXRes*aaValue, totalYRes*aaValue, superAA->GetTargetID()))
+      goto QuitError;
+  }
 
   Model3->AttachRenderers(Render2D,Render3D, superAA);
 
@@ -1052,7 +1112,10 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
     if (paused)
       Model3->RenderFrame();
     else
+    {
       Model3->RunFrame();
+      gfxCapture.EndFrame(Model3);
+    }
 
 #ifdef SUPERMODEL_DEBUGGER
     bool processUI = true;
@@ -1130,7 +1193,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
       if (Outputs != NULL)
         Outputs->SetValue(OutputPause, paused);
     }
-    else if (Inputs->uiFullScreen->Pressed())
+    else if (Inputs->uiFullScreen->Pressed() && !s_headless)
     {
       // Toggle emulator fullscreen
       s_runtime_config.Get("FullScreen").SetValue(!s_runtime_config["FullScreen"].ValueAs<bool>());
@@ -1296,7 +1359,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
       s_runtime_config.Get("Throttle").SetValue(!s_runtime_config["Throttle"].ValueAs<bool>());
       printf("Frame limiting: %s\n", s_runtime_config["Throttle"].ValueAs<bool>() ? "On" : "Off");
     }
-    else if (Inputs->uiScreenshot->Pressed())
+    else if (Inputs->uiScreenshot->Pressed() && !s_headless)
     {
       // Make a screenshot
       Screenshot();
@@ -1518,6 +1581,8 @@ Util::Config::Node DefaultConfig()
   config.Set("EmulateDSB", true, "Sound");
   config.Set("SoundVolume", 100, "Sound", 0, 200);
   config.Set("MusicVolume", 100, "Sound", 0, 200);
+  config.Set<std::string>("MusicResampler", "sinc", "Sound", "", "", { "linear","sinc" });
+  config.Set("MusicCacheSize", 64, "Sound", 0, 1024);
   // Other sound options
   config.Set("LegacySoundDSP", false, "Sound"); // New config option for games that do not play correctly with MAME's SCSP sound core.
   // CDriveBoard
@@ -1545,6 +1610,10 @@ Util::Config::Node DefaultConfig()
   config.Set("Crosshairs", int(0), "Video", 0, 0, { 0,1,2,3 });
   config.Set<std::string>("CrosshairStyle", "vector", "Video", "", "", { "bmp","vector" });
   config.Set("NoWhiteFlash", false, "Video");
+  config.Set("Headless", false, "Video");
+  config.Set("HeadlessSceneTraversal", false, "Video");
+  config.Set("GfxCaptureFrame", 0, "Video");
+  config.Set("GfxCaptureCount", 0, "Video");
   config.Set("FlipStereo", false, "Sound");
 #ifdef SUPERMODEL_WIN32
   config.Set<std::string>("InputSystem", "dinput", "Core", "", "", { "sdl","sdlgamepad","dinput","xinput","rawinput" });
@@ -1857,6 +1926,8 @@ static void Help(void)
   puts("  -multi-texture          Use 8 texture maps for decoding (legacy engine)");
   puts("  -no-multi-texture       Decode to single texture (legacy engine) [Default]");
   puts("  -no-white-flash         Disables white flash when games disable 3D rendering");
+  puts("  -headless               Run without drawing anything or creating a GL context");
+  puts("  -headless-traversal     With -headless, still build the 3D scene every frame");
   puts("  -vert-shader=<file>     Load Real3D vertex shader for 3D rendering");
   puts("  -frag-shader=<file>     Load Real3D fragment shader for 3D rendering");
   puts("  -print-gl-info          Print OpenGL driver information and quit");
@@ -1865,6 +1936,10 @@ static void Help(void)
   puts("  -sound-volume=<vol>     Volume of SCSP-generated sound in %, applies only");
   puts("                          when Digital Sound Board is present [Default: 100]");
   puts("  -music-volume=<vol>     Digital Sound Board volume in % [Default: 100]");
+  puts("  -music-resampler=<r>    Digital Sound Board resampling: sinc or linear");
+  puts("                          [Default: sinc]");
+  puts("  -music-cache-size=<mb>  Memory for decoded loops of looping music tracks in");
+  puts("                          MB, 0 to disable [Default: 64]");
   puts("  -balance=<bal>          Relative front/rear balance in % [Default: 0]");
   puts("  -channels=<c>           Number of sound channels to use on host [Default: 4]");
   puts("  -flip-stereo            Swap left and right audio channels");
@@ -1892,6 +1967,9 @@ static void Help(void)
   puts("");
   puts("Debug Options:");
   puts("  -dump-textures          Write textures to bitmap image files on exit");
+  puts("  -gfx-capture-frame=<n>  First frame to capture for the Real3D replay tool");
+  puts("  -gfx-capture-count=<n>  Number of frames to capture into the Analysis");
+  puts("                          directory [Default: 0, disabled]");
 #ifdef SUPERMODEL_DEBUGGER
   puts("  -disable-debugger       Completely disable debugger functionality");
   puts("  -enter-debugger         Enter debugger at start of emulation");
@@ -1943,13 +2021,17 @@ static ParsedCommandLine ParseCommandLine(int argc, char **argv)
     { "-frag-shader",           "FragmentShader"          },
     { "-sound-volume",          "SoundVolume"             },
     { "-music-volume",          "MusicVolume"             },
+    { "-music-resampler",       "MusicResampler"          },
+    { "-music-cache-size",      "MusicCacheSize"          },
     { "-balance",               "Balance"                 },
     { "-channels", 	            "NbSoundChannels"         },
     { "-soundfreq",             "SoundFreq"               },
     { "-input-system",          "InputSystem"             },
     { "-outputs",               "Outputs"                 },
     { "-log-output",            "LogOutput"               },
-    { "-log-level",             "LogLevel"                }
+    { "-log-level",             "LogLevel"                },
+    { "-gfx-capture-frame",     "GfxCaptureFrame"         },
+    { "-gfx-capture-count",     "GfxCaptureCount"         }
   };
   static const std::map<std::string, std::pair<std::string, bool>> bool_options
   { // -option
@@ -1987,6 +2069,8 @@ static ParsedCommandLine ParseCommandLine(int argc, char **argv)
     { "-new-scsp",            { "LegacySoundDSP",   false } },
     { "-no-white-flash",      { "NoWhiteFlash",     true } },
     { "-white-flash",         { "NoWhiteFlash",     false } },
+    { "-headless",            { "Headless",         true } },
+    { "-headless-traversal",  { "HeadlessSceneTraversal", true } },
 #ifdef NET_BOARD
     { "-net",                 { "Network",       true } },
     { "-no-net",              { "Network",       false } },
@@ -2337,7 +2421,16 @@ int main(int argc, char **argv)
   // Create a window
   xRes = 496;
   yRes = 384;
-  if (Result::OKAY != CreateGLScreen(s_runtime_config["New3DEngine"].ValueAs<bool>(), s_runtime_config["QuadRendering"].ValueAs<bool>(),"Supermodel", false, &xOffset, &yOffset, &xRes, &yRes, &totalXRes, &totalYRes, false, false))
+  s_headless = s_runtime_config["Headless"].ValueAs<bool>();
+  if (s_headless)
+  {
+    if (Result::OKAY != CreateHeadlessScreen("Supermodel", &xOffset, &yOffset, &xRes, &yRes, &totalXRes, &totalYRes))
+    {
+      exitCode = 1;
+      goto Exit;
+    }
+  }
+  else if (Result::OKAY != CreateGLScreen(s_runtime_config["New3DEngine"].ValueAs<bool>(), s_runtime_config["QuadRendering"].ValueAs<bool>(),"Supermodel", false, &xOffset, &yOffset, &xRes, &yRes, &totalXRes, &totalYRes, false, false))
   {
     exitCode = 1;
     goto Exit;
@@ -2345,7 +2438,7 @@ int main(int argc, char **argv)
 
   // Create Crosshair
   s_crosshair = new CCrosshair(s_runtime_config);
-  if (s_crosshair->Init() != Result::OKAY)
+  if (!s_headless && s_crosshair->Init() != Result::OKAY)
   {
       ErrorLog("Unable to load bitmap crosshair texture\n");
       exitCode = 1;
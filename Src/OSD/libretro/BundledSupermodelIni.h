@@ -105,685 +105,688 @@ const unsigned char bundled_supermodel_ini[] = {
   0x31, 0x0d, 0x0a, 0x53, 0x6f, 0x75, 0x6e, 0x64, 0x56, 0x6f, 0x6c, 0x75,
   0x6d, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x4d, 0x75,
   0x73, 0x69, 0x63, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x20, 0x3d, 0x20,
-  0x31, 0x30, 0x30, 0x0d, 0x0a, 0x53, 0x6f, 0x75, 0x6e, 0x64, 0x46, 0x72,
-  0x65, 0x71, 0x20, 0x3d, 0x20, 0x35, 0x37, 0x2e, 0x35, 0x32, 0x34, 0x32,
-  0x0d, 0x0a, 0x4c, 0x65, 0x67, 0x61, 0x63, 0x79, 0x53, 0x6f, 0x75, 0x6e,
-  0x64, 0x44, 0x53, 0x50, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42, 0x61,
-  0x6c, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42,
-  0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x69,
-  0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42, 0x61, 0x6c,
-  0x61, 0x6e, 0x63, 0x65, 0x46, 0x72, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x61,
-  0x72, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x4e, 0x62, 0x53, 0x6f, 0x75,
-  0x6e, 0x64, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x20, 0x3d,
-  0x20, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69, 0x64, 0x65,
-  0x6f, 0x2f, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x53, 0x65,
-  0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x0d, 0x0a, 0x4e, 0x65, 0x77, 0x33,
-  0x44, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x0d,
-  0x0a, 0x51, 0x75, 0x61, 0x64, 0x52, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69,
-  0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x58, 0x52, 0x65, 0x73,
-  0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x31, 0x39,
-  0x32, 0x34, 0x0d, 0x0a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x37, 0x36, 0x38, 0x0d, 0x0a, 0x46,
-  0x75, 0x6c, 0x6c, 0x53, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x30, 0x0d, 0x0a, 0x42, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x6c, 0x65, 0x73,
-  0x73, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x30, 0x0d,
-  0x0a, 0x53, 0x75, 0x70, 0x65, 0x72, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x69,
-  0x6e, 0x67, 0x20, 0x3d, 0x20, 0x31, 0x0d, 0x0a, 0x43, 0x52, 0x54, 0x63,
-  0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x55,
-  0x70, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x3d,
-  0x20, 0x32, 0x0d, 0x0a, 0x57, 0x69, 0x64, 0x65, 0x53, 0x63, 0x72, 0x65,
-  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x53, 0x74, 0x72, 0x65,
-  0x74, 0x63, 0x68, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x57, 0x69, 0x64,
-  0x65, 0x42, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
-  0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x56, 0x53, 0x79, 0x6e, 0x63, 0x20, 0x3d,
-  0x20, 0x31, 0x0d, 0x0a, 0x54, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65,
-  0x20, 0x3d, 0x20, 0x31, 0x0d, 0x0a, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73,
-  0x68, 0x52, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x0d, 0x0a,
-  0x53, 0x68, 0x6f, 0x77, 0x46, 0x72, 0x61, 0x6d, 0x65, 0x52, 0x61, 0x74,
-  0x65, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x43, 0x72, 0x6f, 0x73, 0x73,
-  0x68, 0x61, 0x69, 0x72, 0x73, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x43,
-  0x72, 0x6f, 0x73, 0x73, 0x68, 0x61, 0x69, 0x72, 0x53, 0x74, 0x79, 0x6c,
-  0x65, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x0d, 0x0a,
-  0x4e, 0x6f, 0x57, 0x68, 0x69, 0x74, 0x65, 0x46, 0x6c, 0x61, 0x73, 0x68,
-  0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x46, 0x6c, 0x69, 0x70, 0x53, 0x74,
-  0x65, 0x72, 0x65, 0x6f, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x3b, 0x20, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74,
-  0x69, 0x6e, 0x67, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53,
-  0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x6c, 0x69, 0x62, 0x72,
-  0x65, 0x74, 0x72, 0x6f, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x44,
-  0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x53, 0x65, 0x6e, 0x73, 0x69, 0x74,
-  0x69, 0x76, 0x69, 0x74, 0x79, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c,
-  0x44, 0x65, 0x63, 0x61, 0x79, 0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3d,
-  0x20, 0x35, 0x30, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x6f,
-  0x75, 0x73, 0x65, 0x58, 0x44, 0x65, 0x61, 0x64, 0x5a, 0x6f, 0x6e, 0x65,
-  0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d,
-  0x6f, 0x75, 0x73, 0x65, 0x59, 0x44, 0x65, 0x61, 0x64, 0x5a, 0x6f, 0x6e,
-  0x65, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x4d, 0x6f, 0x75, 0x73, 0x65, 0x5a, 0x44, 0x65, 0x61, 0x64, 0x5a, 0x6f,
-  0x6e, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x3b, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x53, 0x74, 0x61, 0x72, 0x74, 0x31, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x31, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
-  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x39, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x53, 0x74, 0x61, 0x72, 0x74, 0x32, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x32, 0x2c, 0x4a, 0x4f, 0x59, 0x32,
-  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x39, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x43, 0x6f, 0x69, 0x6e, 0x31, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x33, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x43, 0x6f, 0x69, 0x6e, 0x32, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x34, 0x2c, 0x4a, 0x4f, 0x59, 0x32, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x41,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x35, 0x2c, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x31, 0x22,
-  0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65,
-  0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x35, 0x20, 0x74, 0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x32, 0x31, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x65, 0x72,
-  0x76, 0x69, 0x63, 0x65, 0x42, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x37, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x32, 0x33, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x43,
-  0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x37, 0x20, 0x74, 0x6f, 0x20, 0x42,
-  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x33, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x54, 0x65, 0x73, 0x74, 0x41, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x36, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55,
-  0x54, 0x54, 0x4f, 0x4e, 0x32, 0x32, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3b, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20,
-  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x36,
-  0x20, 0x74, 0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x32,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x65, 0x73, 0x74, 0x42,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x38, 0x2c, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x34, 0x22,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x43, 0x68, 0x61,
-  0x6e, 0x67, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x42, 0x55,
-  0x54, 0x54, 0x4f, 0x4e, 0x38, 0x20, 0x74, 0x6f, 0x20, 0x42, 0x55, 0x54,
-  0x54, 0x4f, 0x4e, 0x32, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x34,
-  0x2d, 0x77, 0x61, 0x79, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c,
-  0x20, 0x6a, 0x6f, 0x79, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x0d, 0x0a,
-  0x3b, 0x20, 0x57, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x44, 0x2d, 0x50,
-  0x61, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x31, 0x31, 0x2d, 0x31, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61,
-  0x64, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x4f, 0x56, 0x20, 0x55, 0x50, 0x2f,
-  0x44, 0x4f, 0x57, 0x4e, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a,
-  0x6f, 0x79, 0x55, 0x70, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x55, 0x50, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
-  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31,
-  0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79,
-  0x4c, 0x65, 0x66, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x4c, 0x45, 0x46, 0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
-  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54,
+  0x31, 0x30, 0x30, 0x0d, 0x0a, 0x4d, 0x75, 0x73, 0x69, 0x63, 0x52, 0x65,
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x69,
+  0x6e, 0x63, 0x0d, 0x0a, 0x4d, 0x75, 0x73, 0x69, 0x63, 0x43, 0x61, 0x63,
+  0x68, 0x65, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x36, 0x34, 0x0d,
+  0x0a, 0x53, 0x6f, 0x75, 0x6e, 0x64, 0x46, 0x72, 0x65, 0x71, 0x20, 0x3d,
+  0x20, 0x35, 0x37, 0x2e, 0x35, 0x32, 0x34, 0x32, 0x0d, 0x0a, 0x4c, 0x65,
+  0x67, 0x61, 0x63, 0x79, 0x53, 0x6f, 0x75, 0x6e, 0x64, 0x44, 0x53, 0x50,
+  0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42, 0x61, 0x6c, 0x61, 0x6e, 0x63,
+  0x65, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42, 0x61, 0x6c, 0x61, 0x6e,
+  0x63, 0x65, 0x4c, 0x65, 0x66, 0x74, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20,
+  0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42, 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65,
+  0x46, 0x72, 0x6f, 0x6e, 0x74, 0x52, 0x65, 0x61, 0x72, 0x20, 0x3d, 0x20,
+  0x30, 0x0d, 0x0a, 0x4e, 0x62, 0x53, 0x6f, 0x75, 0x6e, 0x64, 0x43, 0x68,
+  0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x20, 0x3d, 0x20, 0x34, 0x0d, 0x0a,
+  0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x2f, 0x44, 0x69,
+  0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x73, 0x0d, 0x0a, 0x4e, 0x65, 0x77, 0x33, 0x44, 0x45, 0x6e, 0x67,
+  0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x0d, 0x0a, 0x51, 0x75, 0x61,
+  0x64, 0x52, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x3d,
+  0x20, 0x30, 0x0d, 0x0a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x31, 0x39, 0x32, 0x34, 0x0d, 0x0a,
+  0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x3d, 0x20, 0x37, 0x36, 0x38, 0x0d, 0x0a, 0x46, 0x75, 0x6c, 0x6c, 0x53,
+  0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x42,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x6c, 0x65, 0x73, 0x73, 0x57, 0x69, 0x6e,
+  0x64, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x53, 0x75, 0x70,
+  0x65, 0x72, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x3d,
+  0x20, 0x31, 0x0d, 0x0a, 0x43, 0x52, 0x54, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x73, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x55, 0x70, 0x73, 0x63, 0x61,
+  0x6c, 0x65, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x32, 0x0d, 0x0a,
+  0x57, 0x69, 0x64, 0x65, 0x53, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x3d,
+  0x20, 0x30, 0x0d, 0x0a, 0x53, 0x74, 0x72, 0x65, 0x74, 0x63, 0x68, 0x20,
+  0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x57, 0x69, 0x64, 0x65, 0x42, 0x61, 0x63,
+  0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x30, 0x0d,
+  0x0a, 0x56, 0x53, 0x79, 0x6e, 0x63, 0x20, 0x3d, 0x20, 0x31, 0x0d, 0x0a,
+  0x54, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x31,
+  0x0d, 0x0a, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x52, 0x61, 0x74,
+  0x65, 0x20, 0x3d, 0x20, 0x36, 0x30, 0x0d, 0x0a, 0x53, 0x68, 0x6f, 0x77,
+  0x46, 0x72, 0x61, 0x6d, 0x65, 0x52, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20,
+  0x30, 0x0d, 0x0a, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x68, 0x61, 0x69, 0x72,
+  0x73, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x43, 0x72, 0x6f, 0x73, 0x73,
+  0x68, 0x61, 0x69, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20,
+  0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x0d, 0x0a, 0x4e, 0x6f, 0x57, 0x68,
+  0x69, 0x74, 0x65, 0x46, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x3d, 0x20, 0x30,
+  0x0d, 0x0a, 0x46, 0x6c, 0x69, 0x70, 0x53, 0x74, 0x65, 0x72, 0x65, 0x6f,
+  0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x79, 0x73, 0x74, 0x65,
+  0x6d, 0x20, 0x3d, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x65, 0x74, 0x72, 0x6f,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x44, 0x69, 0x67, 0x69, 0x74,
+  0x61, 0x6c, 0x53, 0x65, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x76, 0x69, 0x74,
+  0x79, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x44, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x44, 0x65, 0x63, 0x61,
+  0x79, 0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x35, 0x30, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x58,
+  0x44, 0x65, 0x61, 0x64, 0x5a, 0x6f, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x30,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x6f, 0x75, 0x73, 0x65,
+  0x59, 0x44, 0x65, 0x61, 0x64, 0x5a, 0x6f, 0x6e, 0x65, 0x20, 0x3d, 0x20,
+  0x30, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x6f, 0x75, 0x73,
+  0x65, 0x5a, 0x44, 0x65, 0x61, 0x64, 0x5a, 0x6f, 0x6e, 0x65, 0x20, 0x3d,
+  0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x43, 0x6f,
+  0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x53, 0x74, 0x61, 0x72, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x31, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
+  0x54, 0x4f, 0x4e, 0x39, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x53, 0x74, 0x61, 0x72, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x32, 0x2c, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54,
+  0x54, 0x4f, 0x4e, 0x39, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x43, 0x6f, 0x69, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x33, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x43, 0x6f, 0x69, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x34, 0x2c, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x41, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x35, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
+  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x31, 0x22, 0x20, 0x20, 0x20, 0x20,
+  0x3b, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x35, 0x20, 0x74,
+  0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x31, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65,
+  0x42, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x37, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x33,
+  0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x37, 0x20, 0x74, 0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x32, 0x33, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x65,
+  0x73, 0x74, 0x41, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x36,
   0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x31, 0x34, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x50, 0x6c, 0x61,
-  0x79, 0x65, 0x72, 0x20, 0x32, 0x20, 0x28, 0x69, 0x66, 0x20, 0x6e, 0x65,
-  0x65, 0x64, 0x65, 0x64, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x4a, 0x6f, 0x79, 0x55, 0x70, 0x32, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
-  0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x31, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f,
-  0x79, 0x44, 0x6f, 0x77, 0x6e, 0x32, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4a,
-  0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x32,
-  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x4c,
-  0x65, 0x66, 0x74, 0x32, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59,
-  0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x33, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x52, 0x69, 0x67,
-  0x68, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x34, 0x22, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x3b, 0x20, 0x46, 0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67, 0x20,
-  0x67, 0x61, 0x6d, 0x65, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x50, 0x75, 0x6e, 0x63, 0x68,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4b, 0x69, 0x63, 0x6b, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
-  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x61, 0x72, 0x64, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x50, 0x75, 0x6e, 0x63, 0x68, 0x32, 0x20, 0x3d, 0x20,
-  0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4b, 0x69, 0x63,
-  0x6b, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42,
-  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x47, 0x75, 0x61, 0x72, 0x64, 0x32, 0x20, 0x3d, 0x20, 0x22,
-  0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33,
-  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x45, 0x73, 0x63, 0x61,
-  0x70, 0x65, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x3b, 0x20, 0x53, 0x70, 0x69, 0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x62,
-  0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x53, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
-  0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x42, 0x65, 0x61, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x43, 0x68,
-  0x61, 0x72, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x75,
-  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x2c,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x34,
-  0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69, 0x72, 0x74, 0x75,
-  0x61, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6b, 0x65, 0x72, 0x20, 0x62, 0x75,
-  0x74, 0x74, 0x6f, 0x6e, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x53, 0x68, 0x6f, 0x72, 0x74, 0x50, 0x61, 0x73, 0x73, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x4c, 0x6f, 0x6e, 0x67, 0x50, 0x61, 0x73, 0x73, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59,
-  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x68, 0x6f, 0x6f, 0x74, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
-  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x53, 0x68, 0x6f, 0x72, 0x74, 0x50, 0x61, 0x73,
-  0x73, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42,
+  0x32, 0x32, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20,
+  0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x36, 0x20, 0x74, 0x6f, 0x20,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x32, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x54, 0x65, 0x73, 0x74, 0x42, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x38, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
+  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x34, 0x22, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3b, 0x20, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
+  0x38, 0x20, 0x74, 0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32,
+  0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x34, 0x2d, 0x77, 0x61, 0x79,
+  0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6a, 0x6f, 0x79,
+  0x73, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x0d, 0x0a, 0x3b, 0x20, 0x57, 0x65,
+  0x20, 0x6d, 0x61, 0x70, 0x20, 0x44, 0x2d, 0x50, 0x61, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x31, 0x2d, 0x31,
+  0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66,
+  0x20, 0x50, 0x4f, 0x56, 0x20, 0x55, 0x50, 0x2f, 0x44, 0x4f, 0x57, 0x4e,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x55, 0x70,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55,
+  0x50, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x31, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a,
+  0x6f, 0x79, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x32, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x4c, 0x65, 0x66, 0x74,
+  0x20, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46,
+  0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x31, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a,
+  0x6f, 0x79, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x2c, 0x4a, 0x4f, 0x59,
+  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x34, 0x22, 0x0d,
+  0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x50, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20,
+  0x32, 0x20, 0x28, 0x69, 0x66, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64,
+  0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x55,
+  0x70, 0x32, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59,
+  0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x31, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x44, 0x6f, 0x77,
+  0x6e, 0x32, 0x20, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x4a, 0x6f, 0x79, 0x4c, 0x65, 0x66, 0x74, 0x32,
+  0x20, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55,
+  0x54, 0x54, 0x4f, 0x4e, 0x31, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x4a, 0x6f, 0x79, 0x52, 0x69, 0x67, 0x68, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x34, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x46,
+  0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x61, 0x6d, 0x65,
+  0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x50, 0x75, 0x6e, 0x63, 0x68, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
   0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x4c, 0x6f, 0x6e, 0x67, 0x50, 0x61, 0x73, 0x73, 0x32, 0x20,
+  0x75, 0x74, 0x4b, 0x69, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
+  0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x47, 0x75, 0x61, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x45,
+  0x73, 0x63, 0x61, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x46, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x50,
+  0x75, 0x6e, 0x63, 0x68, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59,
+  0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x4b, 0x69, 0x63, 0x6b, 0x32, 0x20, 0x3d,
+  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75,
+  0x61, 0x72, 0x64, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x32, 0x20,
   0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53,
-  0x68, 0x6f, 0x6f, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59,
-  0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a,
-  0x0d, 0x0a, 0x3b, 0x20, 0x53, 0x74, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67,
-  0x20, 0x77, 0x68, 0x65, 0x65, 0x6c, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x53, 0x74, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x4c, 0x65, 0x66,
-  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46,
-  0x54, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69,
+  0x4f, 0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x53, 0x70,
+  0x69, 0x6b, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f,
+  0x6e, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x68, 0x69,
+  0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c,
+  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x42, 0x65, 0x61, 0x74,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f,
+  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x43, 0x68, 0x61, 0x72, 0x67, 0x65,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x2c, 0x4a, 0x4f,
+  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4a, 0x75, 0x6d, 0x70, 0x20, 0x3d,
+  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x0d,
+  0x0a, 0x3b, 0x20, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x20, 0x53, 0x74,
+  0x72, 0x69, 0x6b, 0x65, 0x72, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+  0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x68, 0x6f, 0x72,
+  0x74, 0x50, 0x61, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4c,
+  0x6f, 0x6e, 0x67, 0x50, 0x61, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55,
+  0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x53, 0x68, 0x6f, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
+  0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x53, 0x68, 0x6f, 0x72, 0x74, 0x50, 0x61, 0x73, 0x73, 0x32, 0x20, 0x3d,
+  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4c, 0x6f,
+  0x6e, 0x67, 0x50, 0x61, 0x73, 0x73, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a,
+  0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x68, 0x6f, 0x6f, 0x74,
+  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55,
+  0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20,
+  0x53, 0x74, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x68, 0x65,
+  0x65, 0x6c, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x74, 0x65,
+  0x65, 0x72, 0x69, 0x6e, 0x67, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x22, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61,
+  0x6c, 0x2c, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x77, 0x68, 0x65, 0x65,
+  0x6c, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x53, 0x74, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x52, 0x69, 0x67,
+  0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49,
+  0x47, 0x48, 0x54, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69,
   0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x20,
-  0x77, 0x68, 0x65, 0x65, 0x6c, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x74, 0x65, 0x65, 0x72, 0x69, 0x6e,
-  0x67, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x22, 0x20, 0x20, 0x20, 0x20,
-  0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x74,
-  0x75, 0x72, 0x6e, 0x20, 0x77, 0x68, 0x65, 0x65, 0x6c, 0x20, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x74,
-  0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f,
-  0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x73, 0x74, 0x65, 0x65,
-  0x72, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x0d, 0x0a,
-  0x0d, 0x0a, 0x3b, 0x20, 0x50, 0x65, 0x64, 0x61, 0x6c, 0x73, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x63, 0x63, 0x65, 0x6c, 0x65, 0x72,
-  0x61, 0x74, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x55, 0x50, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x55, 0x50, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x42, 0x72, 0x61, 0x6b, 0x65, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a,
-  0x0d, 0x0a, 0x3b, 0x20, 0x55, 0x70, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x20,
-  0x73, 0x68, 0x69, 0x66, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x61, 0x6e, 0x75,
-  0x61, 0x6c, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x73, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x28, 0x61, 0x6c, 0x6c, 0x20, 0x72, 0x61, 0x63,
-  0x65, 0x72, 0x73, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
-  0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74, 0x55, 0x70, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x59, 0x22, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x73, 0x65, 0x71,
-  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x69, 0x66,
-  0x74, 0x20, 0x75, 0x70, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
-  0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74, 0x44, 0x6f, 0x77, 0x6e,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x48, 0x22, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x73, 0x65, 0x71,
-  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x69, 0x66,
-  0x74, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20,
-  0x34, 0x2d, 0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x6d, 0x61, 0x6e, 0x75,
-  0x61, 0x6c, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x73, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x28, 0x44, 0x61, 0x79, 0x74, 0x6f, 0x6e, 0x61,
-  0x20, 0x32, 0x2c, 0x20, 0x53, 0x65, 0x67, 0x61, 0x20, 0x52, 0x61, 0x6c,
-  0x6c, 0x79, 0x20, 0x32, 0x2c, 0x20, 0x53, 0x63, 0x75, 0x64, 0x20, 0x52,
-  0x61, 0x63, 0x65, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
-  0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74, 0x31, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x51, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x35, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x47, 0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x2c, 0x4a,
-  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x36, 0x22,
+  0x77, 0x68, 0x65, 0x65, 0x6c, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x74, 0x65, 0x65, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x58,
+  0x41, 0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66,
+  0x75, 0x6c, 0x6c, 0x20, 0x73, 0x74, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67,
+  0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20,
+  0x50, 0x65, 0x64, 0x61, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x41, 0x63, 0x63, 0x65, 0x6c, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x42, 0x72, 0x61, 0x6b, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20,
+  0x55, 0x70, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x73, 0x68, 0x69, 0x66,
+  0x74, 0x65, 0x72, 0x20, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x20, 0x74,
+  0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+  0x28, 0x61, 0x6c, 0x6c, 0x20, 0x72, 0x61, 0x63, 0x65, 0x72, 0x73, 0x29,
   0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x65, 0x61, 0x72, 0x53,
-  0x68, 0x69, 0x66, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x45, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x37, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
-  0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74, 0x34, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x38, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x68, 0x69, 0x66, 0x74, 0x55, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x59, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x69, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x75, 0x70,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x65, 0x61, 0x72, 0x53,
+  0x68, 0x69, 0x66, 0x74, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x48, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x69, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x64, 0x6f,
+  0x77, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x34, 0x2d, 0x53, 0x70,
+  0x65, 0x65, 0x64, 0x20, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x20, 0x74,
+  0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+  0x28, 0x44, 0x61, 0x79, 0x74, 0x6f, 0x6e, 0x61, 0x20, 0x32, 0x2c, 0x20,
+  0x53, 0x65, 0x67, 0x61, 0x20, 0x52, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x32,
+  0x2c, 0x20, 0x53, 0x63, 0x75, 0x64, 0x20, 0x52, 0x61, 0x63, 0x65, 0x29,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x65, 0x61, 0x72, 0x53,
+  0x68, 0x69, 0x66, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x51, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x35, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
+  0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x36, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
   0x70, 0x75, 0x74, 0x47, 0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74,
-  0x4e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x54, 0x22, 0x0d,
-  0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x52, 0x34, 0x20, 0x76, 0x69, 0x65,
-  0x77, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x62, 0x75, 0x74,
-  0x74, 0x6f, 0x6e, 0x73, 0x20, 0x28, 0x44, 0x61, 0x79, 0x74, 0x6f, 0x6e,
-  0x61, 0x20, 0x32, 0x2c, 0x20, 0x4c, 0x65, 0x20, 0x4d, 0x61, 0x6e, 0x73,
-  0x20, 0x32, 0x34, 0x2c, 0x20, 0x53, 0x63, 0x75, 0x64, 0x20, 0x52, 0x61,
-  0x63, 0x65, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x52,
-  0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a,
-  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x52, 0x32, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
-  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x56, 0x52, 0x33, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55,
-  0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x56, 0x52, 0x34, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x46, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x53, 0x69, 0x6e,
-  0x67, 0x6c, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x63, 0x68, 0x61,
-  0x6e, 0x67, 0x65, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x28,
-  0x44, 0x69, 0x72, 0x74, 0x20, 0x44, 0x65, 0x76, 0x69, 0x6c, 0x73, 0x2c,
-  0x20, 0x45, 0x43, 0x41, 0x2c, 0x20, 0x48, 0x61, 0x72, 0x6c, 0x65, 0x79,
-  0x2d, 0x44, 0x61, 0x76, 0x69, 0x64, 0x73, 0x6f, 0x6e, 0x2c, 0x20, 0x53,
-  0x65, 0x67, 0x61, 0x20, 0x52, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x32, 0x29,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x69, 0x65, 0x77, 0x43,
-  0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x48, 0x61,
-  0x6e, 0x64, 0x62, 0x72, 0x61, 0x6b, 0x65, 0x20, 0x28, 0x44, 0x69, 0x72,
-  0x74, 0x20, 0x44, 0x65, 0x76, 0x69, 0x6c, 0x73, 0x2c, 0x20, 0x53, 0x65,
-  0x67, 0x61, 0x20, 0x52, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x32, 0x29, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x48, 0x61, 0x6e, 0x64, 0x42, 0x72,
-  0x61, 0x6b, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53,
+  0x33, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x37, 0x22,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x65, 0x61, 0x72, 0x53,
+  0x68, 0x69, 0x66, 0x74, 0x34, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x52, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x38, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
+  0x65, 0x61, 0x72, 0x53, 0x68, 0x69, 0x66, 0x74, 0x4e, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x54, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b,
+  0x20, 0x56, 0x52, 0x34, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73,
+  0x20, 0x28, 0x44, 0x61, 0x79, 0x74, 0x6f, 0x6e, 0x61, 0x20, 0x32, 0x2c,
+  0x20, 0x4c, 0x65, 0x20, 0x4d, 0x61, 0x6e, 0x73, 0x20, 0x32, 0x34, 0x2c,
+  0x20, 0x53, 0x63, 0x75, 0x64, 0x20, 0x52, 0x61, 0x63, 0x65, 0x29, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x52, 0x31, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x56, 0x52, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
+  0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x56, 0x52, 0x33, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44,
   0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x32, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x48, 0x61, 0x72, 0x6c,
-  0x65, 0x79, 0x2d, 0x44, 0x61, 0x76, 0x69, 0x64, 0x73, 0x6f, 0x6e, 0x20,
-  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x52, 0x65, 0x61, 0x72, 0x42, 0x72, 0x61, 0x6b, 0x65,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x75, 0x73, 0x69, 0x63, 0x53,
-  0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69,
-  0x72, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x4f, 0x6e, 0x20, 0x6d, 0x61, 0x63,
-  0x72, 0x6f, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77,
-  0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x54, 0x75, 0x72, 0x6e, 0x4c, 0x65, 0x66,
-  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x51, 0x2c, 0x4a,
-  0x4f, 0x59, 0x31, 0x5f, 0x52, 0x58, 0x41, 0x58, 0x49, 0x53, 0x5f, 0x4e,
-  0x45, 0x47, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77,
-  0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x54, 0x75, 0x72, 0x6e, 0x52, 0x69, 0x67,
-  0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x2c,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x52, 0x58, 0x41, 0x58, 0x49, 0x53, 0x5f,
-  0x50, 0x4f, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54,
-  0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x46, 0x6f, 0x72, 0x77, 0x61, 0x72,
-  0x64, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22,
+  0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x56, 0x52, 0x34,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x46, 0x2c, 0x4a, 0x4f,
+  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x34, 0x22, 0x0d,
+  0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x53, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20,
+  0x76, 0x69, 0x65, 0x77, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x28, 0x44, 0x69, 0x72, 0x74,
+  0x20, 0x44, 0x65, 0x76, 0x69, 0x6c, 0x73, 0x2c, 0x20, 0x45, 0x43, 0x41,
+  0x2c, 0x20, 0x48, 0x61, 0x72, 0x6c, 0x65, 0x79, 0x2d, 0x44, 0x61, 0x76,
+  0x69, 0x64, 0x73, 0x6f, 0x6e, 0x2c, 0x20, 0x53, 0x65, 0x67, 0x61, 0x20,
+  0x52, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x32, 0x29, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x56, 0x69, 0x65, 0x77, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22,
+  0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x48, 0x61, 0x6e, 0x64, 0x62, 0x72,
+  0x61, 0x6b, 0x65, 0x20, 0x28, 0x44, 0x69, 0x72, 0x74, 0x20, 0x44, 0x65,
+  0x76, 0x69, 0x6c, 0x73, 0x2c, 0x20, 0x53, 0x65, 0x67, 0x61, 0x20, 0x52,
+  0x61, 0x6c, 0x6c, 0x79, 0x20, 0x32, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x48, 0x61, 0x6e, 0x64, 0x42, 0x72, 0x61, 0x6b, 0x65, 0x20,
+  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59,
+  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a,
+  0x0d, 0x0a, 0x3b, 0x20, 0x48, 0x61, 0x72, 0x6c, 0x65, 0x79, 0x2d, 0x44,
+  0x61, 0x76, 0x69, 0x64, 0x73, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x72, 0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x52,
+  0x65, 0x61, 0x72, 0x42, 0x72, 0x61, 0x6b, 0x65, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
+  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x4d, 0x75, 0x73, 0x69, 0x63, 0x53, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22,
+  0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61,
+  0x6c, 0x20, 0x4f, 0x6e, 0x20, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x73, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f,
+  0x79, 0x54, 0x75, 0x72, 0x6e, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x51, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
+  0x52, 0x58, 0x41, 0x58, 0x49, 0x53, 0x5f, 0x4e, 0x45, 0x47, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f,
+  0x79, 0x54, 0x75, 0x72, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d,
+  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x52, 0x58, 0x41, 0x58, 0x49, 0x53, 0x5f, 0x50, 0x4f, 0x53, 0x22,
   0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a,
-  0x6f, 0x79, 0x52, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x32, 0x22,
+  0x6f, 0x79, 0x46, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x52, 0x65,
+  0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
+  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x53, 0x74,
+  0x72, 0x61, 0x66, 0x65, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x2c, 0x4a, 0x4f, 0x59,
+  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x33, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f,
+  0x79, 0x53, 0x74, 0x72, 0x61, 0x66, 0x65, 0x52, 0x69, 0x67, 0x68, 0x74,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48,
+  0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x31, 0x34, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54,
+  0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x4a, 0x75, 0x6d, 0x70, 0x20, 0x3d,
+  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x43,
+  0x72, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x52, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69,
+  0x72, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x4f, 0x6e, 0x20, 0x69, 0x6e, 0x64,
+  0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x6a, 0x6f, 0x79, 0x73,
+  0x74, 0x69, 0x63, 0x6b, 0x20, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67,
   0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a,
-  0x6f, 0x79, 0x53, 0x74, 0x72, 0x61, 0x66, 0x65, 0x4c, 0x65, 0x66, 0x74,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54,
-  0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x31, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77,
-  0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x53, 0x74, 0x72, 0x61, 0x66, 0x65, 0x52,
-  0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x52, 0x49, 0x47, 0x48, 0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
-  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x34, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x4a, 0x75,
-  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x2c,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31,
+  0x6f, 0x79, 0x4c, 0x65, 0x66, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4e,
+  0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54,
+  0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x4c, 0x65, 0x66, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x52, 0x69,
+  0x67, 0x68, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45,
   0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e,
-  0x4a, 0x6f, 0x79, 0x43, 0x72, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x3b, 0x20, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x4f, 0x6e,
-  0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20,
-  0x6a, 0x6f, 0x79, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x20, 0x6d, 0x61, 0x70,
-  0x70, 0x69, 0x6e, 0x67, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54,
-  0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x4c, 0x65, 0x66, 0x74, 0x31, 0x20,
+  0x4a, 0x6f, 0x79, 0x52, 0x69, 0x67, 0x68, 0x74, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x55, 0x70, 0x31, 0x20,
   0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x4c, 0x65,
-  0x66, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a,
-  0x6f, 0x79, 0x52, 0x69, 0x67, 0x68, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x22,
-  0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x52, 0x69, 0x67, 0x68, 0x74,
+  0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x55, 0x70,
   0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a,
   0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79,
-  0x55, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a,
-  0x6f, 0x79, 0x55, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e,
+  0x44, 0x6f, 0x77, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e,
   0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69,
-  0x6e, 0x4a, 0x6f, 0x79, 0x44, 0x6f, 0x77, 0x6e, 0x31, 0x20, 0x3d, 0x20,
-  0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x44, 0x6f, 0x77, 0x6e,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a,
-  0x0d, 0x0a, 0x3b, 0x20, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x20,
-  0x4f, 0x6e, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79,
-  0x53, 0x68, 0x6f, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x35, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54,
-  0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x53, 0x68, 0x6f, 0x74, 0x32, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59,
-  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x36, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79,
-  0x54, 0x75, 0x72, 0x62, 0x6f, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x5a, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
-  0x54, 0x4f, 0x4e, 0x37, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x54, 0x75, 0x72, 0x62, 0x6f,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x58, 0x2c, 0x4a,
-  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x38, 0x22,
-  0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
-  0x20, 0x6a, 0x6f, 0x79, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x20, 0x28, 0x53,
-  0x74, 0x61, 0x72, 0x20, 0x57, 0x61, 0x72, 0x73, 0x20, 0x54, 0x72, 0x69,
-  0x6c, 0x6f, 0x67, 0x79, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x55, 0x70, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a,
+  0x6e, 0x4a, 0x6f, 0x79, 0x44, 0x6f, 0x77, 0x6e, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20,
+  0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x4f, 0x6e, 0x20, 0x62,
+  0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x53, 0x68, 0x6f, 0x74,
+  0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x35, 0x22,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a,
+  0x6f, 0x79, 0x53, 0x68, 0x6f, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55,
+  0x54, 0x54, 0x4f, 0x4e, 0x36, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x54, 0x77, 0x69, 0x6e, 0x4a, 0x6f, 0x79, 0x54, 0x75, 0x72, 0x62,
+  0x6f, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x5a, 0x2c,
+  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x37,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x77, 0x69, 0x6e,
+  0x4a, 0x6f, 0x79, 0x54, 0x75, 0x72, 0x62, 0x6f, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x58, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x38, 0x22, 0x0d, 0x0a, 0x0d, 0x0a,
+  0x3b, 0x20, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x20, 0x6a, 0x6f, 0x79,
+  0x73, 0x74, 0x69, 0x63, 0x6b, 0x20, 0x28, 0x53, 0x74, 0x61, 0x72, 0x20,
+  0x57, 0x61, 0x72, 0x73, 0x20, 0x54, 0x72, 0x69, 0x6c, 0x6f, 0x67, 0x79,
+  0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c,
+  0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x55, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x44, 0x6f,
+  0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f,
+  0x57, 0x4e, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x4c, 0x65, 0x66,
+  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46,
+  0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
+  0x4e, 0x31, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41,
+  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x52, 0x69, 0x67, 0x68,
+  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47,
+  0x48, 0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x34, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x58, 0x20, 0x3d,
+  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x2c,
+  0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22,
+  0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c,
+  0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x58, 0x20, 0x61, 0x78, 0x69, 0x73,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f,
+  0x67, 0x4a, 0x6f, 0x79, 0x59, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59,
+  0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45,
+  0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x3b, 0x20,
+  0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c,
+  0x20, 0x59, 0x20, 0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x54,
+  0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x4c, 0x45,
+  0x46, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22, 0x0d, 0x0a,
   0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a,
-  0x6f, 0x79, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f,
-  0x79, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x4c, 0x45, 0x46, 0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42,
-  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79,
-  0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x34, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f,
-  0x79, 0x58, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x5f, 0x58, 0x41,
-  0x58, 0x49, 0x53, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x58, 0x41,
-  0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61,
-  0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x58, 0x20,
-  0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41,
-  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x59, 0x20, 0x3d, 0x20,
-  0x22, 0x4a, 0x4f, 0x59, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x2c, 0x4d,
-  0x4f, 0x55, 0x53, 0x45, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x20,
-  0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c, 0x20,
-  0x66, 0x75, 0x6c, 0x6c, 0x20, 0x59, 0x20, 0x61, 0x78, 0x69, 0x73, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
-  0x4a, 0x6f, 0x79, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x2c, 0x4d, 0x4f, 0x55, 0x53,
-  0x45, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61,
-  0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59,
-  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x2c, 0x4d, 0x4f, 0x55,
-  0x53, 0x45, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5f, 0x42, 0x55, 0x54,
-  0x54, 0x4f, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41,
-  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x54, 0x72, 0x69, 0x67,
-  0x67, 0x65, 0x72, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x44, 0x2c, 0x4a, 0x4f, 0x59, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61,
-  0x6c, 0x6f, 0x67, 0x4a, 0x6f, 0x79, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x32,
-  0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x0d,
-  0x0a, 0x3b, 0x20, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x67, 0x75, 0x6e,
-  0x73, 0x20, 0x28, 0x4c, 0x6f, 0x73, 0x74, 0x20, 0x57, 0x6f, 0x72, 0x6c,
-  0x64, 0x29, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e,
+  0x6f, 0x79, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x5f, 0x42, 0x55, 0x54,
+  0x54, 0x4f, 0x4e, 0x32, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x52,
+  0x49, 0x47, 0x48, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f,
+  0x67, 0x4a, 0x6f, 0x79, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x32,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x2c, 0x4a, 0x4f,
+  0x59, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x4a,
+  0x6f, 0x79, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22,
+  0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x4c,
+  0x69, 0x67, 0x68, 0x74, 0x20, 0x67, 0x75, 0x6e, 0x73, 0x20, 0x28, 0x4c,
+  0x6f, 0x73, 0x74, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x29, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x4c, 0x65, 0x66, 0x74,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54,
+  0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61,
+  0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20,
+  0x6c, 0x65, 0x66, 0x74, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
+  0x75, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x22, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20,
+  0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x55, 0x70, 0x20,
+  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+  0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e,
+  0x20, 0x75, 0x70, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75,
+  0x6e, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64,
+  0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x67, 0x75, 0x6e, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x58, 0x20, 0x3d, 0x20, 0x22,
+  0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x2c,
+  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22, 0x20,
+  0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c,
+  0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x58, 0x20, 0x61, 0x78, 0x69, 0x73,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x59, 0x20,
+  0x3d, 0x20, 0x22, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x59, 0x41, 0x58,
+  0x49, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x59, 0x41, 0x58, 0x49,
+  0x53, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c,
+  0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x59, 0x20, 0x61,
+  0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x72,
+  0x69, 0x67, 0x67, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x31, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x4c, 0x45,
+  0x46, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x63, 0x72, 0x65,
+  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c,
+  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32,
+  0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22, 0x20, 0x20, 0x20, 0x20,
+  0x3b, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x66, 0x2d,
+  0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x41, 0x75, 0x74, 0x6f, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72,
+  0x20, 0x3d, 0x20, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3b, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x20,
+  0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x6f, 0x66, 0x66, 0x2d, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x4c, 0x65, 0x66, 0x74,
+  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x52, 0x69, 0x67, 0x68,
+  0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x55, 0x70, 0x32,
+  0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x44, 0x6f, 0x77, 0x6e, 0x32,
+  0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x58, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x59, 0x32,
+  0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x59, 0x41, 0x58,
+  0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x72,
+  0x69, 0x67, 0x67, 0x65, 0x72, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f,
+  0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x63, 0x72,
+  0x65, 0x65, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x41, 0x75, 0x74, 0x6f, 0x54, 0x72, 0x69, 0x67,
+  0x67, 0x65, 0x72, 0x32, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a,
+  0x3b, 0x20, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x20, 0x67, 0x75, 0x6e,
+  0x73, 0x20, 0x28, 0x4f, 0x63, 0x65, 0x61, 0x6e, 0x20, 0x48, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x2c, 0x20, 0x4c, 0x41, 0x20, 0x4d, 0x61, 0x63, 0x68,
+  0x69, 0x6e, 0x65, 0x67, 0x75, 0x6e, 0x73, 0x29, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e,
   0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
   0x4c, 0x45, 0x46, 0x54, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69,
   0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
   0x67, 0x75, 0x6e, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54,
-  0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75,
+  0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e,
+  0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69,
+  0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x67, 0x75, 0x6e, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75,
   0x6e, 0x55, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55,
   0x50, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64,
   0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65,
   0x20, 0x67, 0x75, 0x6e, 0x20, 0x75, 0x70, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x47, 0x75, 0x6e, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x64, 0x6f, 0x77,
-  0x6e, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x58,
+  0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x44,
+  0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44,
+  0x4f, 0x57, 0x4e, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x64, 0x69, 0x67,
+  0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x67,
+  0x75, 0x6e, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x58,
   0x20, 0x3d, 0x20, 0x22, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x58, 0x41,
   0x58, 0x49, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x58, 0x41, 0x58,
   0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61,
   0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x58, 0x20,
-  0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
-  0x75, 0x6e, 0x59, 0x20, 0x3d, 0x20, 0x22, 0x4d, 0x4f, 0x55, 0x53, 0x45,
-  0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20,
-  0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c,
-  0x20, 0x59, 0x20, 0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x2c, 0x4d, 0x4f, 0x55, 0x53,
-  0x45, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x66,
-  0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
-  0x54, 0x4f, 0x4e, 0x32, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x52,
-  0x49, 0x47, 0x48, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22,
-  0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20,
-  0x6f, 0x66, 0x66, 0x2d, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x75, 0x74, 0x6f, 0x54, 0x72, 0x69,
-  0x67, 0x67, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x30, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61,
-  0x74, 0x69, 0x63, 0x20, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x77,
-  0x68, 0x65, 0x6e, 0x20, 0x6f, 0x66, 0x66, 0x2d, 0x73, 0x63, 0x72, 0x65,
-  0x65, 0x6e, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e,
-  0x4c, 0x65, 0x66, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e,
-  0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e,
-  0x52, 0x69, 0x67, 0x68, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f,
-  0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75,
-  0x6e, 0x55, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45,
-  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x44,
-  0x6f, 0x77, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45,
-  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47, 0x75, 0x6e, 0x58,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x58, 0x41,
-  0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x47,
-  0x75, 0x6e, 0x59, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32,
-  0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x32, 0x20, 0x3d,
-  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f,
-  0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66,
-  0x66, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22,
-  0x4a, 0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32,
-  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x75, 0x74, 0x6f,
-  0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x32, 0x20, 0x3d, 0x20, 0x30,
-  0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
-  0x20, 0x67, 0x75, 0x6e, 0x73, 0x20, 0x28, 0x4f, 0x63, 0x65, 0x61, 0x6e,
-  0x20, 0x48, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x4c, 0x41, 0x20,
-  0x4d, 0x61, 0x63, 0x68, 0x69, 0x6e, 0x65, 0x67, 0x75, 0x6e, 0x73, 0x29,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f,
-  0x67, 0x47, 0x75, 0x6e, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22,
-  0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x22, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x6c, 0x65, 0x66, 0x74,
+  0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41,
+  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x59, 0x20, 0x3d, 0x20,
+  0x22, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53,
+  0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22,
+  0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
+  0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x59, 0x20, 0x61, 0x78, 0x69,
+  0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c,
+  0x6f, 0x67, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x4c, 0x65, 0x66,
+  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x2c,
+  0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x5f, 0x42,
+  0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54, 0x72, 0x69, 0x67, 0x67,
+  0x65, 0x72, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b,
+  0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55,
+  0x54, 0x54, 0x4f, 0x4e, 0x32, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f,
+  0x52, 0x49, 0x47, 0x48, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c,
+  0x6f, 0x67, 0x47, 0x75, 0x6e, 0x4c, 0x65, 0x66, 0x74, 0x32, 0x20, 0x3d,
+  0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x52,
+  0x69, 0x67, 0x68, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e,
+  0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61,
+  0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x55, 0x70, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x44, 0x6f,
+  0x77, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22,
   0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f,
-  0x67, 0x47, 0x75, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x22, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c,
-  0x6f, 0x67, 0x47, 0x75, 0x6e, 0x55, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3b, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x75, 0x70, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
-  0x47, 0x75, 0x6e, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b,
-  0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2c, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x67, 0x75, 0x6e, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
-  0x47, 0x75, 0x6e, 0x58, 0x20, 0x3d, 0x20, 0x22, 0x4d, 0x4f, 0x55, 0x53,
-  0x45, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
-  0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b,
-  0x20, 0x61, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c,
-  0x6c, 0x20, 0x58, 0x20, 0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e,
-  0x59, 0x20, 0x3d, 0x20, 0x22, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x59,
-  0x41, 0x58, 0x49, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x59, 0x41,
-  0x58, 0x49, 0x53, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x20, 0x61, 0x6e,
-  0x61, 0x6c, 0x6f, 0x67, 0x2c, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x59,
-  0x20, 0x61, 0x78, 0x69, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65,
-  0x72, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x31, 0x2c, 0x4d, 0x4f, 0x55, 0x53, 0x45, 0x5f, 0x4c, 0x45,
-  0x46, 0x54, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54,
-  0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20,
-  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59,
-  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x2c, 0x4d, 0x4f,
-  0x55, 0x53, 0x45, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x5f, 0x42, 0x55,
-  0x54, 0x54, 0x4f, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x4c, 0x65, 0x66,
-  0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67,
-  0x47, 0x75, 0x6e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x32, 0x20, 0x3d, 0x20,
+  0x67, 0x47, 0x75, 0x6e, 0x58, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f,
+  0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e,
+  0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x59, 0x32, 0x20, 0x3d, 0x20,
   0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x55, 0x70,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47,
-  0x75, 0x6e, 0x44, 0x6f, 0x77, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e,
+  0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54, 0x72, 0x69, 0x67, 0x67,
+  0x65, 0x72, 0x4c, 0x65, 0x66, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e,
   0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x41,
-  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x58, 0x32, 0x20, 0x3d,
-  0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x47, 0x75, 0x6e, 0x59,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54,
-  0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x4c, 0x65, 0x66, 0x74, 0x32, 0x20,
-  0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54, 0x72, 0x69,
-  0x67, 0x67, 0x65, 0x72, 0x52, 0x69, 0x67, 0x68, 0x74, 0x32, 0x20, 0x3d,
-  0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b,
-  0x20, 0x53, 0x6b, 0x69, 0x20, 0x43, 0x68, 0x61, 0x6d, 0x70, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x53, 0x6b, 0x69, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x52, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47,
-  0x48, 0x54, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b,
-  0x69, 0x55, 0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55,
-  0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69,
-  0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x44, 0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x53, 0x6b, 0x69, 0x58, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31,
-  0x5f, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x53, 0x6b, 0x69, 0x59, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x50, 0x6f, 0x6c, 0x6c, 0x4c,
-  0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41,
-  0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
-  0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69,
-  0x50, 0x6f, 0x6c, 0x6c, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72,
+  0x52, 0x69, 0x67, 0x68, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f,
+  0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x53, 0x6b, 0x69,
+  0x20, 0x43, 0x68, 0x61, 0x6d, 0x70, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b,
+  0x69, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x4c, 0x45, 0x46, 0x54, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x53, 0x6b, 0x69, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x22, 0x0d,
+  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x55, 0x70, 0x20,
+  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x44, 0x6f, 0x77, 0x6e,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x58,
+  0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x58, 0x41, 0x58,
+  0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b,
+  0x69, 0x59, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x59,
+  0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x53, 0x6b, 0x69, 0x50, 0x6f, 0x6c, 0x6c, 0x4c, 0x65, 0x66, 0x74, 0x20,
+  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59,
+  0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x50, 0x6f, 0x6c, 0x6c,
+  0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53,
+  0x6b, 0x69, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x31, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x51, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
   0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74,
-  0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x51, 0x2c, 0x4a,
-  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x33, 0x22,
+  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x2c, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x34, 0x22,
   0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53, 0x6b, 0x69, 0x53, 0x65,
-  0x6c, 0x65, 0x63, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
-  0x5f, 0x57, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
-  0x4f, 0x4e, 0x34, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x53,
-  0x6b, 0x69, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x33, 0x20, 0x3d, 0x20,
-  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f,
-  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x35, 0x22, 0x0d, 0x0a, 0x0d, 0x0a,
-  0x3b, 0x20, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x54, 0x72,
-  0x75, 0x63, 0x6b, 0x20, 0x41, 0x64, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x72,
-  0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c,
-  0x4c, 0x65, 0x76, 0x65, 0x72, 0x55, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x22,
-  0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
-  0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65, 0x76,
-  0x65, 0x72, 0x44, 0x6f, 0x77, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65,
-  0x76, 0x65, 0x72, 0x55, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f,
-  0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61,
+  0x6c, 0x65, 0x63, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59,
+  0x5f, 0x45, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54,
+  0x4f, 0x4e, 0x35, 0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x4d, 0x61,
+  0x67, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x54, 0x72, 0x75, 0x63, 0x6b, 0x20,
+  0x41, 0x64, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x65, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65, 0x76, 0x65,
+  0x72, 0x55, 0x70, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
+  0x55, 0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61,
   0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65, 0x76, 0x65, 0x72, 0x44, 0x6f,
-  0x77, 0x6e, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22,
-  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63,
-  0x61, 0x6c, 0x4c, 0x65, 0x76, 0x65, 0x72, 0x31, 0x20, 0x3d, 0x20, 0x22,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d,
+  0x77, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44,
+  0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d,
+  0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65, 0x76, 0x65, 0x72, 0x55,
+  0x70, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d,
   0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61,
-  0x6c, 0x4c, 0x65, 0x76, 0x65, 0x72, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a,
-  0x4f, 0x59, 0x32, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a,
-  0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c,
-  0x50, 0x65, 0x64, 0x61, 0x6c, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x41, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54,
-  0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x50, 0x65, 0x64, 0x61, 0x6c,
-  0x32, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a,
-  0x4f, 0x59, 0x32, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22,
-  0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x53, 0x65, 0x67, 0x61, 0x20, 0x42,
-  0x61, 0x73, 0x73, 0x20, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x20,
-  0x2f, 0x20, 0x47, 0x65, 0x74, 0x20, 0x42, 0x61, 0x73, 0x73, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x6c, 0x4c, 0x65, 0x76, 0x65, 0x72, 0x44, 0x6f, 0x77, 0x6e, 0x32, 0x20,
+  0x3d, 0x20, 0x22, 0x4e, 0x4f, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65,
+  0x76, 0x65, 0x72, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x4c, 0x65, 0x76,
+  0x65, 0x72, 0x32, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x32, 0x5f,
+  0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
+  0x74, 0x4d, 0x61, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x50, 0x65, 0x64, 0x61,
+  0x6c, 0x31, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x41, 0x2c,
+  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x4d, 0x61, 0x67, 0x69,
+  0x63, 0x61, 0x6c, 0x50, 0x65, 0x64, 0x61, 0x6c, 0x32, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x2c, 0x4a, 0x4f, 0x59, 0x32, 0x5f,
+  0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x0d, 0x0a,
+  0x3b, 0x20, 0x53, 0x65, 0x67, 0x61, 0x20, 0x42, 0x61, 0x73, 0x73, 0x20,
+  0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x2f, 0x20, 0x47, 0x65,
+  0x74, 0x20, 0x42, 0x61, 0x73, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x73, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69,
+  0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x4c, 0x65, 0x66, 0x74,
+  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68,
+  0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20,
+  0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54,
+  0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68,
+  0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x55, 0x70, 0x20, 0x3d, 0x20, 0x22,
+  0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
   0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64,
+  0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
+  0x44, 0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69, 0x63, 0x6b,
   0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
-  0x4c, 0x45, 0x46, 0x54, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x52, 0x69,
-  0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x52,
-  0x49, 0x47, 0x48, 0x54, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x55, 0x70,
-  0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x55, 0x50, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e,
-  0x67, 0x52, 0x6f, 0x64, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22,
-  0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x22, 0x0d, 0x0a, 0x49,
-  0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x53,
-  0x74, 0x69, 0x63, 0x6b, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x22,
-  0x4b, 0x45, 0x59, 0x5f, 0x41, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69, 0x63,
-  0x6b, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
-  0x59, 0x5f, 0x44, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46,
-  0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x55,
-  0x70, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x22, 0x0d,
-  0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e,
-  0x67, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d,
-  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e,
-  0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f,
-  0x64, 0x58, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x58,
-  0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74,
-  0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x59, 0x20,
-  0x3d, 0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x59, 0x41, 0x58, 0x49,
-  0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73,
-  0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x58, 0x20, 0x3d,
-  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x52, 0x58, 0x41, 0x58, 0x49,
-  0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73,
-  0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x59, 0x20, 0x3d,
-  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x52, 0x59, 0x41, 0x58, 0x49,
-  0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73,
-  0x68, 0x69, 0x6e, 0x67, 0x52, 0x65, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x22,
-  0x4b, 0x45, 0x59, 0x5f, 0x53, 0x50, 0x41, 0x43, 0x45, 0x2c, 0x4a, 0x4f,
-  0x59, 0x31, 0x5f, 0x5a, 0x41, 0x58, 0x49, 0x53, 0x5f, 0x50, 0x4f, 0x53,
+  0x41, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73,
+  0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x52, 0x69, 0x67,
+  0x68, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x22,
+  0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69,
+  0x6e, 0x67, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x55, 0x70, 0x20, 0x3d, 0x20,
+  0x22, 0x4b, 0x45, 0x59, 0x5f, 0x57, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70,
+  0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x53, 0x74, 0x69,
+  0x63, 0x6b, 0x44, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45,
+  0x59, 0x5f, 0x53, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46,
+  0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x58, 0x20, 0x3d,
+  0x20, 0x22, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x58, 0x41, 0x58, 0x49, 0x53,
   0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68,
-  0x69, 0x6e, 0x67, 0x43, 0x61, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b,
-  0x45, 0x59, 0x5f, 0x5a, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55,
-  0x54, 0x54, 0x4f, 0x4e, 0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75,
-  0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x53, 0x65, 0x6c, 0x65,
-  0x63, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x58, 0x2c,
-  0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32,
-  0x22, 0x0d, 0x0a, 0x0d, 0x0a, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x46, 0x65,
-  0x65, 0x64, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x31, 0x0d, 0x0a,
-  0x53, 0x44, 0x4c, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x46, 0x6f, 0x72, 0x63,
-  0x65, 0x4d, 0x61, 0x78, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a,
-  0x53, 0x44, 0x4c, 0x53, 0x65, 0x6c, 0x66, 0x43, 0x65, 0x6e, 0x74, 0x65,
-  0x72, 0x4d, 0x61, 0x78, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a,
-  0x53, 0x44, 0x4c, 0x46, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4d,
-  0x61, 0x78, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x53, 0x44,
-  0x4c, 0x56, 0x69, 0x62, 0x72, 0x61, 0x74, 0x65, 0x4d, 0x61, 0x78, 0x20,
-  0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x4f, 0x75, 0x74, 0x70, 0x75,
-  0x74, 0x73, 0x20, 0x3d, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x65, 0x74, 0x72,
-  0x6f, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x4e, 0x65, 0x74,
-  0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x2d,
-  0x20, 0x65, 0x78, 0x70, 0x65, 0x72, 0x69, 0x6d, 0x65, 0x6e, 0x74, 0x61,
-  0x6c, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x77, 0x69, 0x6e, 0x33, 0x32, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0d, 0x0a,
-  0x45, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x4e, 0x65, 0x74, 0x20, 0x3d,
-  0x20, 0x30, 0x0d, 0x0a, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x20,
-  0x3d, 0x20, 0x31, 0x39, 0x37, 0x30, 0x0d, 0x0a, 0x70, 0x6f, 0x72, 0x74,
-  0x5f, 0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x31, 0x39, 0x37, 0x31, 0x0d,
-  0x0a, 0x61, 0x64, 0x64, 0x72, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20,
-  0x22, 0x31, 0x32, 0x37, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x31, 0x22, 0x0d,
-  0x0a
+  0x69, 0x6e, 0x67, 0x52, 0x6f, 0x64, 0x59, 0x20, 0x3d, 0x20, 0x22, 0x4a,
+  0x4f, 0x59, 0x31, 0x5f, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67,
+  0x53, 0x74, 0x69, 0x63, 0x6b, 0x58, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f,
+  0x59, 0x31, 0x5f, 0x52, 0x58, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67,
+  0x53, 0x74, 0x69, 0x63, 0x6b, 0x59, 0x20, 0x3d, 0x20, 0x22, 0x4a, 0x4f,
+  0x59, 0x31, 0x5f, 0x52, 0x59, 0x41, 0x58, 0x49, 0x53, 0x22, 0x0d, 0x0a,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67,
+  0x52, 0x65, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f,
+  0x53, 0x50, 0x41, 0x43, 0x45, 0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x5a,
+  0x41, 0x58, 0x49, 0x53, 0x5f, 0x50, 0x4f, 0x53, 0x22, 0x0d, 0x0a, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x43,
+  0x61, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x5a,
+  0x2c, 0x4a, 0x4f, 0x59, 0x31, 0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e,
+  0x31, 0x22, 0x0d, 0x0a, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x46, 0x69, 0x73,
+  0x68, 0x69, 0x6e, 0x67, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x3d,
+  0x20, 0x22, 0x4b, 0x45, 0x59, 0x5f, 0x58, 0x2c, 0x4a, 0x4f, 0x59, 0x31,
+  0x5f, 0x42, 0x55, 0x54, 0x54, 0x4f, 0x4e, 0x32, 0x22, 0x0d, 0x0a, 0x0d,
+  0x0a, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x46, 0x65, 0x65, 0x64, 0x62, 0x61,
+  0x63, 0x6b, 0x20, 0x3d, 0x20, 0x31, 0x0d, 0x0a, 0x53, 0x44, 0x4c, 0x43,
+  0x6f, 0x6e, 0x73, 0x74, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x4d, 0x61, 0x78,
+  0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x53, 0x44, 0x4c, 0x53,
+  0x65, 0x6c, 0x66, 0x43, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x4d, 0x61, 0x78,
+  0x20, 0x3d, 0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x53, 0x44, 0x4c, 0x46,
+  0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x61, 0x78, 0x20, 0x3d,
+  0x20, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x53, 0x44, 0x4c, 0x56, 0x69, 0x62,
+  0x72, 0x61, 0x74, 0x65, 0x4d, 0x61, 0x78, 0x20, 0x3d, 0x20, 0x31, 0x30,
+  0x30, 0x0d, 0x0a, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0x20, 0x3d,
+  0x20, 0x6c, 0x69, 0x62, 0x72, 0x65, 0x74, 0x72, 0x6f, 0x0d, 0x0a, 0x0d,
+  0x0a, 0x0d, 0x0a, 0x3b, 0x20, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b,
+  0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x2d, 0x20, 0x65, 0x78, 0x70,
+  0x65, 0x72, 0x69, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x62, 0x75,
+  0x69, 0x6c, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x77, 0x69, 0x6e, 0x33,
+  0x32, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0d, 0x0a, 0x45, 0x6d, 0x75, 0x6c,
+  0x61, 0x74, 0x65, 0x4e, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x0d, 0x0a,
+  0x70, 0x6f, 0x72, 0x74, 0x5f, 0x69, 0x6e, 0x20, 0x3d, 0x20, 0x31, 0x39,
+  0x37, 0x30, 0x0d, 0x0a, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x6f, 0x75, 0x74,
+  0x20, 0x3d, 0x20, 0x31, 0x39, 0x37, 0x31, 0x0d, 0x0a, 0x61, 0x64, 0x64,
+  0x72, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x31, 0x32, 0x37,
+  0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x31, 0x22, 0x0d, 0x0a
 };
-const unsigned int bundled_supermodel_ini_len = 9421;
+const unsigned int bundled_supermodel_ini_len = 9465;
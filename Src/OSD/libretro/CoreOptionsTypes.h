@@ -33,6 +33,12 @@ enum class Renderer3D {
    Legacy3D
 };
 
+enum class HeadlessMode {
+   Disabled,
+   Enabled,        // null renderers, no GL context is requested
+   SceneTraversal  // as above, but the 3D scene is still built every frame
+};
+
 enum class SteeringResponse {
    Linear,
    Progressive,
@@ -74,6 +80,7 @@ struct CoreOptions {
    int sound_volume;
    int music_volume;
    bool legacy_sound_dsp;
+   bool linear_music_resampler;
    int ppc_frequency;
    int frameskip;
    EmulationThreading emulation_threading;
@@ -84,6 +91,7 @@ struct CoreOptions {
    StarWarsInput star_wars_input;
    bool star_wars_upright_x_inversion;
    FourSpeedShifter four_speed_shifter;
+   HeadlessMode headless;
 };
 
 extern CoreOptions g_options;
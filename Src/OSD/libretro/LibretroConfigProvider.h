@@ -35,6 +35,8 @@ namespace LibretroConfigProvider {
         config.Set("EmulateDSB", true, "Sound");
         config.Set("SoundVolume", 100, "Sound", 0, 200);
         config.Set("MusicVolume", 100, "Sound", 0, 200);
+        config.Set<std::string>("MusicResampler", "sinc", "Sound", "", "", { "linear","sinc" });
+        config.Set("MusicCacheSize", 64, "Sound", 0, 1024);
         // Other sound options
         config.Set("LegacySoundDSP", false, "Sound"); // New config option for games that do not play correctly with MAME's SCSP sound core.
         // CDriveBoard
@@ -63,6 +65,10 @@ namespace LibretroConfigProvider {
         config.Set("Crosshairs", int(0), "Video", 0, 0, { 0,1,2,3 });
         config.Set<std::string>("CrosshairStyle", "vector", "Video", "", "", { "bmp","vector" });
         config.Set("NoWhiteFlash", false, "Video");
+        config.Set("Headless", false, "Video");
+        config.Set("HeadlessSceneTraversal", false, "Video");
+        config.Set("GfxCaptureFrame", 0, "Video");
+        config.Set("GfxCaptureCount", 0, "Video");
         config.Set("FlipStereo", false, "Sound");
         #ifdef SUPERMODEL_WIN32
         config.Set<std::string>("InputSystem", "dinput", "Core", "", "", { "sdl","sdlgamepad","dinput","xinput","rawinput" });
@@ -349,6 +355,9 @@ namespace LibretroConfigProvider {
                    g_options.widescreen_mode ==
                        WidescreenMode::WidescreenWideBackground);
         config.Set("NoWhiteFlash", g_options.no_white_flash);
+        config.Set("Headless", g_options.headless != HeadlessMode::Disabled);
+        config.Set("HeadlessSceneTraversal",
+                   g_options.headless == HeadlessMode::SceneTraversal);
         // RefreshRate and SoundFreq form one Libretro timing mode. Never let
         // an optional INI split video cadence from audio packet sizing.
         const bool native_timing =
@@ -368,6 +377,7 @@ namespace LibretroConfigProvider {
         config.Set("EmulateSound", g_options.sound_enable);
         config.Set("SoundVolume", g_options.sound_volume);
         config.Set("MusicVolume", g_options.music_volume);
+        config.Set<std::string>("MusicResampler", g_options.linear_music_resampler ? "linear" : "sinc");
         config.Set("LegacySoundDSP", g_options.legacy_sound_dsp);
         config.Set("ForceFeedback", g_options.force_feedback);
         config.Set("PowerPCFrequency", static_cast<unsigned>(g_options.ppc_frequency));
@@ -419,13 +429,17 @@ namespace LibretroConfigProvider {
         { "-frag-shader",           "FragmentShader"          },
         { "-sound-volume",          "SoundVolume"             },
         { "-music-volume",          "MusicVolume"             },
+        { "-music-resampler",       "MusicResampler"          },
+        { "-music-cache-size",      "MusicCacheSize"          },
         { "-balance",               "Balance"                 },
         { "-channels", 	            "NbSoundChannels"         },
         { "-soundfreq",             "SoundFreq"               },
         { "-input-system",          "InputSystem"             },
         { "-outputs",               "Outputs"                 },
         { "-log-output",            "LogOutput"               },
-        { "-log-level",             "LogLevel"                }
+        { "-log-level",             "LogLevel"                },
+        { "-gfx-capture-frame",     "GfxCaptureFrame"         },
+        { "-gfx-capture-count",     "GfxCaptureCount"         }
     };
 
     static const std::map<std::string, std::pair<std::string, bool>> bool_options
@@ -464,6 +478,8 @@ namespace LibretroConfigProvider {
         { "-new-scsp",            { "LegacySoundDSP",   false } },
         { "-no-white-flash",      { "NoWhiteFlash",     true } },
         { "-white-flash",         { "NoWhiteFlash",     false } },
+        { "-headless",            { "Headless",         true } },
+        { "-headless-traversal",  { "HeadlessSceneTraversal", true } },
     #ifdef NET_BOARD
         { "-net",                 { "Network",       true } },
         { "-no-net",              { "Network",       false } },
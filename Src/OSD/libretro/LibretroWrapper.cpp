@@ -40,6 +40,8 @@
 #include "OSD/Audio.h"
 #include "Graphics/New3D/VBO.h"
 #include "Graphics/SuperAA.h"
+#include "Graphics/Render2D.h"
+#include "Graphics/NullRender.h"
 #include "Sound/MPEG/MpegAudio.h"
 #include "Util/BMPFile.h"
 #include "libretroCrosshair.h"
@@ -163,6 +165,12 @@ FrameTimings LibretroWrapper::GetTimings() const
     return FrameTimings{};
 }
 
+Render3DStats LibretroWrapper::GetRenderStats() const
+{
+    if (Render3D) return Render3D->GetStats();
+    return Render3DStats{};
+}
+
 static bool FileExists(const std::string& path)
 {
     FILE* fp = fopen(path.c_str(), "rb");
@@ -241,7 +249,7 @@ void LibretroWrapper::UpdateScreenSize(unsigned viewWidth, unsigned viewHeight,
     // If dimensions match and renderers are initialized, skip costly re-init
     if (viewWidth == xRes && viewHeight == yRes &&
         outputWidth == totalXRes && outputHeight == totalYRes &&
-        superAA != nullptr)
+        Render3D != nullptr)
         return;
 
     xRes = std::min(viewWidth, outputWidth);
@@ -262,6 +270,8 @@ void LibretroWrapper::UpdateScreenSize(unsigned viewWidth, unsigned viewHeight,
 
 void LibretroWrapper::SaveFrameBuffer(const std::string& file)
 {
+    if (superAA == nullptr)     // headless, nothing has been drawn
+        return;
     std::shared_ptr<uint8_t> pixels(new uint8_t[totalXRes * totalYRes * 4], std::default_delete<uint8_t[]>());
     glReadPixels(0, 0, totalXRes, totalYRes, GL_RGBA, GL_UNSIGNED_BYTE, pixels.get());
     Util::WriteSurfaceToBMP<Util::RGBA8>(file, pixels.get(), totalXRes, totalYRes, true);
@@ -357,8 +367,9 @@ bool BeginFrameVideo()
 
 void EndFrameVideo()
 {
-  // Show crosshairs for light gun games
-  if (videoInputs && s_crosshair)
+  // Show crosshairs for light gun games. Headless runs have no GL target
+  // (and no SuperAA) to draw them into.
+  if (videoInputs && s_crosshair && g_ctx->getSuperAA())
   {
     // Render2D/New3D restore framebuffer 0 after drawing to Supermodel's
     // off-screen target. In the standalone build that is the window
@@ -386,6 +397,25 @@ bool LibretroWrapper::InitRenderers()
         glDeleteRenderbuffers(1, &m_libretrDepth);  m_libretrDepth = 0;
     }
 
+    // Headless: null renderers that need no GL context and nothing to
+    // resolve, so there is no SuperAA either.
+    if (s_runtime_config["Headless"].ValueAs<bool>())
+    {
+        Render2D = new CNullRender2D();
+        Render3D = new CNullRender3D(s_runtime_config, Model3->GetGame().name,
+                                     s_runtime_config["HeadlessSceneTraversal"].ValueAs<bool>());
+
+        if (Result::OKAY != Render2D->Init(xOffset, yOffset, xRes, yRes,
+                                           totalXRes, totalYRes, 0, upscaleMode))
+            return false;
+        if (Result::OKAY != Render3D->Init(xOffset, yOffset, xRes, yRes,
+                                           totalXRes, totalYRes, 0))
+            return false;
+
+        Model3->AttachRenderers(Render2D, Render3D, nullptr);
+        return true;
+    }
+
     superAA = new SuperAA(aaValue, CRTcolors);
     superAA->Init(totalXRes, totalYRes);
 
@@ -544,6 +574,8 @@ int LibretroWrapper::SuperModelInit(const Game &game) {
   if (!initialState.empty())
     LoadState(Model3, initialState);
 
+  gfxCapture.reset(new CGraphicsCapture(s_runtime_config, s_analysisPath));
+
   fpsFramesElapsed = 0;
   return 0;
 }
@@ -564,6 +596,7 @@ int LibretroWrapper::Supermodel(const Game &game, bool skipRender)
     else
     {
         Model3->RunFrame(skipRender);
+        gfxCapture->EndFrame(Model3);
 
         const auto audioStart = std::chrono::steady_clock::now();
         lastEngineMs = std::chrono::duration<float, std::milli>(
@@ -703,6 +736,7 @@ void LibretroWrapper::ShutDownSupermodel()
 
   delete Model3;
   Model3 = nullptr;
+  gfxCapture.reset();
 
   delete Inputs;
   Inputs = nullptr;
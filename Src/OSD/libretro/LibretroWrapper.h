@@ -1,6 +1,7 @@
 #include <Supermodel.h>
 #include <Model3/IEmulator.h>
 #include <Model3/Model3.h>
+#include <Model3/GraphicsCapture.h>
 #include <libretro.h>
 #include "LibretroTiming.h"
 #include "ROMSet.h"
@@ -47,6 +48,7 @@ public:
     IEmulator* getEmulator() const { return Model3; }
     void Reset();   // hard reset of the emulated machine (retro_reset)
     FrameTimings GetTimings() const;
+    Render3DStats GetRenderStats() const;
     float GetLastEngineMs() const { return lastEngineMs; }
     float GetLastAudioSubmitMs() const { return lastAudioSubmitMs; }
     double GetFramesPerSecond() const;
@@ -103,9 +105,10 @@ private:
     Game game;
     ROMSet rom_set;
     IEmulator *Model3 = nullptr;
+    std::unique_ptr<CGraphicsCapture> gfxCapture;
     COutputs *Outputs = nullptr;
     SuperAA* superAA = nullptr;
-    CRender2D *Render2D = nullptr;
+    IRender2D *Render2D = nullptr;
     IRender3D *Render3D = nullptr;
     std::string initialState;
     uint64_t    prevFPSTicks;
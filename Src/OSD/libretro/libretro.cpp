@@ -56,6 +56,7 @@ static bool g_has_active_input_game = false;
 static GunInput g_active_gun_input = GunInput::Hybrid;
 static StarWarsInput g_active_star_wars_input = StarWarsInput::Hybrid;
 static WidescreenMode g_active_widescreen_mode = WidescreenMode::Disabled;
+static bool g_active_headless = false;
 static constexpr unsigned kNvramSettingCount =
    static_cast<unsigned>(LibretroNvramSettings::Setting::Count);
 struct NvramCoreOptionSet
@@ -315,6 +316,9 @@ static std::chrono::steady_clock::time_point s_previousFrameStart;
 static bool s_havePreviousFrameStart = false;
 static unsigned s_accPpc = 0;
 static unsigned s_accRender = 0;
+static unsigned s_accDrawCalls = 0;
+static unsigned s_accMeshes = 0;
+static unsigned s_accStateChanges = 0;
 static unsigned s_renderedFrames = 0;
 static unsigned s_timingFrames = 0;
 static unsigned s_frameIntervals = 0;
@@ -347,6 +351,7 @@ CoreOptions g_options = {
    /* sound_volume         */ 100,
    /* music_volume         */ 100,
    /* legacy_sound_dsp     */ false,
+   /* linear_music_resampler */ false,
    /* ppc_frequency        */ 0,
    /* frameskip            */ 0,
    /* emulation_threading  */ EmulationThreading::MultiThreadedGPU,
@@ -362,6 +367,7 @@ CoreOptions g_options = {
    /* star_wars_input     */ StarWarsInput::Hybrid,
    /* star_wars_upright_x_inversion */ true,
    /* four_speed_shifter  */ FourSpeedShifter::HGate,
+   /* headless            */ HeadlessMode::Disabled,
 };
 
 static bool widescreen_enabled()
@@ -1044,6 +1050,10 @@ bool retro_load_game(const struct retro_game_info *info)
    // create, so options have to be read before SET_HW_RENDER is negotiated.
    update_core_options();
 
+   // Headless runs use null renderers and never touch GL, so no context is
+   // requested at all and the renderers are created once the game is loaded.
+   g_active_headless = g_options.headless != HeadlessMode::Disabled;
+
    hw_render.context_reset   = context_reset;
    hw_render.context_destroy = context_destroy;
    hw_render.depth           = true;
@@ -1076,17 +1086,27 @@ bool retro_load_game(const struct retro_game_info *info)
       hw_render.version_minor = active_quad_rendering ? 5 : 1;
    }
 #endif
-   log_cb(RETRO_LOG_INFO,
-          "[Supermodel] Renderer context: %s, OpenGL %u.%u%s\n",
-          g_options.renderer_3d == Renderer3D::Legacy3D ?
-             "Legacy3D compatibility" : "New3D core",
-          hw_render.version_major, hw_render.version_minor,
-          g_options.renderer_3d == Renderer3D::New3D &&
-             g_options.quad_rendering ?
-                ", Quad Rendering enabled" : "");
-   if (!environ_cb(RETRO_ENVIRONMENT_SET_HW_RENDER, &hw_render)) {
-       log_cb(RETRO_LOG_ERROR, "[Supermodel] HW Render Context negotiation failed.\n");
-       return false;
+   if (g_active_headless)
+   {
+      log_cb(RETRO_LOG_INFO,
+             "[Supermodel] Headless rendering%s, no OpenGL context\n",
+             g_options.headless == HeadlessMode::SceneTraversal ?
+                " with scene traversal" : "");
+   }
+   else
+   {
+      log_cb(RETRO_LOG_INFO,
+             "[Supermodel] Renderer context: %s, OpenGL %u.%u%s\n",
+             g_options.renderer_3d == Renderer3D::Legacy3D ?
+                "Legacy3D compatibility" : "New3D core",
+             hw_render.version_major, hw_render.version_minor,
+             g_options.renderer_3d == Renderer3D::New3D &&
+                g_options.quad_rendering ?
+                   ", Quad Rendering enabled" : "");
+      if (!environ_cb(RETRO_ENVIRONMENT_SET_HW_RENDER, &hw_render)) {
+          log_cb(RETRO_LOG_ERROR, "[Supermodel] HW Render Context negotiation failed.\n");
+          return false;
+      }
    }
 
    // 1. Attempt to get the Rumble Interface from the frontend
@@ -1134,6 +1154,18 @@ bool retro_load_game(const struct retro_game_info *info)
       wrapper.ShutDownSupermodel();
       return false;
    }
+   if (g_active_headless)
+   {
+      g_context_ready = wrapper.InitRenderers();
+      if (!g_context_ready)
+      {
+         log_cb(RETRO_LOG_ERROR, "[Supermodel] Headless renderer initialization failed.\n");
+         wrapper.ShutDownSupermodel();
+         return false;
+      }
+      last_width = wrapper.getTotalXRes();
+      last_height = wrapper.getTotalYRes();
+   }
    // Re-apply FFB state after full DriveBoard initialization
    auto libretroInput2 = std::static_pointer_cast<CLibretroInputSystem>(wrapper.getInputSystem());
    if (libretroInput2 && g_options.force_feedback) {
@@ -1196,6 +1228,7 @@ void retro_run(void)
       bool old_network_board = g_options.network_board;
       unsigned old_network_cabinets = g_options.network_cabinets;
       Renderer3D old_renderer_3d = g_options.renderer_3d;
+      HeadlessMode old_headless = g_options.headless;
       bool old_legacy_multi_texture = g_options.legacy_multi_texture;
       bool old_quad_rendering = g_options.quad_rendering;
       int old_crt_colors = g_options.crt_colors;
@@ -1206,6 +1239,7 @@ void retro_run(void)
       int old_upscale_mode = g_options.upscale_mode;
       bool old_sound_enable = g_options.sound_enable;
       bool old_legacy_sound_dsp = g_options.legacy_sound_dsp;
+      bool old_linear_music_resampler = g_options.linear_music_resampler;
       unsigned old_crosshairs = g_options.crosshairs;
       GunInput old_gun_input = g_options.gun_input;
       StarWarsInput old_star_wars_input = g_options.star_wars_input;
@@ -1228,6 +1262,7 @@ void retro_run(void)
       }
 
       if (g_options.renderer_3d != old_renderer_3d ||
+          g_options.headless != old_headless ||
           g_options.legacy_multi_texture != old_legacy_multi_texture ||
           g_options.quad_rendering != old_quad_rendering ||
           g_options.crt_colors != old_crt_colors ||
@@ -1274,7 +1309,8 @@ void retro_run(void)
       }
 
       if (g_options.upscale_mode != old_upscale_mode ||
-          g_options.legacy_sound_dsp != old_legacy_sound_dsp)
+          g_options.legacy_sound_dsp != old_legacy_sound_dsp ||
+          g_options.linear_music_resampler != old_linear_music_resampler)
       {
          static const struct retro_message message = {
             "Renderer/audio engine changes will apply after restarting the content.", 180
@@ -1467,6 +1503,13 @@ void retro_run(void)
       wrapper.Supermodel(game, true);
       video_cb(NULL, target_w, target_h, 0);
    }
+   else if (g_active_headless)
+   {
+      // Headless: the null renderers still get the whole frame, there is
+      // just nothing to present.
+      wrapper.Supermodel(game, false);
+      video_cb(NULL, target_w, target_h, 0);
+   }
    else
    {
       // Full render: reset GL state, clear FBO, run emulation + rendering
@@ -1586,7 +1629,14 @@ void retro_run(void)
       s_accRun += emu + present;
       if (emu + present > s_maxRun) s_maxRun = emu + present;
       s_accPpc += t.ppcTicks;
-      if (!skipRender) { s_accRender += t.renderTicks; s_renderedFrames++; }
+      if (!skipRender) {
+         const Render3DStats rs = wrapper.GetRenderStats();
+         s_accRender += t.renderTicks;
+         s_accDrawCalls += rs.drawCalls;
+         s_accMeshes += rs.meshes;
+         s_accStateChanges += rs.stateChanges;
+         s_renderedFrames++;
+      }
 
       if (++s_timingFrames >= 61) {   // 61: coprime with every frameskip cycle (1..4)
          const float n = (float)s_timingFrames;
@@ -1609,6 +1659,12 @@ void retro_run(void)
                  ? 1000.0f / (s_accFrameInterval /
                               static_cast<float>(s_frameIntervals))
                  : 0.0f;
+         if (g_options.timing_overlay && s_renderedFrames)
+            log_cb(RETRO_LOG_INFO,
+                   "[Timing] 3D per frame | draws:%u  meshes:%u  state changes:%u\n",
+                   s_accDrawCalls / s_renderedFrames,
+                   s_accMeshes / s_renderedFrames,
+                   s_accStateChanges / s_renderedFrames);
          if (g_options.timing_overlay)
             log_cb(RETRO_LOG_INFO,
                    "[Timing] avg over %u frames | PPC:%4.1f  Render:%4.1f (%u drawn)  "
@@ -1638,6 +1694,7 @@ void retro_run(void)
          s_accEngine = s_accAudioSubmit = s_accOverlay = s_accBlit = 0.0f;
          s_accFrameInterval = 0.0f;
          s_accPpc = s_accRender = 0;
+         s_accDrawCalls = s_accMeshes = s_accStateChanges = 0;
          s_frameIntervals = 0;
       }
    }
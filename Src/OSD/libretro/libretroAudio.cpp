@@ -1,10 +1,13 @@
 #include <OSD/Audio.h>
+#include "OSD/AudioRing.h"
 #include "Supermodel.h"
 #include <cmath>
 #include <algorithm>
 #include <mutex>
+#include <utility>
 #include "libretro_cbs.h"
 #include "LibretroTiming.h"
+#include "Util/SIMD.h"
 
 // Model 3 audio output is 44.1 kHz, mixed to stereo for Libretro.
 #define SAMPLE_RATE_M3     (LibretroTiming::kAudioSampleRate)
@@ -35,37 +38,18 @@ float balanceFactorRearLeft   = 1.0f;
 float balanceFactorRearRight  = 1.0f;
 
 static bool enabled = true;                     // True if sound output is enabled
-static constexpr bool underRunLoop = true;      // True if should loop back to beginning of buffer on under-run, otherwise sound is just skipped
-static UINT32 audioBufferSize = 0;              // Size (in bytes) of audio buffer
-static INT8* audioBuffer = NULL;                // Audio buffer
-static UINT32 writePos = 0;                     // Current position at which writing into buffer
-static UINT32 playPos = 0;                      // Current position at which playing data in buffer via callback
-static bool writeWrapped = false;               // True if write position has wrapped around at end of buffer but play position has not done so yet
-static unsigned underRuns = 0;                  // Number of buffer under-runs that have occured
-static unsigned overRuns = 0;                   // Number of buffer over-runs that have occured
+static CAudioRing audioRing;                    // Mixed frames, written by OutputAudio() and read by PlayCallback()
+static INT16 lastFrame[2] = { 0, 0 };           // Last frame handed to the frontend, faded out on under-run
 static unsigned shortWrites = 0;                // Frontend batch callbacks that accepted fewer frames than requested
 static AudioCallbackFPtr callback = NULL;       // Pointer to audio callback that is called when audio buffer is less than half empty
 static void* callbackData = NULL;               // Pointer to data to be passed to audio callback when it is called
-static std::mutex s_audioMutex;
+static std::mutex s_callbackMutex;              // Guards the two above, never taken by the sound thread
 static const Util::Config::Node* s_config = 0;
 
-UINT32 GetAvailableAudioLen()
-{
-    // Simple circular buffer distance
-    if (writePos >= playPos)
-    {
-        return writePos - playPos;
-    }
-    else
-    {
-        // Write has wrapped around, play has not
-        return (audioBufferSize - playPos) + writePos;
-    }
-}
 void SetAudioCallback(AudioCallbackFPtr newCallback, void* newData)
 {
     // Scoped lock: Automatically unlocks when it goes out of scope
-    std::lock_guard<std::mutex> lock(s_audioMutex);
+    std::lock_guard<std::mutex> lock(s_callbackMutex);
 
     callback = newCallback;
     callbackData = newData;
@@ -115,89 +99,58 @@ static INT16 ClampINT16(float x)
 }
 void PlayCallback(void* /*data*/, uint8_t* /*stream*/, int len)
 {
-    std::lock_guard<std::mutex> lock(s_audioMutex);
     if (!enabled || !audio_batch_cb) return;
 
-    UINT32 avail = GetAvailableAudioLen();
-    UINT32 to_read = (avail < (UINT32)len) ? avail : (UINT32)len;
-    
-    INT8* src1 = nullptr;
-    INT8* src2 = nullptr;
-    UINT32 len1 = 0, len2 = 0;
-
-    if (to_read > 0)
+    // Only the frames queued now are read, the sound thread may keep adding
+    // more meanwhile without either side waiting for the other
+    const unsigned wanted = static_cast<unsigned>(len) / bytes_per_sample_host;
+    const unsigned to_read = std::min(audioRing.Queued(), wanted);
+
+    // Submit in at most two spans, preserving order across the end of the
+    // ring. If the frontend only accepts part of a span, leave the rest
+    // queued for the next call.
+    unsigned consumed = 0;
+    bool frontend_short_write = false;
+    while (consumed < to_read && !frontend_short_write)
     {
-        if (playPos + to_read > audioBufferSize)
-        {
-            src1 = audioBuffer + playPos;
-            len1 = audioBufferSize - playPos;
-            src2 = audioBuffer;
-            len2 = to_read - len1;
-        }
-        else
-        {
-            src1 = audioBuffer + playPos;
-            len1 = to_read;
-        }
-
-        UINT32 consumed_bytes = 0;
-        bool frontend_short_write = false;
-
-        if (len1 > 0)
-        {
-            const size_t requested_frames = len1 / bytes_per_sample_host;
-            const size_t accepted_frames = std::min(
-                audio_batch_cb((const int16_t*)src1, requested_frames),
-                requested_frames);
-            consumed_bytes += static_cast<UINT32>(
-                accepted_frames * bytes_per_sample_host);
-            frontend_short_write = accepted_frames != requested_frames;
-        }
-
-        // Preserve submission order across the ring-buffer boundary. If the
-        // frontend only accepted part of the first span, leave both the
-        // unaccepted frames and the wrapped span queued for the next call.
-        if (!frontend_short_write && len2 > 0)
-        {
-            const size_t requested_frames = len2 / bytes_per_sample_host;
-            const size_t accepted_frames = std::min(
-                audio_batch_cb((const int16_t*)src2, requested_frames),
-                requested_frames);
-            consumed_bytes += static_cast<UINT32>(
-                accepted_frames * bytes_per_sample_host);
-            frontend_short_write = accepted_frames != requested_frames;
-        }
-
-        if (frontend_short_write)
-            ++shortWrites;
-
-        const UINT32 old_play_pos = playPos;
-        playPos = (playPos + consumed_bytes) % audioBufferSize;
-        if (old_play_pos + consumed_bytes >= audioBufferSize)
-            writeWrapped = false;
+        unsigned contiguous;
+        const INT16* src = audioRing.ReadSpan(consumed, &contiguous);
+        const size_t requested_frames = std::min(contiguous, to_read - consumed);
+        const size_t accepted_frames = std::min(
+            audio_batch_cb((const int16_t*)src, requested_frames),
+            requested_frames);
+        consumed += static_cast<unsigned>(accepted_frames);
+        frontend_short_write = accepted_frames != requested_frames;
+    }
 
-        // A short frontend write is not an emulator under-run. Do not append
-        // synthetic samples after data the frontend explicitly deferred.
-        if (frontend_short_write)
-            to_read = static_cast<UINT32>(len);
+    if (consumed > 0)
+    {
+        // Keep a copy: once consumed, the frame may be overwritten at any time
+        unsigned contiguous;
+        const INT16* last = audioRing.ReadSpan(consumed - 1, &contiguous);
+        lastFrame[0] = last[0];
+        lastFrame[1] = last[1];
+        audioRing.Consume(consumed);
     }
 
-    int missing_bytes = len - to_read;
-    if (missing_bytes > 0)
+    // A short frontend write is not an emulator under-run. Do not append
+    // synthetic samples after data the frontend explicitly deferred.
+    if (frontend_short_write)
+        ++shortWrites;
+    else if (to_read < wanted)
     {
-        // Get last two samples for interpolation
-        int16_t* lastSample = (int16_t*)(audioBuffer + ((playPos - 4 + audioBufferSize) % audioBufferSize));
-        
+        audioRing.CountUnderRun();
+
         static int16_t fade_buf[4096];
-        int samples_to_fill = missing_bytes / 4;
-        
+        int samples_to_fill = std::min<int>(wanted - to_read, 2048);
+
         // Linear fade to silence (less jarring than sudden repeat or silence)
-        for (int i = 0; i < samples_to_fill && i < 2048; i++) {
+        for (int i = 0; i < samples_to_fill; i++) {
             float fade = 1.0f - (float)i / (float)samples_to_fill;
-            fade_buf[i*2]   = (int16_t)(lastSample[0] * fade);  // Left
-            fade_buf[i*2+1] = (int16_t)(lastSample[1] * fade);  // Right
+            fade_buf[i*2]   = (int16_t)(lastFrame[0] * fade);  // Left
+            fade_buf[i*2+1] = (int16_t)(lastFrame[1] * fade);  // Right
         }
-        
+
         const size_t requested_frames = static_cast<size_t>(samples_to_fill);
         const size_t accepted_frames = std::min(
             audio_batch_cb(fade_buf, requested_frames), requested_frames);
@@ -205,18 +158,101 @@ void PlayCallback(void* /*data*/, uint8_t* /*stream*/, int len)
             ++shortWrites;
     }
 
+    std::lock_guard<std::mutex> lock(s_callbackMutex);
     if (callback) callback(callbackData);
 }
 
-static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, void* dest, bool flipStereo)
+// Channel value after sound volume, music and balance are applied
+static inline float ChannelValue(const float* buffer, const float* musicBuffer, unsigned i, float volume, float balanceFactor)
+{
+    return (buffer[i] * volume + (musicBuffer ? musicBuffer[i] : 0.0f)) * balanceFactor;
+}
+
+/// <summary>
+/// Stereo output, the case used by Libretro: each side is the average of its
+/// front and rear channels. Volume, balance and the averaging fold into one
+/// gain per input, so every output sample is a short sum of products followed
+/// by INT16 saturation.
+/// </summary>
+static void MixStereo(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, float volume, const float* leftMusicBuffer, const float* rightMusicBuffer, INT16* p, bool flipStereo)
+{
+    float frontLeftGain  = 0.5f * volume * balanceFactorFrontLeft;
+    float frontRightGain = 0.5f * volume * balanceFactorFrontRight;
+    float rearLeftGain   = 0.5f * volume * balanceFactorRearLeft;
+    float rearRightGain  = 0.5f * volume * balanceFactorRearRight;
+    float musicLeftGain  = 0.5f * balanceFactorFrontLeft;
+    float musicRightGain = 0.5f * balanceFactorFrontRight;
+
+    // Swapping left and right channels just exchanges the inputs of both sides
+    if (flipStereo) {
+        std::swap(leftFrontBuffer, rightFrontBuffer);
+        std::swap(leftRearBuffer, rightRearBuffer);
+        std::swap(leftMusicBuffer, rightMusicBuffer);
+        std::swap(frontLeftGain, frontRightGain);
+        std::swap(rearLeftGain, rearRightGain);
+        std::swap(musicLeftGain, musicRightGain);
+    }
+
+    const bool music = leftMusicBuffer != NULL;
+    unsigned i = 0;
+#if defined(SUPERMODEL_SIMD_SSE2)
+    const __m128 fl = _mm_set1_ps(frontLeftGain), fr = _mm_set1_ps(frontRightGain);
+    const __m128 rl = _mm_set1_ps(rearLeftGain), rr = _mm_set1_ps(rearRightGain);
+    const __m128 ml = _mm_set1_ps(musicLeftGain), mr = _mm_set1_ps(musicRightGain);
+    const __m128 lo = _mm_set1_ps((float)INT16_MIN), hi = _mm_set1_ps((float)INT16_MAX);
+    for (; i + 4 <= numSamples; i += 4) {
+        __m128 l = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(leftFrontBuffer + i), fl), _mm_mul_ps(_mm_loadu_ps(leftRearBuffer + i), rl));
+        __m128 r = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(rightFrontBuffer + i), fr), _mm_mul_ps(_mm_loadu_ps(rightRearBuffer + i), rr));
+        if (music) {
+            l = _mm_add_ps(l, _mm_mul_ps(_mm_loadu_ps(leftMusicBuffer + i), ml));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(rightMusicBuffer + i), mr));
+        }
+        // Clamp before truncating, out of range conversions don't saturate
+        l = _mm_min_ps(_mm_max_ps(l, lo), hi);
+        r = _mm_min_ps(_mm_max_ps(r, lo), hi);
+        __m128i lr01 = _mm_cvttps_epi32(_mm_unpacklo_ps(l, r));
+        __m128i lr23 = _mm_cvttps_epi32(_mm_unpackhi_ps(l, r));
+        _mm_storeu_si128((__m128i*)(p + 2 * i), _mm_packs_epi32(lr01, lr23));
+    }
+#elif defined(SUPERMODEL_SIMD_NEON)
+    const float32x4_t fl = vdupq_n_f32(frontLeftGain), fr = vdupq_n_f32(frontRightGain);
+    const float32x4_t rl = vdupq_n_f32(rearLeftGain), rr = vdupq_n_f32(rearRightGain);
+    const float32x4_t ml = vdupq_n_f32(musicLeftGain), mr = vdupq_n_f32(musicRightGain);
+    for (; i + 4 <= numSamples; i += 4) {
+        float32x4_t l = vaddq_f32(vmulq_f32(vld1q_f32(leftFrontBuffer + i), fl), vmulq_f32(vld1q_f32(leftRearBuffer + i), rl));
+        float32x4_t r = vaddq_f32(vmulq_f32(vld1q_f32(rightFrontBuffer + i), fr), vmulq_f32(vld1q_f32(rightRearBuffer + i), rr));
+        if (music) {
+            l = vaddq_f32(l, vmulq_f32(vld1q_f32(leftMusicBuffer + i), ml));
+            r = vaddq_f32(r, vmulq_f32(vld1q_f32(rightMusicBuffer + i), mr));
+        }
+        // Conversion truncates and saturates, narrowing saturates again to INT16
+        int16x4x2_t lr;
+        lr.val[0] = vqmovn_s32(vcvtq_s32_f32(l));
+        lr.val[1] = vqmovn_s32(vcvtq_s32_f32(r));
+        vst2_s16(p + 2 * i, lr);
+    }
+#endif
+    for (; i < numSamples; i++) {
+        float l = leftFrontBuffer[i] * frontLeftGain + leftRearBuffer[i] * rearLeftGain;
+        float r = rightFrontBuffer[i] * frontRightGain + rightRearBuffer[i] * rearRightGain;
+        if (music) {
+            l += leftMusicBuffer[i] * musicLeftGain;
+            r += rightMusicBuffer[i] * musicRightGain;
+        }
+        p[2 * i + 0] = ClampINT16(l);
+        p[2 * i + 1] = ClampINT16(r);
+    }
+}
+
+static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, float volume, const float* leftMusicBuffer, const float* rightMusicBuffer, void* dest, bool flipStereo)
 {
     INT16* p = (INT16*)dest;
 
     if (nbHostAudioChannels == 1) {
         for (unsigned i = 0; i < numSamples; i++) {
             INT16 monovalue = MixINT16(
-                MixFloat(leftFrontBuffer[i] * balanceFactorFrontLeft,rightFrontBuffer[i] * balanceFactorFrontRight),
-                MixFloat(leftRearBuffer[i]  * balanceFactorRearLeft, rightRearBuffer[i]  * balanceFactorRearRight));
+                MixFloat(ChannelValue(leftFrontBuffer, leftMusicBuffer, i, volume, balanceFactorFrontLeft), ChannelValue(rightFrontBuffer, rightMusicBuffer, i, volume, balanceFactorFrontRight)),
+                MixFloat(ChannelValue(leftRearBuffer, NULL, i, volume, balanceFactorRearLeft), ChannelValue(rightRearBuffer, NULL, i, volume, balanceFactorRearRight)));
             *p++ = monovalue;
         }
     } else {
@@ -233,24 +269,13 @@ static void MixChannels(unsigned numSamples, const float* leftFrontBuffer, const
 
         // Now order channels according to audio type
         if (nbHostAudioChannels == 2) {
-            for (unsigned i = 0; i < numSamples; i++) {
-                INT16 leftvalue = MixINT16(leftFrontBuffer[i] * balanceFactorFrontLeft, leftRearBuffer[i] * balanceFactorRearLeft);
-                INT16 rightvalue = MixINT16(rightFrontBuffer[i]*balanceFactorFrontRight, rightRearBuffer[i]*balanceFactorRearRight);
-                if (flipStereo) // swap left and right channels
-                {
-                    *p++ = rightvalue;
-                    *p++ = leftvalue;
-                } else {
-                    *p++ = leftvalue;
-                    *p++ = rightvalue;
-                }
-            }
+            MixStereo(numSamples, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer, volume, leftMusicBuffer, rightMusicBuffer, p, flipStereo);
         } else if (nbHostAudioChannels == 4) {
             for (unsigned i = 0; i < numSamples; i++) {
-                float frontLeftValue = leftFrontBuffer[i]*balanceFactorFrontLeft;
-                float frontRightValue = rightFrontBuffer[i]*balanceFactorFrontRight;
-                float rearLeftValue = leftRearBuffer[i]*balanceFactorRearLeft;
-                float rearRightValue = rightRearBuffer[i]*balanceFactorRearRight;
+                float frontLeftValue = ChannelValue(leftFrontBuffer, leftMusicBuffer, i, volume, balanceFactorFrontLeft);
+                float frontRightValue = ChannelValue(rightFrontBuffer, rightMusicBuffer, i, volume, balanceFactorFrontRight);
+                float rearLeftValue = ChannelValue(leftRearBuffer, NULL, i, volume, balanceFactorRearLeft);
+                float rearRightValue = ChannelValue(rightRearBuffer, NULL, i, volume, balanceFactorRearRight);
 
                 // Check game audio type
                 switch (AudioType) {
@@ -391,34 +416,14 @@ Result OpenAudio(const Util::Config::Node& config)
     bytes_per_sample_host = (nbHostAudioChannels * sizeof(INT16));
     bytes_per_frame_host = (samples_per_frame_host * bytes_per_sample_host);
 
-    // 3. Buffer Allocation
-    // We still need a small temporary mix buffer to interleave L/R samples
-    // before sending them to the Libretro callback.
-    if (audioBuffer) {
-        delete[] audioBuffer;
-        audioBuffer = nullptr;
-    }
-
-    // Allocate enough for roughly one frame of audio (standard is ~735 samples for 60fps)
-    // We'll be safe and allocate 4096 bytes.
-    audioBufferSize = 8192 * bytes_per_sample_host;  // Double the buffer
-    audioBuffer = new(std::nothrow) INT8[audioBufferSize];
-    
-    if (audioBuffer == NULL) {
-        return Result::FAIL;
-    }
-    memset(audioBuffer, 0, audioBufferSize);
-
-    // 4. State initialization. The ring buffer cannot represent full and
-    // empty with identical read/write positions. Seed two silent packets so
-    // the first frontend callback has valid data while it wakes the
-    // asynchronous SoundBoard thread. That thread then replaces the initial
-    // silence with real audio and keeps the buffer filled.
-    playPos = 0;
-    writePos = 2 * bytes_per_frame_host;
-    writeWrapped = false;
-    underRuns = 0;
-    overRuns = 0;
+    // 3. Ring Buffer
+    // Mixed frames wait here until the next retro_run() hands them to the
+    // frontend. The ring starts with two silent packets so the first
+    // frontend callback has valid data while it wakes the asynchronous
+    // SoundBoard thread. That thread then keeps the ring filled.
+    audioRing.Init(8192, nbHostAudioChannels, 2 * samples_per_frame_host);
+    lastFrame[0] = 0;
+    lastFrame[1] = 0;
     shortWrites = 0;
 
     // In Libretro, "starting" audio just means we are ready to accept calls.
@@ -427,98 +432,40 @@ Result OpenAudio(const Util::Config::Node& config)
     return Result::OKAY;
 }
 
-bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, bool flipStereo)
+bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float* rightFrontBuffer, const float* leftRearBuffer, const float* rightRearBuffer, float volume, const float* leftMusicBuffer, const float* rightMusicBuffer, bool flipStereo)
 {
-    INT16* src;
-
     // 1. Bound Check
     if (numSamples > (unsigned)samples_per_frame_host)
         numSamples = samples_per_frame_host;
 
-    // 2. Mix Phase (This is CPU heavy, we do it BEFORE the lock to keep FPS high)
-    // Using a static buffer to avoid stack overflow (Model 3 buffers can be large)
-    static INT16 mixBuffer[NUM_CHANNELS_M3 * 4096]; 
-    MixChannels(numSamples, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer, mixBuffer, flipStereo);
-
-    // 3. Thread Safety: Replace SDL_LockAudio
-    std::lock_guard<std::mutex> lock(s_audioMutex);
+    // 2. Space Check
+    // Only this thread writes to the ring, so the free space can only grow
+    // until the frames are committed below.
+    unsigned freeFrames = audioRing.Free();
+    bool bufferFull = freeFrames < 2 * (unsigned)samples_per_frame_host;
 
-    UINT32 numBytes = numSamples * bytes_per_sample_host;
-    UINT32 playEndPos = playPos + bytes_per_frame_host;
-
-    // Logic for wrap-around and under-run remains identical to preserve your "85% fix"
-    if (playEndPos > writePos && writeWrapped)
-        writePos += audioBufferSize;
-
-    if (playEndPos > writePos)
+    if (freeFrames < numSamples)
     {
-        underRuns++;
-        if (underRunLoop)
-        {
-            playPos = writePos + numBytes + bytes_per_frame_host;
-            if (playPos >= audioBufferSize)
-                playPos -= audioBufferSize;
-            else
-            {
-                writeWrapped = true;
-                writePos += audioBufferSize;
-            }
-        }
-        else
-        {
-            do { writePos += numBytes; } while (playEndPos > writePos);
-        }
+        audioRing.CountOverRun();
+        return true;    // Discarding chunk...
     }
 
-    bool overRun = writePos + numBytes > playPos + audioBufferSize;
-    bool bufferFull = writePos + 2 * bytes_per_frame_host > playPos + audioBufferSize;
-
-    if (writePos >= audioBufferSize)
-        writePos -= audioBufferSize;
-
-    if (overRun)
+    // 3. Mix straight into the ring buffer, in two parts if it wraps around
+    unsigned contiguous;
+    INT16* dst = audioRing.WriteSpan(0, &contiguous);
+    unsigned numSamples1 = std::min(numSamples, contiguous);
+    MixChannels(numSamples1, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer,
+                volume, leftMusicBuffer, rightMusicBuffer, dst, flipStereo);
+    if (numSamples1 < numSamples)
     {
-        overRuns++;
-        bufferFull = true;
-        // Discarding chunk...
-    }
-    else
-    {
-        src = mixBuffer;
-        INT8* dst1;
-        INT8* dst2;
-        UINT32 len1;
-        UINT32 len2;
-
-        if (writePos + numBytes > audioBufferSize)
-        {
-            dst1 = audioBuffer + writePos;
-            dst2 = audioBuffer;
-            len1 = audioBufferSize - writePos;
-            len2 = numBytes - len1;
-        }
-        else
-        {
-            dst1 = audioBuffer + writePos;
-            dst2 = nullptr;
-            len1 = numBytes;
-            len2 = 0;
-        }
-
-        // Copy to ring buffer
-        memcpy(dst1, src, len1);
-        if (len2 > 0 && dst2 != nullptr)
-        {
-            memcpy(dst2, (UINT8*)src + len1, len2);
-        }
-
-        writePos += numBytes;
-        if (writePos >= audioBufferSize)
-        {
-            writePos -= audioBufferSize;
-            writeWrapped = true;
-        }
+        dst = audioRing.WriteSpan(numSamples1, &contiguous);
+        MixChannels(numSamples - numSamples1, leftFrontBuffer + numSamples1, rightFrontBuffer + numSamples1,
+                    leftRearBuffer + numSamples1, rightRearBuffer + numSamples1, volume,
+                    leftMusicBuffer ? leftMusicBuffer + numSamples1 : NULL,
+                    rightMusicBuffer ? rightMusicBuffer + numSamples1 : NULL,
+                    dst, flipStereo);
     }
+    audioRing.Commit(numSamples);
 
     return bufferFull;
 }
@@ -526,6 +473,9 @@ bool OutputAudio(unsigned numSamples, const float* leftFrontBuffer, const float*
 
 void CloseAudio()
 {
+    CAudioRing::Stats stats = audioRing.GetStats();
+    InfoLog("[Supermodel] Audio ring: %u-%u of %u frames queued, %u under-run(s), %u over-run(s).",
+            stats.lowWatermark, stats.highWatermark, stats.capacity, stats.underRuns, stats.overRuns);
     if (shortWrites > 0)
         InfoLog("[Supermodel] Audio frontend reported %u partial batch submission(s); unaccepted ring-buffer frames were preserved.",
                 shortWrites);
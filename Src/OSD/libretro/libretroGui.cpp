@@ -469,6 +469,7 @@ void Libretro_DrawTimingOverlay(const FrameTimings& t,
     coloured((UINT32)gpuMs, 20, 34); ImGui::Text("GPU    : %5.1f ms", gpuMs);       ImGui::PopStyleColor();
     coloured(t.syncTicks,    2,  5); ImGui::Text("Sync   : %3u ms", t.syncTicks);   ImGui::PopStyleColor();
     coloured(t.sndTicks,    10, 20); ImGui::Text("Sound  : %3u ms", t.sndTicks);    ImGui::PopStyleColor();
+    ImGui::Text("  idle : %4uK 68K cycles", t.sndIdleCycles / 1000);
     coloured(t.frameTicks,  20, 34); ImGui::Text("Total  : %3u ms", t.frameTicks);  ImGui::PopStyleColor();
 
     ImGui::Separator();
@@ -226,6 +226,21 @@ static struct retro_core_option_v2_definition option_defs[] = {
       },
       "disabled"
    },
+   {
+      "supermodel_headless",
+      "Headless Rendering",
+      NULL,
+      "Run the emulator without drawing anything and without an OpenGL context, for benchmarking the emulated machine apart from the GPU. 'Scene Traversal' still builds the 3D scene every frame so its cost can be profiled. The frontend keeps showing a blank frame. Takes effect after restarting content.",
+      NULL,
+      "video",
+      {
+         { "disabled",  NULL },
+         { "enabled",   "Enabled" },
+         { "traversal", "Enabled + Scene Traversal" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "supermodel_upscale_mode",
       "2D Layer Upscaling Filter",
@@ -560,6 +575,20 @@ static struct retro_core_option_v2_definition option_defs[] = {
       },
       "new"
    },
+   {
+      "supermodel_music_resampler",
+      "Music Resampler",
+      NULL,
+      "Filter used to convert Digital Sound Board music from 32 KHz to 44.1 KHz. Windowed sinc removes the aliasing of linear interpolation at a small CPU cost. Takes effect after restarting content.",
+      NULL,
+      "audio",
+      {
+         { "sinc",   "Windowed Sinc (Default)" },
+         { "linear", "Linear" },
+         { NULL, NULL },
+      },
+      "sinc"
+   },
    // CPU
    {
       "supermodel_frameskip",
@@ -727,6 +756,16 @@ void update_core_options(void)
 
    g_options.timing_overlay = strcmp(option_get("supermodel_timing_overlay", "disabled"), "enabled") == 0;
 
+   {
+      const char *headless = option_get("supermodel_headless", "disabled");
+      g_options.headless =
+         strcmp(headless, "traversal") == 0
+            ? HeadlessMode::SceneTraversal
+         : strcmp(headless, "enabled") == 0
+            ? HeadlessMode::Enabled
+            : HeadlessMode::Disabled;
+   }
+
    {
       const char *widescreen = option_get(
          "supermodel_wide_screen", "disabled");
@@ -758,6 +797,8 @@ void update_core_options(void)
    g_options.music_volume = atoi(option_get("supermodel_music_volume", "100"));
    g_options.legacy_sound_dsp =
       strcmp(option_get("supermodel_scsp_dsp", "new"), "legacy") == 0;
+   g_options.linear_music_resampler =
+      strcmp(option_get("supermodel_music_resampler", "sinc"), "linear") == 0;
 
    {
       const char *gun_input = option_get("supermodel_gun_input", "hybrid");
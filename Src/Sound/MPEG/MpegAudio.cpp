@@ -25,10 +25,19 @@
 #include "Util/ConfigBuilders.h"
 #include "OSD/Logger.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdio>
+#include <cstring>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 
 /***************************************************************************************************
@@ -67,6 +76,8 @@ struct FileContents
 
 static std::map<uint32_t, CustomTrack> s_custom_tracks_by_mpeg_rom_address;
 
+static void ClearCache();	// decoded tracks, see MPEG Music Playback below
+
 static FileContents LoadFile(const std::string &filepath)
 {
   FILE *fp = fopen(filepath.c_str(), "rb");
@@ -87,6 +98,7 @@ static FileContents LoadFile(const std::string &filepath)
 void MpegDec::LoadCustomTracks(const std::string &music_filepath, const Game &game)
 {
   s_custom_tracks_by_mpeg_rom_address.clear();
+  ClearCache();
 
   if (game.mpeg_board.empty())
   {
@@ -202,29 +214,551 @@ void MpegDec::LoadCustomTracks(const std::string &music_filepath, const Game &ga
 
 /***************************************************************************************************
  MPEG Music Playback
+
+ A worker thread decodes frames ahead of playback. It hands them to the sound thread through a
+ lock-free ring of NUM_AHEAD_FRAMES frames, which is about 430 ms at 32 KHz. DecodeAudio() only
+ copies samples out of the ring. The stream is still exactly what a synchronous decoder would
+ produce:
+
+ - Every frame carries the stream position after it. GetPosition() reports the position of the
+   frame being played, not of the worker.
+ - SetMemory(), UpdateMemory(), SetPosition() and Stop() change what is to be decoded. They bump
+   a generation number, drop the ring and restart the worker from the position of the sound
+   thread. Frames of an older generation that were still being decoded are skipped when popped.
+ - minimp3 carries state from frame to frame: the bit reservoir (at most 511 bytes), the IMDCT
+   overlap and the synthesis filter history. A restarted worker rebuilds it by decoding the last
+   NUM_HISTORY_FRAMES frames that were played again.
+
+ Looping tracks are cached. When a looping stream wraps, the decoder state at the loop point is
+ saved and the frames of the next pass are recorded. If the state is the same when that pass
+ wraps, every later pass decodes to the same samples and the worker plays them from the cache.
+ The cache is limited by SetCacheSize(), evicting the loop played least recently first, and is
+ cleared when custom tracks are loaded for a new game.
 ***************************************************************************************************/
 
+static const int NUM_AHEAD_FRAMES = 12;		// 1152 samples each
+static const int NUM_HISTORY_FRAMES = 8;	// enough to refill the reservoir at 32 Kbit/s
+
+struct FrameRef
+{
+	const uint8_t*	start;
+	int				bytes;			// from start to the end of the buffer
+};
+
+struct Frame
+{
+	unsigned		generation;
+	FrameRef		ref;
+	int				pos;			// stream position after this frame
+	bool			last;			// end of a stream that doesn't loop, silence follows
+	int				numSamples;
+	int				channels;
+	short			pcm[MINIMP3_MAX_SAMPLES_PER_FRAME];
+};
+
+struct Request
+{
+	const uint8_t*	buffer;
+	int				size, pos;
+	bool			loop;
+	bool			active;
+	int				numHistory;
+	FrameRef		history[NUM_HISTORY_FRAMES];
+};
+
+struct CachedFrame
+{
+	FrameRef		ref;
+	int				pos;
+	int				numSamples;
+	int				channels;
+	size_t			offset;			// into LoopCache::pcm
+};
+
+struct LoopCache
+{
+	const uint8_t*				buffer;
+	int							size;
+	mp3dec_t					loopState;
+	std::vector<CachedFrame>	frames;
+	std::vector<short>			pcm;
+	bool						complete;
+	bool						tooLarge;	// not recorded again
+	uint64_t					lastUsed;
+
+	size_t Bytes() const
+	{
+		return sizeof(LoopCache) + frames.size()*sizeof(CachedFrame) + pcm.size()*sizeof(short);
+	}
+};
+
+// minimp3 state that matters for decoding the next frame
+static bool SameState(const mp3dec_t &a, const mp3dec_t &b)
+{
+	return memcmp(&a, &b, offsetof(mp3dec_t, reserv_buf)) == 0 && memcmp(a.reserv_buf, b.reserv_buf, a.reserv) == 0;
+}
+
+class CDecodeAhead
+{
+public:
+	// Sound thread
+	void			Restart(const Request &request, bool wait);
+	const Frame&	Front();
+	void			Pop();
+
+	void			SetCacheSize(size_t bytes);
+	void			ClearCache();
+
+	~CDecodeAhead();
+
+private:
+	// Worker thread
+	void			WorkerMain();
+	void			Start(const Request &request);
+	void			DecodeNext(Frame &frame);
+	void			LoopPoint();
+	void			Record(const Frame &frame);
+	void			RemoveCache(LoopCache *cache);
+	bool			MakeRoom(size_t bytes);
+
+	std::thread					m_thread;
+	std::mutex					m_mutex;
+	std::condition_variable		m_workCond;
+	std::condition_variable		m_readyCond;
+
+	Frame						m_ring[NUM_AHEAD_FRAMES];
+	std::atomic<unsigned>		m_head		{ 0 };		// written by the worker only
+	std::atomic<unsigned>		m_tail		{ 0 };		// written by the sound thread only
+	std::atomic<unsigned>		m_generation{ 0 };
+
+	// Protected by m_mutex
+	Request						m_request{};
+	size_t						m_cacheLimit	= 64*0x100000;
+	bool						m_clearCache	= false;
+	unsigned					m_started		= 0;		// last generation the worker picked up
+	bool						m_quit			= false;
+
+	// Worker state
+	mp3dec_t					m_mp3d;
+	const uint8_t*				m_buffer		= nullptr;
+	int							m_size			= 0;
+	int							m_pos			= 0;
+	bool						m_loop			= false;
+	bool						m_active		= false;
+	size_t						m_limit			= 0;
+	size_t						m_cacheBytes	= 0;
+	uint64_t					m_clock			= 0;
+	std::list<LoopCache>		m_caches;
+	LoopCache*					m_playing		= nullptr;
+	size_t						m_cursor		= 0;
+	LoopCache*					m_recording		= nullptr;
+	short						m_scratch[MINIMP3_MAX_SAMPLES_PER_FRAME];
+};
+
+void CDecodeAhead::Restart(const Request &request, bool wait)
+{
+	unsigned generation;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_request = request;
+		generation = m_generation.fetch_add(1, std::memory_order_release) + 1;
+		if (!m_thread.joinable()) {
+			m_thread = std::thread(&CDecodeAhead::WorkerMain, this);
+		}
+	}
+
+	// drop everything decoded so far, frames still in flight are skipped by Front()
+	m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+	m_workCond.notify_one();
+
+	if (wait) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_readyCond.wait(lock, [&] { return m_started == generation; });
+	}
+}
+
+const Frame& CDecodeAhead::Front()
+{
+	unsigned generation = m_generation.load(std::memory_order_relaxed);
+
+	for (;;) {
+
+		unsigned tail = m_tail.load(std::memory_order_relaxed);
+
+		if (m_head.load(std::memory_order_acquire) == tail) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_readyCond.wait(lock, [&] { return m_head.load(std::memory_order_acquire) != tail; });
+		}
+
+		const Frame &frame = m_ring[tail % NUM_AHEAD_FRAMES];
+		if (frame.generation == generation) {
+			return frame;
+		}
+
+		Pop();
+	}
+}
+
+void CDecodeAhead::Pop()
+{
+	unsigned tail = m_tail.load(std::memory_order_relaxed) + 1;
+	m_tail.store(tail, std::memory_order_release);
+
+	// a full ring is only refilled once it is half empty, so the sound thread rarely has to wake
+	// the worker up
+	if (m_head.load(std::memory_order_acquire) - tail == NUM_AHEAD_FRAMES / 2) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);	// so the worker can't miss the wake up
+		}
+		m_workCond.notify_one();
+	}
+}
+
+void CDecodeAhead::SetCacheSize(size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_cacheLimit = bytes;
+}
+
+void CDecodeAhead::ClearCache()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_clearCache = true;
+}
+
+CDecodeAhead::~CDecodeAhead()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+
+	m_workCond.notify_one();
+
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+}
+
+void CDecodeAhead::WorkerMain()
+{
+	unsigned generation = 0;
+	unsigned limit = NUM_AHEAD_FRAMES;	// once the ring is full, wait until it is half empty
+
+	for (;;) {
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_workCond.wait(lock, [&] {
+				return m_quit
+					|| m_generation.load(std::memory_order_relaxed) != generation
+					|| (m_active && m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_acquire) < limit);
+			});
+
+			if (m_quit) {
+				return;
+			}
+
+			if (m_generation.load(std::memory_order_relaxed) != generation) {
+				generation = m_generation.load(std::memory_order_relaxed);
+				Request request = m_request;
+				if (m_clearCache) {
+					m_playing = nullptr;
+					m_recording = nullptr;
+					m_caches.clear();
+					m_cacheBytes = 0;
+					m_clearCache = false;
+				}
+				m_limit = m_cacheLimit;
+				limit = NUM_AHEAD_FRAMES;
+				lock.unlock();
+				Start(request);
+				lock.lock();
+				m_started = generation;
+				lock.unlock();
+				m_readyCond.notify_one();
+				continue;
+			}
+		}
+
+		unsigned head = m_head.load(std::memory_order_relaxed);
+		Frame &frame = m_ring[head % NUM_AHEAD_FRAMES];
+		DecodeNext(frame);
+		frame.generation = generation;
+		m_head.store(head + 1, std::memory_order_release);
+
+		unsigned queued = head + 1 - m_tail.load(std::memory_order_acquire);
+		limit = queued >= NUM_AHEAD_FRAMES ? NUM_AHEAD_FRAMES / 2 + 1 : NUM_AHEAD_FRAMES;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+		}
+		m_readyCond.notify_one();
+	}
+}
+
+void CDecodeAhead::Start(const Request &request)
+{
+	// a cached loop can't be left mid-way without decoding, and a partial recording is useless
+	m_playing = nullptr;
+	if (m_recording && !m_recording->complete) {
+		RemoveCache(m_recording);
+	}
+	m_recording = nullptr;
+
+	while (m_cacheBytes > m_limit && MakeRoom(m_cacheBytes - m_limit)) {
+	}
+
+	mp3dec_init(&m_mp3d);
+
+	for (int i = 0; request.active && i < request.numHistory; i++) {
+		mp3dec_frame_info_t info;
+		mp3dec_decode_frame(&m_mp3d, request.history[i].start, request.history[i].bytes, m_scratch, &info);
+	}
+
+	m_buffer	= request.buffer;
+	m_size		= request.size;
+	m_pos		= request.pos;
+	m_loop		= request.loop;
+	m_active	= request.active;
+}
+
+void CDecodeAhead::DecodeNext(Frame &frame)
+{
+	frame.last = false;
+
+	if (m_playing) {
+
+		const CachedFrame &cached = m_playing->frames[m_cursor];
+
+		frame.ref			= cached.ref;
+		frame.pos			= cached.pos;
+		frame.numSamples	= cached.numSamples;
+		frame.channels		= cached.channels;
+		memcpy(frame.pcm, &m_playing->pcm[cached.offset], cached.numSamples * cached.channels * sizeof(short));
+
+		m_pos = cached.pos;
+
+		if (++m_cursor == m_playing->frames.size()) {
+			m_cursor = 0;
+			m_playing->lastUsed = ++m_clock;
+		}
+		return;
+	}
+
+	mp3dec_frame_info_t info;
+
+	frame.ref.start		= m_buffer + m_pos;
+	frame.ref.bytes		= std::max(0, m_size - m_pos);
+	frame.numSamples	= mp3dec_decode_frame(&m_mp3d, frame.ref.start, frame.ref.bytes, frame.pcm, &info);
+	frame.channels		= info.channels;
+
+	m_pos += info.frame_bytes;
+
+	// check end of buffer handling
+	bool wrapped = false;
+	if (m_pos >= m_size - HDR_SIZE) {
+		if (m_loop) {
+			m_pos = 0;
+			wrapped = true;
+		}
+		else {
+			frame.last = true;
+		}
+	}
+	else if (info.frame_bytes == 0) {
+		frame.last = true;		// nothing decodable left
+	}
+
+	frame.pos = m_pos;
+	m_active = !frame.last;
+
+	if (m_recording) {
+		Record(frame);
+	}
+
+	if (wrapped) {
+		LoopPoint();
+	}
+}
+
+void CDecodeAhead::LoopPoint()
+{
+	if (m_recording) {
+		if (SameState(m_recording->loopState, m_mp3d)) {
+			// every further pass will be the same
+			m_recording->complete = true;
+			m_recording->lastUsed = ++m_clock;
+			m_playing	= m_recording;
+			m_cursor	= 0;
+			m_recording	= nullptr;
+		}
+		else {
+			// not settled yet, e.g. the first pass started from a different frame
+			m_cacheBytes -= m_recording->Bytes();
+			m_recording->frames.clear();
+			m_recording->pcm.clear();
+			m_cacheBytes += m_recording->Bytes();
+			m_recording->loopState = m_mp3d;
+		}
+		return;
+	}
+
+	if (m_limit == 0) {
+		return;
+	}
+
+	for (auto &cache: m_caches) {
+		if (cache.buffer == m_buffer && cache.size == m_size) {
+			if (cache.complete && SameState(cache.loopState, m_mp3d)) {
+				cache.lastUsed = ++m_clock;
+				m_playing	= &cache;
+				m_cursor	= 0;
+			}
+			return;
+		}
+	}
+
+	if (!MakeRoom(sizeof(LoopCache))) {
+		return;
+	}
+
+	m_caches.emplace_back();
+	m_recording = &m_caches.back();
+	m_recording->buffer		= m_buffer;
+	m_recording->size		= m_size;
+	m_recording->loopState	= m_mp3d;
+	m_recording->complete	= false;
+	m_recording->tooLarge	= false;
+	m_recording->lastUsed	= ++m_clock;
+	m_cacheBytes += m_recording->Bytes();
+}
+
+void CDecodeAhead::Record(const Frame &frame)
+{
+	size_t numSamples = frame.numSamples * frame.channels;
+
+	if (!MakeRoom(sizeof(CachedFrame) + numSamples * sizeof(short))) {
+		// give up on this loop for good, it will never fit
+		m_cacheBytes -= m_recording->Bytes();
+		m_recording->frames = std::vector<CachedFrame>();
+		m_recording->pcm = std::vector<short>();
+		m_recording->tooLarge = true;
+		m_cacheBytes += m_recording->Bytes();
+		m_recording = nullptr;
+		return;
+	}
+
+	m_recording->frames.push_back({ frame.ref, frame.pos, frame.numSamples, frame.channels, m_recording->pcm.size() });
+	m_recording->pcm.insert(m_recording->pcm.end(), frame.pcm, frame.pcm + numSamples);
+	m_cacheBytes += sizeof(CachedFrame) + numSamples * sizeof(short);
+}
+
+void CDecodeAhead::RemoveCache(LoopCache *cache)
+{
+	m_cacheBytes -= cache->Bytes();
+	m_caches.remove_if([cache](const LoopCache &c) { return &c == cache; });
+}
+
+// evicts loops until bytes more fit, false if they can't
+bool CDecodeAhead::MakeRoom(size_t bytes)
+{
+	while (m_cacheBytes + bytes > m_limit) {
+
+		LoopCache *oldest = nullptr;
+
+		for (auto &cache: m_caches) {
+			if (&cache != m_playing && &cache != m_recording && !cache.tooLarge && (!oldest || cache.lastUsed < oldest->lastUsed)) {
+				oldest = &cache;
+			}
+		}
+
+		if (!oldest) {
+			return false;
+		}
+
+		RemoveCache(oldest);
+	}
+
+	return true;
+}
+
+static CDecodeAhead s_decodeAhead;
+
 struct Decoder
 {
-	mp3dec_t			mp3d;
-	mp3dec_frame_info_t	info;
 	const uint8_t*		buffer;
 	int					size, pos;
 	bool				loop;
 	bool				stopped;
+	bool				ended;		// played the last frame of a stream that doesn't loop
 	int					numSamples;
+	int					channels;
 	int					pcmPos;
 	short				pcm[MINIMP3_MAX_SAMPLES_PER_FRAME];
+	int					numHistory;
+	FrameRef			history[NUM_HISTORY_FRAMES];	// most recent last
 
 	std::shared_ptr<uint8_t>  custom_mpeg_data;
 };
 
 static Decoder dec{};
 
-void MpegDec::SetMemory(const uint8_t *data, int offset, int length, bool loop)
+// restarts decode-ahead from what is playing now, waiting makes sure the worker is done with
+// the old data
+static void Restart(bool keepHistory, bool wait = false)
+{
+	if (!keepHistory) {
+		dec.numHistory = 0;
+	}
+
+	dec.ended = false;
+
+	Request request;
+	request.buffer		= dec.buffer;
+	request.size		= dec.size;
+	request.pos			= dec.pos;
+	request.loop		= dec.loop;
+	request.active		= dec.buffer && !dec.stopped;
+	request.numHistory	= dec.numHistory;
+	std::copy(dec.history, dec.history + dec.numHistory, request.history);
+
+	s_decodeAhead.Restart(request, wait);
+}
+
+static void NextFrame()
+{
+	const Frame &frame = s_decodeAhead.Front();
+
+	memcpy(dec.pcm, frame.pcm, frame.numSamples * frame.channels * sizeof(short));
+	dec.numSamples	= frame.numSamples;
+	dec.channels	= frame.channels;
+	dec.pcmPos		= 0;
+	dec.pos			= frame.pos;
+	dec.ended		= frame.last;
+
+	if (dec.numHistory == NUM_HISTORY_FRAMES) {
+		std::copy(dec.history + 1, dec.history + NUM_HISTORY_FRAMES, dec.history);
+		dec.numHistory--;
+	}
+	dec.history[dec.numHistory++] = frame.ref;
+
+	s_decodeAhead.Pop();
+}
+
+static void ClearCache()
+{
+	s_decodeAhead.ClearCache();
+}
+
+void MpegDec::SetCacheSize(size_t bytes)
 {
-  mp3dec_init(&dec.mp3d);
+	s_decodeAhead.SetCacheSize(bytes);
+}
 
+void MpegDec::SetMemory(const uint8_t *data, int offset, int length, bool loop)
+{
   auto it = s_custom_tracks_by_mpeg_rom_address.find(offset);
   if (it == s_custom_tracks_by_mpeg_rom_address.end()) {
     // MPEG ROM
@@ -254,12 +788,19 @@ void MpegDec::SetMemory(const uint8_t *data, int offset, int length, bool loop)
   dec.loop        = loop;
   dec.stopped     = false;
 
+  // fresh decoder state
+  Restart(false);
+
 	// Uncomment this line to print out track offsets in the MPEG ROM
 	//printf("MPEG: Set memory: %08x\n", offset);
 }
 
 void MpegDec::UpdateMemory(const uint8_t* data, int offset, int length, bool loop)
 {
+  const uint8_t *oldBuffer = dec.buffer;
+  int oldSize = dec.size;
+  bool oldLoop = dec.loop;
+
   auto it = s_custom_tracks_by_mpeg_rom_address.find(offset);
   if (it == s_custom_tracks_by_mpeg_rom_address.end()) {
     // MPEG ROM
@@ -304,6 +845,11 @@ void MpegDec::UpdateMemory(const uint8_t* data, int offset, int length, bool loo
 
 	dec.loop	= loop;
 
+	// Games write the same loop points over and over, only a different stream needs a restart
+	if (dec.buffer != oldBuffer || dec.size != oldSize || dec.loop != oldLoop) {
+		Restart(true);
+	}
+
 	// Uncomment this line to print out track offsets in the MPEG ROM
 	//printf("MPEG: Update memory: %08x\n", offset);
 }
@@ -316,11 +862,12 @@ int MpegDec::GetPosition()
 void MpegDec::SetPosition(int pos)
 {
 	dec.pos = pos;
+	Restart(true);
 }
 
 static void FlushBuffer(int16_t*& left, int16_t*& right, int& numStereoSamples)
 {
-	int numChans = dec.info.channels;
+	int numChans = dec.channels;
 
 	int &i = dec.pcmPos;
 
@@ -342,14 +889,10 @@ static void EndWithSilence(int16_t*& left, int16_t*& right, int& numStereoSample
 	}
 }
 
-static bool EndOfBuffer()
-{
-	return dec.pos >= dec.size - HDR_SIZE;
-}
-
 void MpegDec::Stop()
 {
 	dec.stopped = true;
+	Restart(true, true);
 }
 
 bool MpegDec::IsLoaded()
@@ -369,28 +912,12 @@ void MpegDec::DecodeAudio(int16_t* left, int16_t* right, int numStereoSamples)
 
 	while (numStereoSamples) {
 
-		dec.numSamples = mp3dec_decode_frame(
-			&dec.mp3d,
-			dec.buffer + dec.pos,
-			dec.size - dec.pos,
-			dec.pcm,
-			&dec.info);
-
-		dec.pos += dec.info.frame_bytes;
-		dec.pcmPos = 0;	// reset pos
-
-		FlushBuffer(left, right, numStereoSamples);
-
-		// check end of buffer handling
-		if (EndOfBuffer()) {
-			if (dec.loop) {
-				dec.pos = 0;
-			}
-			else {
-				EndWithSilence(left, right, numStereoSamples);
-			}
+		if (dec.ended) {
+			EndWithSilence(left, right, numStereoSamples);
+			break;
 		}
 
+		NextFrame();
+		FlushBuffer(left, right, numStereoSamples);
 	}
-
 }
@@ -2,6 +2,7 @@
 #define _MPEG_AUDIO_H_
 
 #include "Game.h"
+#include <cstddef>
 #include <cstdint>
 
 
@@ -15,6 +16,9 @@ namespace MpegDec
 	void	DecodeAudio(int16_t* left, int16_t* right, int numStereoSamples);
 	void	Stop();
 	bool	IsLoaded();
+
+	// Memory for decoded loops of looping tracks, 0 disables caching
+	void	SetCacheSize(size_t bytes);
 }
 
 #endif
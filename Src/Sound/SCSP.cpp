@@ -38,6 +38,16 @@
  * out, or there may be a UART with a large FIFO buffer. This can be simulated
  * by increasing the MIDI buffer (MIDI_STACK_SIZE).
  *
+ * Slot Mixer
+ * ----------
+ * Each sample is made in two passes. SCSP_UpdateSlot() runs slot by slot, in
+ * the hardware order, because FM slots read the ring buffer that earlier slots
+ * have just written. Its results go to a per-slot array (MixSample[]) and
+ * SCSP_MixSlots() then applies balance, pan and send levels to all 32 slots at
+ * once with SIMD, using gains that are looked up in the pan tables when the
+ * slot registers are written rather than for every sample. The integer maths
+ * is the same as mixing slot by slot, so the output is bit-exact.
+ *
  * To-Do List
  * ----------
  * - Wrap up into an object. Remove any unused #ifdef pathways.
@@ -68,6 +78,7 @@ Anyways credit to R. Belmont and ElSemi for the code, and for being awesome emul
 #include "Supermodel.h"
 #include "SCSPDSP.h"
 #include "OSD/Thread.h"
+#include "Util/SIMD.h"
 
 
 #include <cstdio>
@@ -76,7 +87,7 @@ Anyways credit to R. Belmont and ElSemi for the code, and for being awesome emul
 #include <cmath>
 
 
-static const Util::Config::Node *s_config = 0;
+static Util::Config::Setting<float> s_balance;
 static bool s_multiThreaded = false;
 bool legacySound; // For LegacySound (SCSP DSP) config option.
 
@@ -158,6 +169,17 @@ static int RPANTABLE[0x10000];
 static int TimPris[3];
 static int TimCnt[3];
 
+// Timers only count samples, so rather than being stepped every sample they
+// are brought up to date when read or written, and at the next overflow.
+static UINT32 SampleClock;	// samples generated since reset
+static UINT32 TimClock[3];	// SampleClock at which TimCnt[] was last brought up to date
+static UINT32 TimerEvent;	// SampleClock of the next overflow
+static bool TimerEventPending;
+static bool IrqDirty;		// inputs of CheckPendingIRQ() may have changed
+
+static void SCSP_TimersSync();
+static void SCSP_TimersSchedule();
+
 #define SHIFT	12
 #define FIX(v)	((UINT32) ((float) (1<<SHIFT)*(v)))
 
@@ -322,6 +344,14 @@ struct _SCSP
 #endif
 
 	int ARTABLE[64], DRTABLE[64];
+
+	// Slot mixer, structure of arrays indexed by slot (see SCSP_MixSlots())
+	alignas(32) INT32 MixSample[32];	// SCSP_UpdateSlot() result of the current sample, 0 if inactive
+	alignas(32) INT32 MixDirectL[32];	// direct send gains, LPANTABLE/RPANTABLE[TL|DIPAN|DISDL]
+	alignas(32) INT32 MixDirectR[32];
+	alignas(32) INT32 MixDSP[32];		// DSP send gain, LPANTABLE[TL|IMXL]
+	alignas(32) INT32 MixDSPIn[32];		// DSP inputs of the current sample
+	BYTE MixISEL[32];					// MIXS register each slot feeds
 } SCSPs[MAX_SCSP],*SCSP=SCSPs;
 
 static signed short *RBUFDST;	//this points to where the sample will be stored in the RingBuf
@@ -347,6 +377,8 @@ void CheckPendingIRQ()
 	DWORD pend=SCSPs->data[0x20/2];
 	DWORD en=SCSPs->data[0x1e/2];
 
+	IrqDirty = false;
+
 	/*
 	 * MIDI FIFO critical section
 	 *
@@ -395,6 +427,7 @@ void CheckPendingIRQ()
 	{
 		irqLevel = (IrqMidi > irqLevel) ? IrqMidi : irqLevel;
 		SCSP->data[0x20 / 2] &= ~8;
+		IrqDirty = true;	// only raised for one sample
 	}
 
 	Int68kCB(irqLevel);
@@ -588,11 +621,23 @@ void SCSP_StopSlot(_SLOT *slot,int keyoff)
 	//DebugLog("KEYOFF2 %d",slot->slot);
 }
 
+// Looks up the mixer gains of a slot, must follow any change of TL, IMXL, ISEL, DISDL or DIPAN
+void SCSP_UpdateSlotMix(_SCSP *scsp, int s)
+{
+	const _SLOT *slot = scsp->Slots + s;
+	UINT16 Enc = ((TL(slot)) << 0x0) | ((DIPAN(slot)) << 0x8) | ((DISDL(slot)) << 0xd);
+	scsp->MixDirectL[s] = LPANTABLE[Enc];
+	scsp->MixDirectR[s] = RPANTABLE[Enc];
+	Enc = ((TL(slot)) << 0x0) | ((IMXL(slot)) << 0xd);
+	scsp->MixDSP[s] = LPANTABLE[Enc];
+	scsp->MixISEL[s] = ISEL(slot);
+}
+
 //#define log2(n) (log((float) n)/log((float) 2))
 
 Result SCSP_Init(const Util::Config::Node &config, int n)
 {
-	s_config = &config;
+	s_balance = Util::Config::Setting<float>(config, "Balance");
 	s_multiThreaded = config["MultiThreaded"].ValueAs<bool>();
 	legacySound = config["LegacySoundDSP"].ValueAs<bool>();
 
@@ -752,6 +797,10 @@ Result SCSP_Init(const Util::Config::Node &config, int n)
 	TimCnt[0] = 0xffff;
 	TimCnt[1] = 0xffff;
 	TimCnt[2] = 0xffff;
+	SampleClock = 0;
+	memset(TimClock, 0, sizeof(TimClock));
+	TimerEventPending = false;
+	IrqDirty = true;
 
 	// MIDI FIFO mutex
 	MIDILock = CThread::CreateMutex();
@@ -811,11 +860,20 @@ void SCSP_UpdateSlotReg(int s,int r)
 	case 0x13:
 		Compute_LFO(slot);
 		break;
+	case 0xC:
+	case 0xD:
+	case 0x14:
+	case 0x15:
+	case 0x16:
+	case 0x17:
+		SCSP_UpdateSlotMix(SCSP, s);
+		break;
 	}
 }
 
 void SCSP_UpdateReg(int reg)
 {
+	IrqDirty = true;
 	switch(reg&0x3f)
 	{
 		case 0x0: // Need to get this working in Supermodel as well
@@ -859,6 +917,8 @@ void SCSP_UpdateReg(int reg)
 			{
 				TimPris[0]=1<<((SCSPs->data[0x18/2]>>8)&0x7);
 				TimCnt[0]=((SCSPs->data[0x18/2]&0xfe)<<8)/*|(TimCnt[0]&0xff)*/;
+				TimClock[0]=SampleClock;
+				SCSP_TimersSchedule();
 			}
 			break;
 		case 0x1a:
@@ -867,6 +927,8 @@ void SCSP_UpdateReg(int reg)
 			{
 				TimPris[1]=1<<((SCSPs->data[0x1A/2]>>8)&0x7);
 				TimCnt[1]=((SCSPs->data[0x1A/2]&0xfe)<<8)/*|(TimCnt[1]&0xff)*/;
+				TimClock[1]=SampleClock;
+				SCSP_TimersSchedule();
 			}
 			break;
 		case 0x1C:
@@ -875,6 +937,8 @@ void SCSP_UpdateReg(int reg)
 			{
 				TimPris[2]=1<<((SCSPs->data[0x1C/2]>>8)&0x7);
 				TimCnt[2]=((SCSPs->data[0x1C/2]&0xfe)<<8)/*|(TimCnt[2]&0xff)*/;
+				TimClock[2]=SampleClock;
+				SCSP_TimersSchedule();
 			}
 			break;
 		case 0x22:	//SCIRE
@@ -982,14 +1046,12 @@ void SCSP_UpdateRegR(int reg)
 	break;
 	case 0x18:
 	case 0x19:
-		break;
-
 	case 0x1a:
 	case 0x1b:
-		break;
-
 	case 0x1c:
 	case 0x1d:
+		if (SCSP->Master)
+			SCSP_TimersSync();
 		break;
 
 	case 0x2a:
@@ -1019,6 +1081,8 @@ void SCSP_w8(unsigned int addr,unsigned char val)
 	}
 	else if(addr<0x600)
 	{
+		if(SCSP->Master)
+			SCSP_TimersSync();	// the timer registers hold the counters
 		*(unsigned char *) &(SCSP->datab[(addr&0xff)^1]) = val;
 		SCSP_UpdateReg((addr^1)&0xff);
 	}
@@ -1034,7 +1098,10 @@ void SCSP_w8(unsigned int addr,unsigned char val)
 			else if (addr < 0x7C0)
 				((unsigned char *)SCSP->DSP.MADRS)[(addr - 0x780) ^ 1] = val;
 			else if (addr >= 0x800 && addr < 0xC00)
+			{
 				((unsigned char *)SCSP->DSP.MPRO)[(addr - 0x800) ^ 1] = val;
+				SCSP->DSP.ProgramDirty = true;
+			}
 			else
 				int a = 1;
 			if (addr == 0xBF0)
@@ -1054,7 +1121,10 @@ void SCSP_w8(unsigned int addr,unsigned char val)
 			else if (addr < 0x800)
 				((unsigned char *)SCSP->DSP.MADRS)[(addr - 0x7c0) ^ 1] = val;
 			else if (addr < 0xC00)
+			{
 				((unsigned char *)SCSP->DSP.MPRO)[(addr - 0x800) ^ 1] = val;
+				SCSP->DSP.ProgramDirty = true;
+			}
 			else
 				int a = 1;
 			if (addr == 0xBF0)
@@ -1085,6 +1155,8 @@ void SCSP_w16(unsigned int addr,unsigned short val)
 		SCSP_UpdateReg(addr&0xff);*/
 		if (addr < 0x430)
 		{
+			if (SCSP->Master)
+				SCSP_TimersSync();	// the timer registers hold the counters
 			*((unsigned short *)(SCSP->datab + ((addr & 0x3f)))) = val;
 			SCSP_UpdateReg(addr & 0x3f);
 		}
@@ -1101,7 +1173,10 @@ void SCSP_w16(unsigned int addr,unsigned short val)
 			else if (addr < 0x800)
 				*(unsigned short *) &(SCSP->DSP.MADRS[(addr - 0x780) / 2]) = val;
 			else if (addr < 0xC00)
+			{
 				*(unsigned short *) &(SCSP->DSP.MPRO[(addr - 0x800) / 2]) = val;
+				SCSP->DSP.ProgramDirty = true;
+			}
 			else
 				int a = 1;
 			if (addr == 0xBF0)
@@ -1121,6 +1196,7 @@ void SCSP_w16(unsigned int addr,unsigned short val)
 			else if (addr < 0xC00)
 			{
 				*((UINT16 *)(SCSP->DSP.MPRO + (addr - 0x800) / 2)) = val;
+				SCSP->DSP.ProgramDirty = true;
 			}
 			else
 				int a = 1;
@@ -1151,6 +1227,8 @@ void SCSP_w32(unsigned int addr,unsigned int val)
 	{
 		rotl(val, 16);
 
+		if(SCSP->Master)
+			SCSP_TimersSync();	// the timer registers hold the counters
 		*(unsigned int *) &(SCSP->datab[addr&0xff]) = val;
 		SCSP_UpdateReg(addr&0xff);
 		SCSP_UpdateReg((addr&0xff)+2);
@@ -1169,7 +1247,10 @@ void SCSP_w32(unsigned int addr,unsigned int val)
 			else if (addr < 0x800) // MADRS is mirrored twice
 				*(unsigned int *) &(SCSP->DSP.MADRS[(addr-0x7c0)/2]) = val;
 			else if(addr<0xC00)
+			{
 				*(unsigned int *) &(SCSP->DSP.MPRO[(addr-0x800)/2])=val;
+				SCSP->DSP.ProgramDirty = true;
+			}
 			else
 				int a=1;
 			if(addr==0xBF0)
@@ -1278,63 +1359,58 @@ unsigned int SCSP_r32(unsigned int addr)
 
 #define REVSIGN(v) ((~v)+1)
 
-void SCSP_TimersAddTicks(int ticks)
+/*
+ * Brings the timer counters (and their registers) up to date with SampleClock.
+ * A timer counts up by 1 << (8 - prescale) per sample until it passes 0xFF00,
+ * where it stops at 0xFFFF and raises its pending bit.
+ */
+static void SCSP_TimersSync()
 {
-	if (TimCnt[0] <= 0xff00)
+	for (int i = 0; i < 3; ++i)
 	{
-		TimCnt[0] += ticks << (8 - ((SCSPs->data[0x18 / 2] >> 8) & 0x7));
-		if (TimCnt[0] > 0xFF00)
+		UINT32 ticks = SampleClock - TimClock[i];
+		TimClock[i] = SampleClock;
+		if (ticks == 0 || TimCnt[i] > 0xff00)
+			continue;
+
+		WORD *reg = &SCSPs->data[(0x18 / 2) + i];
+		UINT64 cnt = TimCnt[i] + ((UINT64)ticks << (8 - ((*reg >> 8) & 0x7)));
+		if (cnt > 0xFF00)
 		{
-			TimCnt[0] = 0xFFFF;
-			SCSPs->data[0x20 / 2] |= 0x40;
+			TimCnt[i] = 0xFFFF;
+			SCSPs->data[0x20 / 2] |= 0x40 << i;
+			IrqDirty = true;
 		}
-		SCSPs->data[0x18 / 2] &= 0xff00;
-		SCSPs->data[0x18 / 2] |= TimCnt[0] >> 8;
-	}
-
-	if (TimCnt[1] <= 0xff00)
-	{
-		TimCnt[1] += ticks << (8 - ((SCSPs->data[0x1a / 2] >> 8) & 0x7));
-		if (TimCnt[1] > 0xFF00)
-		{
-			TimCnt[1] = 0xFFFF;
-			SCSPs->data[0x20 / 2] |= 0x80;
-		}
-		SCSPs->data[0x1a / 2] &= 0xff00;
-		SCSPs->data[0x1a / 2] |= TimCnt[1] >> 8;
+		else
+			TimCnt[i] = (int)cnt;
+		*reg &= 0xff00;
+		*reg |= TimCnt[i] >> 8;
 	}
+}
 
-	if (TimCnt[2] <= 0xff00)
+// Finds the sample at which the next timer overflows, TimCnt[] must be up to date
+static void SCSP_TimersSchedule()
+{
+	TimerEventPending = false;
+	for (int i = 0; i < 3; ++i)
 	{
-		TimCnt[2] += ticks << (8 - ((SCSPs->data[0x1c / 2] >> 8) & 0x7));
-		if (TimCnt[2] > 0xFF00)
-		{
-			TimCnt[2] = 0xFFFF;
-			SCSPs->data[0x20 / 2] |= 0x100;
-		}
-		SCSPs->data[0x1c / 2] &= 0xff00;
-		SCSPs->data[0x1c / 2] |= TimCnt[2] >> 8;
+		if (TimCnt[i] > 0xff00)
+			continue;
+		UINT32 inc = 1 << (8 - ((SCSPs->data[(0x18 / 2) + i] >> 8) & 0x7));
+		UINT32 due = TimClock[i] + (0xff00 - TimCnt[i]) / inc + 1;
+		if (!TimerEventPending || (INT32)(due - TimerEvent) < 0)
+			TimerEvent = due;
+		TimerEventPending = true;
 	}
 }
 
 
-signed int inline SCSP_UpdateSlot(_SLOT *slot)
+// Interpolated waveform sample at the current play address, including FM and
+// the SBCTL bit inversions
+static inline signed int SCSP_SlotSample(const _SLOT *slot)
 {
 	signed int sample;
-	int step = slot->step;
-	DWORD addr1, addr2, addr_select;
-	DWORD *addr[2] = { &addr1, &addr2 };
-	DWORD *slot_addr[2] = { &(slot->cur_addr), &(slot->nxt_addr) };
-
-
-	if (SSCTL(slot) != 0)
-		return 0;
-
-	if (PLFOS(slot) != 0)
-	{
-		step = step * PLFO_Step(&(slot->PLFO));
-		step >>= (SHIFT);
-	}
+	DWORD addr1, addr2;
 
 	if (PCM8B(slot)) {
 		addr1 = slot->cur_addr >> SHIFT;
@@ -1401,6 +1477,35 @@ signed int inline SCSP_UpdateSlot(_SLOT *slot)
 	if (SBCTL(slot) & 0x2)
 		sample = (INT16)(sample ^ 0x8000);
 
+	return sample;
+}
+
+signed int inline SCSP_UpdateSlot(_SLOT *slot)
+{
+	signed int sample;
+	int step = slot->step;
+	DWORD addr1, addr2, addr_select;
+	DWORD *addr[2] = { &addr1, &addr2 };
+	DWORD *slot_addr[2] = { &(slot->cur_addr), &(slot->nxt_addr) };
+
+
+	if (SSCTL(slot) != 0)
+		return 0;
+
+	// Once the envelope attenuates to nothing, it can only fall further until
+	// the next key on (everything but ATTACK decays), so whatever the waveform
+	// the slot outputs 0. It still has to play on for the loop points, LFOs
+	// and envelope.
+	bool silent = !SDIR(slot) && slot->EG.state != ATTACK && EG_TABLE[slot->EG.volume >> EG_SHIFT] == 0;
+
+	if (PLFOS(slot) != 0)
+	{
+		step = step * PLFO_Step(&(slot->PLFO));
+		step >>= (SHIFT);
+	}
+
+	sample = silent ? 0 : SCSP_SlotSample(slot);
+
 	if (slot->Back)
 		slot->cur_addr -= step;
 	else
@@ -1506,6 +1611,89 @@ void SCSP_CpuRunScanline()
 
 }
 
+#if defined(SUPERMODEL_SIMD_SSE2) && !defined(SUPERMODEL_SIMD_AVX2)
+// Low 32 bits of 32x32-bit products (SSE4.1 _mm_mullo_epi32)
+static inline __m128i MulLo32(__m128i a, __m128i b)
+{
+	__m128i even = _mm_mul_epu32(a, b);
+	__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+static inline int HorizontalSum(__m128i v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(v);
+}
+#endif
+
+/*
+ * Mixes the slot outputs of one sample (MixSample[]) into the direct outputs
+ * and the DSP inputs. Inactive slots have a sample of 0 and contribute
+ * nothing, so all 32 slots are processed without branching.
+ */
+static inline void SCSP_MixSlots(_SCSP *scsp, float balance, signed int *outL, signed int *outR)
+{
+#if defined(SUPERMODEL_SIMD_AVX2)
+	const __m256 bal = _mm256_set1_ps(balance);
+	__m256i l = _mm256_setzero_si256();
+	__m256i r = _mm256_setzero_si256();
+	for (int sl = 0; sl < 32; sl += 8)
+	{
+		__m256i sample = _mm256_cvttps_epi32(_mm256_mul_ps(bal, _mm256_cvtepi32_ps(_mm256_load_si256((const __m256i *)(scsp->MixSample + sl)))));
+		l = _mm256_add_epi32(l, _mm256_srai_epi32(_mm256_mullo_epi32(sample, _mm256_load_si256((const __m256i *)(scsp->MixDirectL + sl))), SHIFT));
+		r = _mm256_add_epi32(r, _mm256_srai_epi32(_mm256_mullo_epi32(sample, _mm256_load_si256((const __m256i *)(scsp->MixDirectR + sl))), SHIFT));
+		_mm256_store_si256((__m256i *)(scsp->MixDSPIn + sl), _mm256_srai_epi32(_mm256_mullo_epi32(sample, _mm256_load_si256((const __m256i *)(scsp->MixDSP + sl))), SHIFT - 2));
+	}
+	__m128i lr = _mm_hadd_epi32(_mm_add_epi32(_mm256_castsi256_si128(l), _mm256_extracti128_si256(l, 1)), _mm_add_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1)));
+	lr = _mm_hadd_epi32(lr, lr);
+	*outL += _mm_cvtsi128_si32(lr);
+	*outR += _mm_extract_epi32(lr, 1);
+#elif defined(SUPERMODEL_SIMD_SSE2)
+	const __m128 bal = _mm_set1_ps(balance);
+	__m128i l = _mm_setzero_si128();
+	__m128i r = _mm_setzero_si128();
+	for (int sl = 0; sl < 32; sl += 4)
+	{
+		__m128i sample = _mm_cvttps_epi32(_mm_mul_ps(bal, _mm_cvtepi32_ps(_mm_load_si128((const __m128i *)(scsp->MixSample + sl)))));
+		l = _mm_add_epi32(l, _mm_srai_epi32(MulLo32(sample, _mm_load_si128((const __m128i *)(scsp->MixDirectL + sl))), SHIFT));
+		r = _mm_add_epi32(r, _mm_srai_epi32(MulLo32(sample, _mm_load_si128((const __m128i *)(scsp->MixDirectR + sl))), SHIFT));
+		_mm_store_si128((__m128i *)(scsp->MixDSPIn + sl), _mm_srai_epi32(MulLo32(sample, _mm_load_si128((const __m128i *)(scsp->MixDSP + sl))), SHIFT - 2));
+	}
+	*outL += HorizontalSum(l);
+	*outR += HorizontalSum(r);
+#elif defined(SUPERMODEL_SIMD_NEON)
+	const float32x4_t bal = vdupq_n_f32(balance);
+	int32x4_t l = vdupq_n_s32(0);
+	int32x4_t r = vdupq_n_s32(0);
+	for (int sl = 0; sl < 32; sl += 4)
+	{
+		int32x4_t sample = vcvtq_s32_f32(vmulq_f32(bal, vcvtq_f32_s32(vld1q_s32(scsp->MixSample + sl))));
+		l = vaddq_s32(l, vshrq_n_s32(vmulq_s32(sample, vld1q_s32(scsp->MixDirectL + sl)), SHIFT));
+		r = vaddq_s32(r, vshrq_n_s32(vmulq_s32(sample, vld1q_s32(scsp->MixDirectR + sl)), SHIFT));
+		vst1q_s32(scsp->MixDSPIn + sl, vshrq_n_s32(vmulq_s32(sample, vld1q_s32(scsp->MixDSP + sl)), SHIFT - 2));
+	}
+	int32x2_t lr = vpadd_s32(vpadd_s32(vget_low_s32(l), vget_high_s32(l)), vpadd_s32(vget_low_s32(r), vget_high_s32(r)));
+	*outL += vget_lane_s32(lr, 0);
+	*outR += vget_lane_s32(lr, 1);
+#else
+	for (int sl = 0; sl < 32; ++sl)
+	{
+		signed int sample = (int)(balance*(float)scsp->MixSample[sl]);
+		*outL += (sample*scsp->MixDirectL[sl]) >> SHIFT;
+		*outR += (sample*scsp->MixDirectR[sl]) >> SHIFT;
+		scsp->MixDSPIn[sl] = (sample*scsp->MixDSP[sl]) >> (SHIFT - 2);
+	}
+#endif
+
+	for (int sl = 0; sl < 32; ++sl)
+	{
+		if (scsp->MixSample[sl] != 0)
+			SCSPDSP_SetSample(&scsp->DSP, scsp->MixDSPIn[sl], scsp->MixISEL[sl], 0);
+	}
+}
+
 void SCSP_DoMasterSamples(int nsamples)
 {
 	constexpr int slice = 11289600 / 44100;	// 68K clocked at 11.2896MHz (45.1584MHz OSC / 4), which is 256 cycles/sample
@@ -1517,7 +1705,7 @@ void SCSP_DoMasterSamples(int nsamples)
 	 * When one SCSP is fully attenuated, the other's samples will be multiplied
 	 * by 2.
 	 */
-	float balance = std::max(-100.f,std::min(100.f,s_config->Get("Balance").ValueAs<float>()));
+	float balance = std::max(-100.f,std::min(100.f,s_balance.Get()));
 	balance *= 0.01f;
 	float masterBalance = 1.0f + balance;
 	float slaveBalance = 1.0f - balance;
@@ -1534,6 +1722,7 @@ void SCSP_DoMasterSamples(int nsamples)
 	{
 		signed int smpfl = 0, smpfr = 0;
 		signed int smprl = 0, smprr = 0;
+		INT32 audible0 = 0, audible1 = 0;	// nonzero if any slot output anything
 
 		for (INT32 sl = 0; sl < 32; ++sl)
 		{
@@ -1542,26 +1731,8 @@ void SCSP_DoMasterSamples(int nsamples)
 #else
 			RBUFDST = SCSPs[0].RINGBUF + SCSPs[0].BUFPTR;
 #endif
-			if (SCSPs[0].Slots[sl].active)
-			{
-				_SLOT *slot = SCSPs[0].Slots + sl;
-				UINT16 Enc;
-
-				signed int sample = (int)(masterBalance*(float)SCSP_UpdateSlot(slot));
-
-				Enc = ((TL(slot)) << 0x0) | ((IMXL(slot)) << 0xd);
-				SCSPDSP_SetSample(&SCSPs[0].DSP, (sample*LPANTABLE[Enc]) >> (SHIFT - 2), ISEL(slot), IMXL(slot));
-				Enc = ((TL(slot)) << 0x0) | ((DIPAN(slot)) << 0x8) | ((DISDL(slot)) << 0xd);
-#ifdef RB_VOLUME
-				smpfl += (sample * volume[TL(slot) + pan_left[DIPAN(slot)]]) >> 17;
-				smpfr += (sample * volume[TL(slot) + pan_right[DIPAN(slot)]]) >> 17;
-#else
-				{
-					smpfl += (sample*LPANTABLE[Enc]) >> SHIFT;
-					smpfr += (sample*RPANTABLE[Enc]) >> SHIFT;
-				}
-#endif
-			}
+			SCSPs[0].MixSample[sl] = SCSPs[0].Slots[sl].active ? SCSP_UpdateSlot(SCSPs[0].Slots + sl) : 0;
+			audible0 |= SCSPs[0].MixSample[sl];
 #if FM_DELAY
 			SCSPs[0].RINGBUF[(SCSPs[0].BUFPTR + 64 - (FM_DELAY - 1)) & 63] = SCSPs[0].DELAYBUF[(SCSPs[0].DELAYPTR + FM_DELAY - (FM_DELAY - 1)) % FM_DELAY];
 #endif
@@ -1578,26 +1749,8 @@ void SCSP_DoMasterSamples(int nsamples)
 				RBUFDST = SCSPs[1].RINGBUF + SCSPs[1].BUFPTR;
 #endif
 			{
-				if (SCSPs[1].Slots[sl].active)
-				{
-					_SLOT *slot = SCSPs[1].Slots + sl;
-					UINT16 Enc;
-
-					signed int sample = (int)(slaveBalance*(float)SCSP_UpdateSlot(slot));
-
-					Enc = ((TL(slot)) << 0x0) | ((IMXL(slot)) << 0xd);
-					SCSPDSP_SetSample(&SCSPs[1].DSP, (sample*LPANTABLE[Enc]) >> (SHIFT - 2), ISEL(slot), IMXL(slot));
-					Enc = ((TL(slot)) << 0x0) | ((DIPAN(slot)) << 0x8) | ((DISDL(slot)) << 0xd);
-					{
-#ifdef RB_VOLUME
-						smprl += (sample * volume[TL(slot) + pan_left[DIPAN(slot)]]) >> 17;
-						smprr += (sample * volume[TL(slot) + pan_right[DIPAN(slot)]]) >> 17;
-#else
-						smprl += (sample*LPANTABLE[Enc]) >> SHIFT;
-						smprr += (sample*RPANTABLE[Enc]) >> SHIFT;
-					}
-#endif
-				}
+				SCSPs[1].MixSample[sl] = SCSPs[1].Slots[sl].active ? SCSP_UpdateSlot(SCSPs[1].Slots + sl) : 0;
+				audible1 |= SCSPs[1].MixSample[sl];
 #if FM_DELAY
 				SCSPs[1].RINGBUF[(SCSPs[1].BUFPTR + 64 - (FM_DELAY - 1)) & 63] = SCSPs[1].DELAYBUF[(SCSPs[1].DELAYPTR + FM_DELAY - (FM_DELAY - 1)) % FM_DELAY];
 #endif
@@ -1611,6 +1764,13 @@ void SCSP_DoMasterSamples(int nsamples)
 
 	}
 
+		// Silent or idle SCSPs have nothing to mix (but the DSP may still be
+		// playing out reverb)
+		if (audible0)
+			SCSP_MixSlots(&SCSPs[0], masterBalance, &smpfl, &smpfr);
+		if (audible1)
+			SCSP_MixSlots(&SCSPs[1], slaveBalance, &smprl, &smprr);
+
 		SCSPDSP_Step(&SCSPs[0].DSP);
 		if (HasSlaveSCSP)
 			SCSPDSP_Step(&SCSPs[1].DSP);
@@ -1711,8 +1871,15 @@ void SCSP_DoMasterSamples(int nsamples)
 			*bufrr++ = (float)smprr;
 		}
 
-		SCSP_TimersAddTicks(1);
-		CheckPendingIRQ();
+		// Timers and interrupts only need attention when something happened
+		++SampleClock;
+		if (TimerEventPending && SampleClock == TimerEvent)
+		{
+			SCSP_TimersSync();
+			SCSP_TimersSchedule();
+		}
+		if (IrqDirty || MidiW != MidiR)
+			CheckPendingIRQ();
 		lastdiff = Run68kCB(slice - lastdiff);
 	}
 }
@@ -1930,6 +2097,8 @@ void SCSP_SaveState(CBlockFile *StateFile)
 {
 	StateFile->NewBlock("SCSP x 2", __FILE__);
 
+	SCSP_TimersSync();
+
 	/*
 	 * Save global variables.
 	 *
@@ -2099,8 +2268,9 @@ void SCSP_LoadState(CBlockFile *StateFile)
 			StateFile->Read(&(SCSPs[i].Slots[j].ALFO.phase), sizeof(SCSPs[i].Slots[j].ALFO.phase));
 			StateFile->Read(&(SCSPs[i].Slots[j].ALFO.phase_step), sizeof(SCSPs[i].Slots[j].ALFO.phase_step));
 
-			// Recompute LFOs
+			// Recompute LFOs and mixer gains
 			Compute_LFO(&(SCSPs[i].Slots[j]));
+			SCSP_UpdateSlotMix(&SCSPs[i], j);
 		}
 
 		// DSP
@@ -2117,7 +2287,13 @@ void SCSP_LoadState(CBlockFile *StateFile)
 		StateFile->Read(SCSPs[i].DSP.EFREG, sizeof(SCSPs[i].DSP.EFREG));
 		StateFile->Read(&(SCSPs[i].DSP.Stopped), sizeof(SCSPs[i].DSP.Stopped));
 		StateFile->Read(&(SCSPs[i].DSP.LastStep), sizeof(SCSPs[i].DSP.LastStep));
+		SCSPs[i].DSP.ProgramDirty = true;
 	}
+
+	for (int i = 0; i < 3; i++)
+		TimClock[i] = SampleClock;
+	SCSP_TimersSchedule();
+	IrqDirty = true;
 }
 
 void SCSP_SetBuffers(float *leftBufferPtr, float *rightBufferPtr, float* leftRearBufferPtr, float* rightRearBufferPtr, int bufferLength)
@@ -204,6 +204,154 @@ void SCSPDSP_Init(_SCSPDSP *DSP)
 	DSP->RBL = (8 * 1024); // Initial RBL is 0
 	DSP->Stopped = true;
 }
+/*
+ * Predecoded microprogram
+ *
+ * The program only changes when MPRO is written, but used to be decoded again
+ * for every step of every sample. SCSPDSP_Compile() extracts the fields once
+ * and works out which parts of each step can have an effect:
+ *
+ *	- ACC is rebuilt by every step and only the next step reads it (through
+ *	  the shifter or B), so the multiply-accumulate is skipped when the next
+ *	  step doesn't.
+ *	- Steps that then do nothing at all (no TEMP, MEMS, EFREG, register or
+ *	  memory writes) are dropped. Unused slots between real instructions
+ *	  are mostly this.
+ *	- INPUTS, the shifter and the address are only computed when used, and
+ *	  memory accesses on even steps, which the hardware ignores, are gone.
+ *	- The first step with an invalid input address ends the program early
+ *	  (without the DEC update), as the interpreter did.
+ *
+ * COEF, MADRS, RBL and RBP are still read while running, so writing those
+ * doesn't require recompiling.
+ */
+
+enum
+{
+	DSPSTEP_INPUTS	= 0x00001,	//INPUTS is used
+	DSPSTEP_SHIFTED	= 0x00002,	//shifter output is used
+	DSPSTEP_ACC		= 0x00004,	//ACC is read by the next step
+	DSPSTEP_XSEL	= 0x00008,	//X = INPUTS, otherwise TEMP
+	DSPSTEP_BACC	= 0x00010,	//B = ACC
+	DSPSTEP_BTEMP	= 0x00020,	//B = TEMP
+	DSPSTEP_NEGB	= 0x00040,
+	DSPSTEP_IWT		= 0x00080,
+	DSPSTEP_YRL		= 0x00100,
+	DSPSTEP_TWT		= 0x00200,
+	DSPSTEP_FRCL	= 0x00400,
+	DSPSTEP_MRD		= 0x00800,	//only on odd steps, as the memory flags below
+	DSPSTEP_MWT		= 0x01000,
+	DSPSTEP_TABLE	= 0x02000,
+	DSPSTEP_ADREB	= 0x04000,
+	DSPSTEP_NXADR	= 0x08000,
+	DSPSTEP_NOFL	= 0x10000,
+	DSPSTEP_ADRL	= 0x20000,
+	DSPSTEP_EWT		= 0x40000
+};
+
+static void SCSPDSP_Compile(_SCSPDSP *DSP)
+{
+	_SCSPDSPSTEP Steps[128];
+	int NumSteps = DSP->LastStep;
+	int step;
+
+	DSP->ProgramDirty = false;
+	DSP->ProgramAborts = false;
+
+	//decode
+	for (step = 0; step < NumSteps; ++step)
+	{
+		UINT16 *IPtr = DSP->MPRO + step * 4;
+		_SCSPDSPSTEP *S = &Steps[step];
+		UINT32 Flags = 0;
+
+		S->TRA = (IPtr[0] >> 8) & 0x7F;
+		S->TWA = (IPtr[0] >> 0) & 0x7F;
+		S->YSEL = (IPtr[1] >> 13) & 0x03;
+		S->IRA = (IPtr[1] >> 6) & 0x3F;
+		S->IWA = (IPtr[1] >> 0) & 0x1F;
+		S->EWA = (IPtr[2] >> 8) & 0x0F;
+		S->SHIFT = (IPtr[2] >> 4) & 0x03;
+		S->COEF = (IPtr[3] >> 9) & 0x3f;
+		S->MASA = (IPtr[3] >> 2) & 0x1f;
+
+		if (S->IRA > 0x31)	//interpreter returned here
+		{
+			NumSteps = step;
+			DSP->ProgramAborts = true;
+			break;
+		}
+
+		if ((IPtr[0] >> 7) & 0x01)
+			Flags |= DSPSTEP_TWT;
+		if ((IPtr[1] >> 15) & 0x01)
+			Flags |= DSPSTEP_XSEL;
+		if ((IPtr[1] >> 5) & 0x01)
+			Flags |= DSPSTEP_IWT;
+		if ((IPtr[2] >> 12) & 0x01)
+			Flags |= DSPSTEP_EWT;
+		if ((IPtr[2] >> 7) & 0x01)
+			Flags |= DSPSTEP_ADRL;
+		if ((IPtr[2] >> 6) & 0x01)
+			Flags |= DSPSTEP_FRCL;
+		if ((IPtr[2] >> 3) & 0x01)
+			Flags |= DSPSTEP_YRL;
+		if (!((IPtr[2] >> 1) & 0x01))	//ZERO
+		{
+			Flags |= (IPtr[2] & 0x01) ? DSPSTEP_BACC : DSPSTEP_BTEMP;
+			if ((IPtr[2] >> 2) & 0x01)
+				Flags |= DSPSTEP_NEGB;
+		}
+		if (step & 1)	//memory only allowed on odd? DoA inserts NOPs on even
+		{
+			if ((IPtr[2] >> 13) & 0x01)
+				Flags |= DSPSTEP_MRD;
+			if ((IPtr[2] >> 14) & 0x01)
+				Flags |= DSPSTEP_MWT;
+			if ((IPtr[2] >> 15) & 0x01)
+				Flags |= DSPSTEP_TABLE;
+			if ((IPtr[3] >> 15) & 0x01)
+				Flags |= DSPSTEP_NOFL;
+			if ((IPtr[3] >> 1) & 0x01)
+				Flags |= DSPSTEP_ADREB;
+			if ((IPtr[3] >> 0) & 0x01)
+				Flags |= DSPSTEP_NXADR;
+		}
+		S->Flags = Flags;
+	}
+
+	//liveness, back to front: the last ACC of a sample is never read
+	bool AccRead = false;
+	for (step = NumSteps - 1; step >= 0; --step)
+	{
+		_SCSPDSPSTEP *S = &Steps[step];
+		UINT32 Flags = S->Flags;
+
+		if (AccRead)
+			Flags |= DSPSTEP_ACC;
+		else
+			Flags &= ~(DSPSTEP_XSEL | DSPSTEP_BACC | DSPSTEP_BTEMP | DSPSTEP_NEGB);
+
+		if ((Flags & (DSPSTEP_TWT | DSPSTEP_FRCL | DSPSTEP_MWT | DSPSTEP_EWT)) || ((Flags & DSPSTEP_ADRL) && S->SHIFT == 3))
+			Flags |= DSPSTEP_SHIFTED;
+		if ((Flags & (DSPSTEP_XSEL | DSPSTEP_YRL)) || ((Flags & DSPSTEP_ADRL) && S->SHIFT != 3))
+			Flags |= DSPSTEP_INPUTS;
+		if (!(Flags & (DSPSTEP_MRD | DSPSTEP_MWT)))
+			Flags &= ~(DSPSTEP_TABLE | DSPSTEP_NOFL | DSPSTEP_ADREB | DSPSTEP_NXADR);
+
+		S->Flags = Flags;
+		AccRead = (Flags & (DSPSTEP_SHIFTED | DSPSTEP_BACC)) != 0;
+	}
+
+	//drop steps without effects
+	DSP->ProgramLength = 0;
+	for (step = 0; step < NumSteps; ++step)
+	{
+		if (Steps[step].Flags & (DSPSTEP_ACC | DSPSTEP_IWT | DSPSTEP_YRL | DSPSTEP_TWT | DSPSTEP_FRCL | DSPSTEP_MRD | DSPSTEP_MWT | DSPSTEP_ADRL | DSPSTEP_EWT))
+			DSP->Program[DSP->ProgramLength++] = Steps[step];
+	}
+}
+
 //#ifndef DYNDSP
 void SCSPDSP_Step(_SCSPDSP *DSP)
 {
@@ -218,230 +366,184 @@ void SCSPDSP_Step(_SCSPDSP *DSP)
 	INT32 Y_REG = 0;      //24 bit
 	UINT32 ADDR = 0;
 	UINT32 ADRS_REG = 0;  //13 bit
-	int step;
 
 	if (DSP->Stopped)
 		return;
 
+	if (DSP->ProgramDirty)
+		SCSPDSP_Compile(DSP);
+
 	memset(DSP->EFREG, 0, 2 * 16);
-	for (step = 0; step </*128*/DSP->LastStep; ++step)
+	const _SCSPDSPSTEP *S = DSP->Program;
+	const _SCSPDSPSTEP *End = S + DSP->ProgramLength;
+	for (; S != End; ++S)
 	{
-		UINT16 *IPtr = DSP->MPRO + step * 4;
-
-		//		if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-		//			break;
-
-		UINT32 TRA = (IPtr[0] >> 8) & 0x7F;
-		UINT32 TWT = (IPtr[0] >> 7) & 0x01;
-		UINT32 TWA = (IPtr[0] >> 0) & 0x7F;
-
-		UINT32 XSEL = (IPtr[1] >> 15) & 0x01;
-		UINT32 YSEL = (IPtr[1] >> 13) & 0x03;
-		UINT32 IRA = (IPtr[1] >> 6) & 0x3F;
-		UINT32 IWT = (IPtr[1] >> 5) & 0x01;
-		UINT32 IWA = (IPtr[1] >> 0) & 0x1F;
-
-		UINT32 TABLE = (IPtr[2] >> 15) & 0x01;
-		UINT32 MWT = (IPtr[2] >> 14) & 0x01;
-		UINT32 MRD = (IPtr[2] >> 13) & 0x01;
-		UINT32 EWT = (IPtr[2] >> 12) & 0x01;
-		UINT32 EWA = (IPtr[2] >> 8) & 0x0F;
-		UINT32 ADRL = (IPtr[2] >> 7) & 0x01;
-		UINT32 FRCL = (IPtr[2] >> 6) & 0x01;
-		UINT32 SHIFT = (IPtr[2] >> 4) & 0x03;
-		UINT32 YRL = (IPtr[2] >> 3) & 0x01;
-		UINT32 NEGB = (IPtr[2] >> 2) & 0x01;
-		UINT32 ZERO = (IPtr[2] >> 1) & 0x01;
-		UINT32 BSEL = (IPtr[2] >> 0) & 0x01;
-
-		UINT32 NOFL = (IPtr[3] >> 15) & 0x01;	//????
-		UINT32 COEF = (IPtr[3] >> 9) & 0x3f;
-
-		UINT32 MASA = (IPtr[3] >> 2) & 0x1f;	//???
-		UINT32 ADREB = (IPtr[3] >> 1) & 0x01;
-		UINT32 NXADR = (IPtr[3] >> 0) & 0x01;
-
-		INT64 v;
+		UINT32 Flags = S->Flags;
 
 		//operations are done at 24 bit precision
-#if 0
-		if (MASA)
-			int a = 1;
-		if (NOFL)
-			int a = 1;
-#endif
 		//INPUTS RW
-// colmns97 hits this
-//		assert(IRA<0x32);
-		if (IRA <= 0x1f)
-			INPUTS = DSP->MEMS[IRA];
-		else if (IRA <= 0x2F)
-			INPUTS = DSP->MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
-		else if (IRA <= 0x31)
-			INPUTS = DSP->EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
-		else
-			return;
+		if (Flags & DSPSTEP_INPUTS)
+		{
+			UINT32 IRA = S->IRA;
+			if (IRA <= 0x1f)
+				INPUTS = DSP->MEMS[IRA];
+			else if (IRA <= 0x2F)
+				INPUTS = DSP->MIXS[IRA - 0x20] << 4;  //MIXS is 20 bit
+			else
+				INPUTS = DSP->EXTS[IRA - 0x30] << 8;  //EXTS is 16 bit
 
-		INPUTS <<= 8;
-		INPUTS >>= 8;
-		//if(INPUTS&0x00800000)
-		//	INPUTS|=0xFF000000;
+			INPUTS <<= 8;
+			INPUTS >>= 8;
+		}
 
-		if (IWT)
+		if (Flags & DSPSTEP_IWT)
 		{
-			DSP->MEMS[IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
-			if (IRA == IWA)
+			DSP->MEMS[S->IWA] = MEMVAL;  //MEMVAL was selected in previous MRD
+			if (S->IRA == S->IWA)
 				INPUTS = MEMVAL;
 		}
 
-		//Operand sel
-		//B
-		if (!ZERO)
+		//Shifter
+		if (Flags & DSPSTEP_SHIFTED)
+		{
+			switch (S->SHIFT)
+			{
+			case 0:
+				SHIFTED = ACC;
+				if (SHIFTED > 0x007FFFFF)
+					SHIFTED = 0x007FFFFF;
+				if (SHIFTED < (-0x00800000))
+					SHIFTED = -0x00800000;
+				break;
+			case 1:
+				SHIFTED = ACC * 2;
+				if (SHIFTED > 0x007FFFFF)
+					SHIFTED = 0x007FFFFF;
+				if (SHIFTED < (-0x00800000))
+					SHIFTED = -0x00800000;
+				break;
+			case 2:
+				SHIFTED = ACC * 2;
+				SHIFTED <<= 8;
+				SHIFTED >>= 8;
+				break;
+			default:
+				SHIFTED = ACC;
+				SHIFTED <<= 8;
+				SHIFTED >>= 8;
+				break;
+			}
+		}
+
+		if (Flags & DSPSTEP_ACC)
 		{
-			if (BSEL)
+			//Operand sel
+			//B
+			if (Flags & DSPSTEP_BACC)
 				B = ACC;
-			else
+			else if (Flags & DSPSTEP_BTEMP)
 			{
-				B = DSP->TEMP[(TRA + DSP->DEC) & 0x7F];
+				B = DSP->TEMP[(S->TRA + DSP->DEC) & 0x7F];
 				B <<= 8;
 				B >>= 8;
-				//if(B&0x00800000)
-				//	B|=0xFF000000;  //Sign extend
 			}
-			if (NEGB)
+			else
+				B = 0;
+			if (Flags & DSPSTEP_NEGB)
 				B = 0 - B;
-		}
-		else
-			B = 0;
 
-		//X
-		if (XSEL)
-			X = INPUTS;
-		else
-		{
-			X = DSP->TEMP[(TRA + DSP->DEC) & 0x7F];
-			X <<= 8;
-			X >>= 8;
-			//if(X&0x00800000)
-			//	X|=0xFF000000;
-		}
+			//X
+			if (Flags & DSPSTEP_XSEL)
+				X = INPUTS;
+			else
+			{
+				X = DSP->TEMP[(S->TRA + DSP->DEC) & 0x7F];
+				X <<= 8;
+				X >>= 8;
+			}
 
-		//Y
-		if (YSEL == 0)
-			Y = FRC_REG;
-		else if (YSEL == 1)
-			Y = DSP->COEF[COEF] >> 3;   //COEF is 16 bits
-		else if (YSEL == 2)
-			Y = (Y_REG >> 11) & 0x1FFF;
-		else if (YSEL == 3)
-			Y = (Y_REG >> 4) & 0x0FFF;
-
-		if (YRL)
-			Y_REG = INPUTS;
+			//Y (before YRL below)
+			switch (S->YSEL)
+			{
+			case 0:
+				Y = FRC_REG;
+				break;
+			case 1:
+				Y = DSP->COEF[S->COEF] >> 3;   //COEF is 16 bits
+				break;
+			case 2:
+				Y = (Y_REG >> 11) & 0x1FFF;
+				break;
+			default:
+				Y = (Y_REG >> 4) & 0x0FFF;
+				break;
+			}
 
-		//Shifter
-		if (SHIFT == 0)
-		{
-			SHIFTED = ACC;
-			if (SHIFTED > 0x007FFFFF)
-				SHIFTED = 0x007FFFFF;
-			if (SHIFTED < (-0x00800000))
-				SHIFTED = -0x00800000;
-		}
-		else if (SHIFT == 1)
-		{
-			SHIFTED = ACC * 2;
-			if (SHIFTED > 0x007FFFFF)
-				SHIFTED = 0x007FFFFF;
-			if (SHIFTED < (-0x00800000))
-				SHIFTED = -0x00800000;
-		}
-		else if (SHIFT == 2)
-		{
-			SHIFTED = ACC * 2;
-			SHIFTED <<= 8;
-			SHIFTED >>= 8;
-			//SHIFTED&=0x00FFFFFF;
-			//if(SHIFTED&0x00800000)
-			//	SHIFTED|=0xFF000000;
-		}
-		else if (SHIFT == 3)
-		{
-			SHIFTED = ACC;
-			SHIFTED <<= 8;
-			SHIFTED >>= 8;
-			//SHIFTED&=0x00FFFFFF;
-			//if(SHIFTED&0x00800000)
-			//	SHIFTED|=0xFF000000;
-		}
+			//ACCUM
+			Y <<= 19;
+			Y >>= 19;
 
-		//ACCUM
-		Y <<= 19;
-		Y >>= 19;
-		//if(Y&0x1000)
-		//	Y|=0xFFFFF000;
+			ACC = (int)(((INT64)X*(INT64)Y) >> 12) + B;
+		}
 
-		v = (((INT64)X*(INT64)Y) >> 12);
-		ACC = (int)v + B;
+		if (Flags & DSPSTEP_YRL)
+			Y_REG = INPUTS;
 
-		if (TWT)
-			DSP->TEMP[(TWA + DSP->DEC) & 0x7F] = SHIFTED;
+		if (Flags & DSPSTEP_TWT)
+			DSP->TEMP[(S->TWA + DSP->DEC) & 0x7F] = SHIFTED;
 
-		if (FRCL)
+		if (Flags & DSPSTEP_FRCL)
 		{
-			if (SHIFT == 3)
+			if (S->SHIFT == 3)
 				FRC_REG = SHIFTED & 0x0FFF;
 			else
 				FRC_REG = (SHIFTED >> 11) & 0x1FFF;
 		}
 
-		if (MRD || MWT)
-			//if(0)
+		if (Flags & (DSPSTEP_MRD | DSPSTEP_MWT))
 		{
-			ADDR = DSP->MADRS[MASA];
-			if (!TABLE)
+			ADDR = DSP->MADRS[S->MASA];
+			if (!(Flags & DSPSTEP_TABLE))
 				ADDR += DSP->DEC;
-			if (ADREB)
+			if (Flags & DSPSTEP_ADREB)
 				ADDR += ADRS_REG & 0x0FFF;
-			if (NXADR)
+			if (Flags & DSPSTEP_NXADR)
 				ADDR++;
-			if (!TABLE)
+			if (!(Flags & DSPSTEP_TABLE))
 				ADDR &= DSP->RBL - 1;
 			else
 				ADDR &= 0xFFFF;
-			//ADDR<<=1;
-			//ADDR+=DSP->RBP<<13;
-			//MEMVAL=DSP->SCSPRAM[ADDR>>1];
 			ADDR += DSP->RBP << 12;
 			if (ADDR > 0x7ffff) ADDR = 0; //!! MAME has ADDR <<= 1 in here, but this seems to be wrong?
-			if (MRD && (step & 1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if (Flags & DSPSTEP_MRD)
 			{
-				if (NOFL)
+				if (Flags & DSPSTEP_NOFL)
 					MEMVAL = DSP->SCSPRAM[ADDR] << 8;
 				else
 					MEMVAL = UNPACK(DSP->SCSPRAM[ADDR]);
 			}
-			if (MWT && (step & 1))
+			if (Flags & DSPSTEP_MWT)
 			{
-				if (NOFL)
+				if (Flags & DSPSTEP_NOFL)
 					DSP->SCSPRAM[ADDR] = SHIFTED >> 8;
 				else
 					DSP->SCSPRAM[ADDR] = PACK(SHIFTED);
 			}
 		}
 
-		if (ADRL)
+		if (Flags & DSPSTEP_ADRL)
 		{
-			if (SHIFT == 3)
+			if (S->SHIFT == 3)
 				ADRS_REG = (SHIFTED >> 12) & 0xFFF;
 			else
 				ADRS_REG = (INPUTS >> 16);
 		}
 
-		if (EWT)
-			DSP->EFREG[EWA] += SHIFTED >> 8;
-
+		if (Flags & DSPSTEP_EWT)
+			DSP->EFREG[S->EWA] += SHIFTED >> 8;
 	}
+	if (DSP->ProgramAborts)
+		return;
 	--DSP->DEC;
 	memset(DSP->MIXS, 0, 4 * 16);
 }
@@ -466,6 +568,7 @@ void SCSPDSP_Start(_SCSPDSP *DSP)
 			break;
 	}
 	DSP->LastStep = i + 1;
+	DSP->ProgramDirty = true;
 
 /*
 	int test=0;
@@ -33,6 +33,20 @@
 
 //#define DYNDSP
 
+/*
+ * Predecoded DSP step. SCSPDSP_Step() runs the microprogram from these rather
+ * than from MPRO: the instruction fields are extracted once, and flags say
+ * which parts of the step have any effect.
+ */
+struct _SCSPDSPSTEP
+{
+	UINT32 Flags;		// DSPSTEP_xxx
+	UINT8 TRA, TWA;		// TEMP read and write addresses
+	UINT8 IRA, IWA;		// input (MEMS, MIXS, EXTS) read address, MEMS write address
+	UINT8 YSEL, SHIFT;
+	UINT8 COEF, MASA, EWA;
+};
+
 //the DSP Context
 struct _SCSPDSP
 {
@@ -60,6 +74,12 @@ struct _SCSPDSP
 	
 	bool Stopped;
 	int LastStep;
+
+//predecoded program, rebuilt by SCSPDSP_Step() when MPRO or LastStep change
+	_SCSPDSPSTEP Program[128];
+	int ProgramLength;
+	bool ProgramAborts;	//an invalid input address ends every sample early
+	bool ProgramDirty;	//set whenever MPRO is written
 #ifdef DYNDSP
 	INT32 ACC;	//26 bit
 	INT32 SHIFTED;	//24 bit
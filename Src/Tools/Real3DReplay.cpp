@@ -0,0 +1,316 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2016 Bart Trzynadlowski, Nik Henson
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * Real3DReplay.cpp
+ *
+ * Standalone renderer benchmark. Loads frame captures (see
+ * Model3/GraphicsCapture.h) into CModel3GraphicsState and renders each one
+ * over and over, reporting how long scene traversal, model conversion,
+ * texture upload and the rest of the frame take. No CPUs are emulated, so
+ * renderer changes can be measured on identical input.
+ *
+ * Both renderers used here share the scene traversal and model conversion of
+ * New3D. CNew3D itself needs a GL context, which a command line tool doesn't
+ * have, so the drawing half is either the software renderer or nothing at
+ * all.
+ *
+ * Build with "make real3d-replay". Captures are made by running the emulator
+ * with -gfx-capture-frame=<n> -gfx-capture-count=<n>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "BlockFile.h"
+#include "Game.h"
+#include "ROMSet.h"
+#include "CPU/PowerPC/ppc.h"
+#include "Graphics/NullRender.h"
+#include "Graphics/Soft3D/Soft3D.h"
+#include "Model3/GraphicsCapture.h"
+#include "Model3/Model3GraphicsState.h"
+#include "OSD/Logger.h"
+#include "OSD/Video.h"
+#include "Util/NewConfig.h"
+
+static const size_t VROM_SIZE = 64*0x100000;
+
+// Nothing is presented
+bool BeginFrameVideo()
+{
+  return true;
+}
+
+void EndFrameVideo()
+{
+}
+
+// There is no PowerPC, interrupts raised by the Real3D go nowhere
+void ppc_set_irq_line(int)
+{
+}
+
+UINT32 ppc_get_pc(void)
+{
+  return 0;
+}
+
+UINT32 ppc_get_lr(void)
+{
+  return 0;
+}
+
+struct Options
+{
+  bool      soft = true;      // software renderer, otherwise scene construction only
+  unsigned  frames = 100;     // frames rendered per capture after the first
+  unsigned  threads = 0;      // software renderer threads, 0 for one per hardware thread
+  unsigned  xRes = 496;
+  unsigned  yRes = 384;
+};
+
+struct FrameTimes
+{
+  double    frame = 0;        // RenderFrame(), includes traversal and conversion
+  double    traversal = 0;
+  double    conversion = 0;
+  double    upload = 0;       // full texture sheet
+  unsigned  models = 0;
+  unsigned  conversions = 0;
+};
+
+static double ElapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+static FrameTimes TimeFrame(CModel3GraphicsState *Emu, New3D::CNew3DScene *Render3D)
+{
+  FrameTimes t;
+  auto start = std::chrono::steady_clock::now();
+  Render3D->UploadTextures(0, 0, 0, 2048, 2048);
+  auto uploaded = std::chrono::steady_clock::now();
+  Emu->RenderFrame();
+  auto end = std::chrono::steady_clock::now();
+
+  const New3D::CNew3DScene::SceneTimes &scene = Render3D->GetSceneTimes();
+  t.frame = ElapsedMs(uploaded, end);
+  t.upload = ElapsedMs(start, uploaded);
+  t.traversal = scene.traversalMs;
+  t.conversion = scene.conversionMs;
+  t.models = scene.models;
+  t.conversions = scene.conversions;
+  return t;
+}
+
+static std::shared_ptr<uint8_t> LoadVROM(const std::string &file_path)
+{
+  std::shared_ptr<uint8_t> vrom(new uint8_t[VROM_SIZE], std::default_delete<uint8_t[]>());
+  FILE *fp = fopen(file_path.c_str(), "rb");
+  if (NULL == fp)
+  {
+    ErrorLog("Unable to open video ROM '%s'.", file_path.c_str());
+    return nullptr;
+  }
+  size_t read = fread(vrom.get(), 1, VROM_SIZE, fp);
+  fclose(fp);
+  if (read != VROM_SIZE)
+  {
+    ErrorLog("'%s' is too short to be a video ROM dump.", file_path.c_str());
+    return nullptr;
+  }
+  return vrom;
+}
+
+static Result Replay(const std::string &file_path, const Options &options, const Util::Config::Node &config)
+{
+  // Header
+  CBlockFile Capture;
+  GraphicsCaptureInfo info;
+  if (Result::OKAY != Capture.Load(file_path))
+    return ErrorLog("Unable to load '%s'.", file_path.c_str());
+  if (Result::OKAY != LoadGraphicsCaptureInfo(&Capture, &info))
+    return ErrorLog("'%s' is not a graphics capture from this version of Supermodel.", file_path.c_str());
+  Capture.Close();
+
+  // Video ROM lives next to the capture and is shared by every frame of a game
+  static std::string vrom_path;
+  static std::shared_ptr<uint8_t> vrom;
+  size_t dir_end = file_path.find_last_of("/\\");
+  std::string dir = dir_end == std::string::npos ? std::string() : file_path.substr(0, dir_end + 1);
+  if (vrom_path != dir + info.vromFile)
+  {
+    vrom_path = dir + info.vromFile;
+    vrom = LoadVROM(vrom_path);
+  }
+  if (!vrom)
+  {
+    vrom_path.clear();
+    return Result::FAIL;
+  }
+
+  ROMSet rom_set;
+  rom_set.rom_by_region["vrom"].data = vrom;
+  rom_set.rom_by_region["vrom"].size = VROM_SIZE;
+  Game game;
+  game.name = info.game;
+  game.stepping = info.stepping;
+
+  // A fresh renderer for every capture, so the first frame converts every model
+  CNullRender2D render2D;
+  std::unique_ptr<New3D::CNew3DScene> render3D;
+  if (options.soft)
+    render3D.reset(new Soft3D::CSoft3D(config, game.name, options.threads));
+  else
+    render3D.reset(new CNullRender3D(config, game.name, true));
+  render2D.Init(0, 0, options.xRes, options.yRes, options.xRes, options.yRes, 0, UpscaleMode::Nearest);
+  render3D->Init(0, 0, options.xRes, options.yRes, options.xRes, options.yRes, 0);
+  render3D->SetProfiling(true);
+
+  CModel3GraphicsState emu(config, file_path);
+  if (Result::OKAY != emu.Init())
+    return Result::FAIL;
+  emu.LoadGame(game, rom_set);
+  emu.AttachRenderers(&render2D, render3D.get(), nullptr);
+  emu.Reset();
+
+  // First frame: everything gets converted
+  FrameTimes cold = TimeFrame(&emu, render3D.get());
+
+  // Repeated frames: models are cached as they would be in a running game
+  FrameTimes sum;
+  double min_frame = 0;
+  double max_frame = 0;
+  for (unsigned i = 0; i < options.frames; i++)
+  {
+    FrameTimes t = TimeFrame(&emu, render3D.get());
+    sum.frame += t.frame;
+    sum.traversal += t.traversal;
+    sum.conversion += t.conversion;
+    sum.upload += t.upload;
+    sum.conversions += t.conversions;
+    min_frame = i == 0 ? t.frame : std::min(min_frame, t.frame);
+    max_frame = i == 0 ? t.frame : std::max(max_frame, t.frame);
+  }
+
+  Render3DStats stats = render3D->GetStats();
+  double n = std::max(1u, options.frames);
+  printf("%s: %s frame %u, %u models, %u meshes, %u draw calls\n", file_path.c_str(), info.game.c_str(), info.frame, cold.models, stats.meshes, stats.drawCalls);
+  printf("  first frame      %8.3f ms (traversal %.3f, conversion %.3f of %u models), upload %.3f ms\n", cold.frame, cold.traversal, cold.conversion, cold.conversions, cold.upload);
+  printf("  next %-5u frames %8.3f ms average, %.3f min, %.3f max\n", options.frames, sum.frame / n, min_frame, max_frame);
+  printf("    traversal      %8.3f ms\n", sum.traversal / n);
+  printf("    conversion     %8.3f ms (%.1f models)\n", sum.conversion / n, sum.conversions / n);
+  printf("    drawing        %8.3f ms\n", (sum.frame - sum.traversal - sum.conversion) / n);
+  printf("    upload         %8.3f ms\n", sum.upload / n);
+  return Result::OKAY;
+}
+
+static void Help(void)
+{
+  puts("Usage: real3d-replay [options] <capture files>");
+  puts("");
+  puts("Renders frame captures (<game>.<frame>.gfx, written by Supermodel with");
+  puts("-gfx-capture-frame and -gfx-capture-count) repeatedly and reports where");
+  puts("the time goes. The video ROM dump must be next to the captures.");
+  puts("");
+  puts("Options:");
+  puts("  -frames=<n>             Frames rendered per capture after the first [Default: 100]");
+  puts("  -renderer=<soft|null>   Software renderer, or scene construction only");
+  puts("                          [Default: soft]");
+  puts("  -threads=<n>            Software renderer threads, 0 for all [Default: 0]");
+  puts("  -res=<x>,<y>            Resolution [Default: 496,384]");
+  puts("  -quad-rendering         Convert quads instead of triangles");
+  puts("  -wide-screen            Widescreen frustum");
+  puts("  -?, -h, -help           Print this message");
+}
+
+int main(int argc, char **argv)
+{
+  SetLogger(std::make_shared<CConsoleErrorLogger>());
+
+  Options options;
+  Util::Config::Node config("Global");
+  config.Set("GPUMultiThreaded", false);
+  config.Set("QuadRendering", false);
+  config.Set("WideScreen", false);
+  config.Set("NoWhiteFlash", false);
+
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg(argv[i]);
+    if (arg == "-?" || arg == "-h" || arg == "-help" || arg == "--help")
+    {
+      Help();
+      return 0;
+    }
+    else if (arg.compare(0, 8, "-frames=") == 0)
+      options.frames = atoi(arg.c_str() + 8);
+    else if (arg == "-renderer=soft")
+      options.soft = true;
+    else if (arg == "-renderer=null")
+      options.soft = false;
+    else if (arg.compare(0, 9, "-threads=") == 0)
+      options.threads = atoi(arg.c_str() + 9);
+    else if (arg.compare(0, 5, "-res=") == 0)
+    {
+      unsigned x, y;
+      if (sscanf(arg.c_str() + 5, "%u,%u", &x, &y) != 2 || x == 0 || y == 0)
+      {
+        ErrorLog("Invalid resolution '%s'.", arg.c_str() + 5);
+        return 1;
+      }
+      options.xRes = x;
+      options.yRes = y;
+    }
+    else if (arg == "-quad-rendering")
+      config.Set("QuadRendering", true);
+    else if (arg == "-wide-screen")
+      config.Set("WideScreen", true);
+    else if (arg[0] == '-')
+    {
+      ErrorLog("Unknown option '%s'.", arg.c_str());
+      return 1;
+    }
+    else
+      files.push_back(arg);
+  }
+
+  if (files.empty())
+  {
+    Help();
+    return 1;
+  }
+
+  int ret = 0;
+  for (auto &file: files)
+  {
+    if (Result::OKAY != Replay(file, options, config))
+      ret = 1;
+  }
+  return ret;
+}
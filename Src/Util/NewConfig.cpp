@@ -300,6 +300,7 @@ namespace Util
         parent.m_last_child = node;
       }
       parent.m_children[node->m_key] = node;
+      Changed();
     }
 
     void Node::DeepCopy(const Node &that)
@@ -315,6 +316,7 @@ namespace Util
         ptr_t copied_child = std::make_shared<Node>(*child);
         AddChild(*this, copied_child);
       }
+      Changed();
     }
 
     void Node::Swap(Node &rhs)
@@ -325,6 +327,7 @@ namespace Util
       m_children.swap(rhs.m_children);
      const_cast<std::string *>(&m_key)->swap(*const_cast<std::string *>(&rhs.m_key));
       m_value.swap(rhs.m_value);
+      Changed();
     }
 
     Node &Node::operator=(const Node &rhs)
@@ -2,6 +2,7 @@
 #define INCLUDED_UTIL_CONFIG_H
 
 #include "Util/GenericValue.h"
+#include <atomic>
 #include <map>
 #include <memory>
 #include <exception>
@@ -24,6 +25,13 @@ namespace Util
       std::map<std::string, ptr_t> m_children;
       mutable std::map<std::string, Node> m_missing_nodes;  // missing nodes from failed queries (must also be empty)
       bool m_missing = false;
+      static inline std::atomic<unsigned> s_version{ 0 };
+
+      // Must follow any modification of a tree, so Setting<T> handles notice
+      static void Changed()
+      {
+        s_version.fetch_add(1, std::memory_order_release);
+      }
 
       void Destroy()
       {
@@ -32,6 +40,7 @@ namespace Util
         m_first_child.reset();
         m_last_child.reset();
         m_children.clear();
+        Changed();
       }
 
       void CheckEmptyOrMissing() const;
@@ -95,11 +104,19 @@ namespace Util
       inline void Clear()
       {
         m_value = nullptr;
+        Changed();
       }
 
       inline void SetValue(const std::shared_ptr<GenericValue> &value)
       {
         m_value = value;
+        Changed();
+      }
+
+      // Counts modifications of all config trees (values and structure)
+      static inline unsigned Version()
+      {
+        return s_version.load(std::memory_order_acquire);
       }
 
       template <typename T>
@@ -134,6 +151,7 @@ namespace Util
             m_value->Set(value);
           else
             m_value = std::make_shared<ValueInstance<T>>(value);
+          Changed();
         }
         else
           throw std::range_error(Util::Format() << "Node \"" << m_key << "\" does not exist");
@@ -256,6 +274,77 @@ namespace Util
       ~Node();
     };
 
+    /*
+     * Setting<T>:
+     *
+     * Typed handle to a single setting, for code that reads it every frame.
+     * The path is resolved and the value converted to T on first use. After
+     * that, Get() only compares Node::Version() with the version it last saw
+     * and looks the setting up again once any tree has been modified.
+     *
+     *    Util::Config::Setting<int> volume(config, "SoundVolume");
+     *    ...
+     *    float v = volume.Get() * 0.01f;
+     *
+     * Update() refreshes the value the same way and returns true if it has
+     * changed, for code that must react to a new value (e.g., by rebuilding
+     * tables that depend on it).
+     *
+     * Without a default, a missing or empty setting throws like ValueAs<T>().
+     */
+    template <typename T>
+    class Setting
+    {
+    public:
+      const T &Get()
+      {
+        if (!m_valid || m_version != Node::Version())
+          Update();
+        return m_value;
+      }
+
+      bool Update()
+      {
+        unsigned version = Node::Version();
+        if (m_valid && version == m_version)
+          return false;
+        const Node &node = (*m_config)[m_path];
+        T value = m_has_default ? node.ValueAsDefault<T>(m_default) : node.ValueAs<T>();
+        bool changed = !m_valid || !(value == m_value);
+        m_value = value;
+        m_version = version;
+        m_valid = true;
+        return changed;
+      }
+
+      Setting()
+      {
+      }
+
+      Setting(const Node &config, const std::string &path)
+        : m_config(&config),
+          m_path(path)
+      {
+      }
+
+      Setting(const Node &config, const std::string &path, const T &default_value)
+        : m_config(&config),
+          m_path(path),
+          m_default(default_value),
+          m_has_default(true)
+      {
+      }
+
+    private:
+      const Node *m_config = nullptr;
+      std::string m_path;
+      T m_default = T();
+      bool m_has_default = false;
+      T m_value = T();
+      unsigned m_version = 0;
+      bool m_valid = false;
+    };
+
     void PrintConfigTree(const Node &config, int indent_level = 0, int tab_stops = 2);
   } // Config
 } // Util
@@ -0,0 +1,37 @@
+#ifndef INCLUDED_UTIL_SIMD_H
+#define INCLUDED_UTIL_SIMD_H
+
+/*
+ * SIMD.h
+ *
+ * Compile-time selection of the vector instruction set used by the hot loops
+ * that have hand-written SIMD paths. Every such loop keeps its scalar version
+ * as the reference implementation, selected when neither macro is defined.
+ *
+ *   SUPERMODEL_SIMD_SSE2   x86/x86-64 with SSE2 (baseline on every x86-64
+ *                          target we build for, including MSVC x64).
+ *   SUPERMODEL_SIMD_NEON   ARMv7 with NEON or AArch64 (Advanced SIMD).
+ *   SUPERMODEL_SIMD_AVX2   x86-64 compiled with AVX2 enabled (-mavx2 or
+ *                          /arch:AVX2), defined on top of SUPERMODEL_SIMD_SSE2
+ *                          for the loops that want gathers or masked stores.
+ *                          Loops without an AVX2 path use their SSE2 one.
+ *
+ * Defining SUPERMODEL_NO_SIMD forces the scalar paths, which is useful when
+ * checking a vector path against the reference.
+ */
+
+#if !defined(SUPERMODEL_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SUPERMODEL_SIMD_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define SUPERMODEL_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__aarch64__)
+#define SUPERMODEL_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#endif  // INCLUDED_UTIL_SIMD_H
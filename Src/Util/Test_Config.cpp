@@ -202,6 +202,22 @@ int main()
     test_results.push_back({ "Duplicate leaf nodes", config.ToString() == expected_config });
   }
 
+  // Settings follow changes to the tree, including nodes added later
+  {
+    Util::Config::Node config("global");
+    config.Set("volume", 100);
+    Util::Config::Setting<int> volume(config, "volume");
+    Util::Config::Setting<bool> flag(config, "sub/flag", false);
+    test_results.push_back({ "Setting 1", volume.Get() == 100 && !flag.Get() });
+    test_results.push_back({ "Setting 2", !volume.Update() });
+    config.Set("volume", 50);
+    test_results.push_back({ "Setting 3", volume.Update() && volume.Get() == 50 });
+    config.Set("sub/flag", true);
+    test_results.push_back({ "Setting 4", flag.Get() });
+    config.Set("volume", 50);
+    test_results.push_back({ "Setting 5", !volume.Update() && volume.Get() == 50 });
+  }
+
   PrintTestResults(test_results);
   return 0;
 }
@@ -69,6 +69,7 @@ SOURCES_CXX := \
     $(CORE_DIR)/Src/Graphics/GLSLVersion.cpp \
     $(CORE_DIR)/Src/Model3/Real3D.cpp \
     $(CORE_DIR)/Src/Graphics/New3D/New3D.cpp \
+    $(CORE_DIR)/Src/Graphics/New3D/New3DScene.cpp \
     $(CORE_DIR)/Src/Graphics/New3D/Mat4.cpp \
     $(CORE_DIR)/Src/Graphics/New3D/Model.cpp \
     $(CORE_DIR)/Src/Graphics/New3D/PolyHeader.cpp \
@@ -83,8 +84,10 @@ SOURCES_CXX := \
     $(CORE_DIR)/Src/Graphics/FBO.cpp \
     $(CORE_DIR)/Src/Graphics/SuperAA.cpp \
     $(CORE_DIR)/Src/Graphics/Render2D.cpp \
+    $(CORE_DIR)/Src/Graphics/NullRender.cpp \
     $(CORE_DIR)/Src/Model3/TileGen.cpp \
     $(CORE_DIR)/Src/Model3/Model3.cpp \
+    $(CORE_DIR)/Src/Model3/GraphicsCapture.cpp \
     $(CORE_DIR)/Src/CPU/PowerPC/ppc.cpp \
     $(CORE_DIR)/Src/Model3/SoundBoard.cpp \
     $(CORE_DIR)/Src/Sound/SCSP.cpp \